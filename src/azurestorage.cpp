@@ -17,8 +17,10 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "azurefilesystem.hpp"
+#include "download_utils.hpp"
 #include "logging.hpp"
 
 namespace ovms {
@@ -402,7 +404,22 @@ StatusCode AzureStorageBlob::downloadFile(const std::string& local_path) {
             return StatusCode::AS_FILE_NOT_FOUND;
         }
 
-        as_blob_.download_to_file(local_path);
+        as_blob_.download_attributes();
+        const std::string cacheKey = DownloadCache::createKey(fullUri_, as_blob_.properties().etag());
+        const DownloadCache& cache = DownloadCache::instance();
+        if (cache.fetch(cacheKey, local_path)) {
+            return StatusCode::OK;
+        }
+        // Big blobs are downloaded with multiple concurrent ranged requests
+        as::blob_request_options options;
+        options.set_parallelism_factor(getDownloadThreadsCount());
+        // Download is pinned to ETag used in cache key, so that blob replaced meanwhile is not stored under previous version
+        as_blob_.download_to_file(local_path, as::access_condition::generate_if_match_condition(as_blob_.properties().etag()), options, as::operation_context());
+        auto status = checkDownloadedFileSize(local_path, as_blob_.properties().size());
+        if (status != StatusCode::OK) {
+            return status;
+        }
+        cache.store(cacheKey, local_path);
         return StatusCode::OK;
     } catch (const as::storage_exception& e) {
         SPDLOG_LOGGER_ERROR(azurestorage_logger, "Unable to access path: {}", extractAzureStorageExceptionMessage(e));
@@ -474,30 +491,32 @@ StatusCode AzureStorageBlob::downloadFileFolderTo(const std::string& local_path)
             }
         }
 
+        std::vector<download_task_t> tasks;
         for (auto&& f : files) {
             std::string remote_file_path = FileSystem::joinPath({fullUri_, f});
             std::string local_file_path = FileSystem::joinPath({local_path, f});
             SPDLOG_LOGGER_TRACE(azurestorage_logger, "Processing file {} from {} -> {}", f, remote_file_path,
                 local_file_path);
+            tasks.emplace_back([this, remote_file_path, local_file_path]() {
+                auto factory = std::make_shared<ovms::AzureStorageFactory>();
+                auto azureFiledirStorageObj = factory.get()->getNewAzureStorageObject(remote_file_path, account_);
+                auto status = azureFiledirStorageObj->checkPath(remote_file_path);
+                if (status != StatusCode::OK) {
+                    SPDLOG_LOGGER_WARN(azurestorage_logger, "Unable to download directory from {} to {}",
+                        remote_file_path, local_file_path);
+                    return status;
+                }
 
-            auto factory = std::make_shared<ovms::AzureStorageFactory>();
-            auto azureFiledirStorageObj = factory.get()->getNewAzureStorageObject(remote_file_path, account_);
-            status = azureFiledirStorageObj->checkPath(remote_file_path);
-            if (status != StatusCode::OK) {
-                SPDLOG_LOGGER_WARN(azurestorage_logger, "Unable to download directory from {} to {}",
-                    remote_file_path, local_file_path);
-                return status;
-            }
-
-            auto download_status =
-                azureFiledirStorageObj->downloadFile(local_file_path);
-            if (download_status != StatusCode::OK) {
-                SPDLOG_LOGGER_WARN(azurestorage_logger, "Unable to save file from {} to {}", remote_file_path,
-                    local_file_path);
+                auto download_status =
+                    azureFiledirStorageObj->downloadFile(local_file_path);
+                if (download_status != StatusCode::OK) {
+                    SPDLOG_LOGGER_WARN(azurestorage_logger, "Unable to save file from {} to {}", remote_file_path,
+                        local_file_path);
+                }
                 return download_status;
-            }
+            });
         }
-        return StatusCode::OK;
+        return runDownloadTasks(tasks);
     } catch (const as::storage_exception& e) {
         SPDLOG_LOGGER_ERROR(azurestorage_logger, "Unable to access path: {}", extractAzureStorageExceptionMessage(e));
     } catch (const std::exception& e) {
@@ -996,7 +1015,22 @@ StatusCode AzureStorageFile::downloadFile(const std::string& local_path) {
             return StatusCode::AS_FILE_NOT_FOUND;
         }
 
-        as_file1_.download_to_file(local_path);
+        as_file1_.download_attributes();
+        const std::string cacheKey = DownloadCache::createKey(fullUri_, as_file1_.properties().etag());
+        const DownloadCache& cache = DownloadCache::instance();
+        if (cache.fetch(cacheKey, local_path)) {
+            return StatusCode::OK;
+        }
+        // Big files are downloaded with multiple concurrent ranged requests
+        as::file_request_options options;
+        options.set_parallelism_factor(getDownloadThreadsCount());
+        // Download is pinned to ETag used in cache key, so that file replaced meanwhile is not stored under previous version
+        as_file1_.download_to_file(local_path, as::file_access_condition::generate_if_match_condition(as_file1_.properties().etag()), options, as::operation_context());
+        auto status = checkDownloadedFileSize(local_path, as_file1_.properties().size());
+        if (status != StatusCode::OK) {
+            return status;
+        }
+        cache.store(cacheKey, local_path);
         return StatusCode::OK;
     } catch (const as::storage_exception& e) {
         SPDLOG_LOGGER_ERROR(azurestorage_logger, "Unable to access path: {}", extractAzureStorageExceptionMessage(e));
@@ -1068,30 +1102,32 @@ StatusCode AzureStorageFile::downloadFileFolderTo(const std::string& local_path)
             }
         }
 
+        std::vector<download_task_t> tasks;
         for (auto&& f : files) {
             std::string remote_file_path = FileSystem::joinPath({fullUri_, f});
             std::string local_file_path = FileSystem::joinPath({local_path, f});
             SPDLOG_LOGGER_TRACE(azurestorage_logger, "Processing file {} from {} -> {}", f, remote_file_path,
                 local_file_path);
+            tasks.emplace_back([this, remote_file_path, local_file_path]() {
+                auto factory = std::make_shared<ovms::AzureStorageFactory>();
+                auto azureFileStorageObj = factory.get()->getNewAzureStorageObject(remote_file_path, account_);
+                auto status = azureFileStorageObj->checkPath(remote_file_path);
+                if (status != StatusCode::OK) {
+                    SPDLOG_LOGGER_WARN(azurestorage_logger, "Check path failed: {} -> {}", remote_file_path,
+                        ovms::Status(status).string());
+                    return status;
+                }
 
-            auto factory = std::make_shared<ovms::AzureStorageFactory>();
-            auto azureFileStorageObj = factory.get()->getNewAzureStorageObject(remote_file_path, account_);
-            auto status = azureFileStorageObj->checkPath(remote_file_path);
-            if (status != StatusCode::OK) {
-                SPDLOG_LOGGER_WARN(azurestorage_logger, "Check path failed: {} -> {}", remote_file_path,
-                    ovms::Status(status).string());
-                return status;
-            }
-
-            auto download_status =
-                azureFileStorageObj->downloadFile(local_file_path);
-            if (download_status != StatusCode::OK) {
-                SPDLOG_LOGGER_WARN(azurestorage_logger, "Unable to save file from {} to {}", remote_file_path,
-                    local_file_path);
+                auto download_status =
+                    azureFileStorageObj->downloadFile(local_file_path);
+                if (download_status != StatusCode::OK) {
+                    SPDLOG_LOGGER_WARN(azurestorage_logger, "Unable to save file from {} to {}", remote_file_path,
+                        local_file_path);
+                }
                 return download_status;
-            }
+            });
         }
-        return StatusCode::OK;
+        return runDownloadTasks(tasks);
     } catch (const as::storage_exception& e) {
         SPDLOG_LOGGER_ERROR(azurestorage_logger, "Unable to access path: {}", extractAzureStorageExceptionMessage(e));
     } catch (const std::exception& e) {
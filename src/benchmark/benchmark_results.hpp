@@ -0,0 +1,51 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+
+#include "latency_histogram.hpp"
+
+namespace ovms {
+namespace benchmark {
+
+using ResultsWriter = rapidjson::PrettyWriter<rapidjson::StringBuffer>;
+
+/**
+ * @brief Writes histogram summary as JSON object under given key
+ */
+inline void writeHistogram(ResultsWriter& writer, const char* name, const LatencyHistogram& histogram) {
+    writer.Key(name);
+    writer.StartObject();
+    writer.Key("min");
+    writer.Uint64(histogram.getMin());
+    writer.Key("mean");
+    writer.Double(histogram.getMean());
+    for (auto [key, percentile] : std::vector<std::pair<const char*, double>>{{"p50", 50}, {"p90", 90}, {"p99", 99}, {"p99_9", 99.9}}) {
+        writer.Key(key);
+        writer.Uint64(histogram.getValueAtPercentile(percentile));
+    }
+    writer.Key("max");
+    writer.Uint64(histogram.getMax());
+    writer.EndObject();
+}
+
+}  // namespace benchmark
+}  // namespace ovms
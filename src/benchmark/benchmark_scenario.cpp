@@ -0,0 +1,241 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "benchmark_scenario.hpp"
+
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+
+#include <rapidjson/document.h>
+#include <rapidjson/error/en.h>
+
+#include "../capi_frontend/capi_utils.hpp"
+#include "../precision.hpp"
+#include "../stringutils.hpp"
+
+namespace ovms {
+namespace benchmark {
+
+static OVMS_DataType parseDatatype(const std::string& datatype) {
+    Precision precision = fromKfsString(datatype);
+    if (precision == Precision::UNDEFINED) {
+        throw std::invalid_argument("Invalid datatype: " + datatype);
+    }
+    return getPrecisionAsOVMSDataType(precision);
+}
+
+static signed_shape_t parseDimensions(const std::string& dimensions) {
+    signed_shape_t shape;
+    for (const auto& dimension : tokenize(dimensions, ',')) {
+        auto value = stoi64(dimension);
+        if (!value.has_value() || value.value() <= 0) {
+            throw std::invalid_argument("Invalid shape dimension: " + dimension);
+        }
+        shape.push_back(value.value());
+    }
+    return shape;
+}
+
+std::vector<BenchmarkInput> parseInputs(const std::string& inputs, OVMS_DataType datatype) {
+    std::vector<BenchmarkInput> result;
+    size_t position = 0;
+    while (position < inputs.size()) {
+        size_t leftBracket = inputs.find('[', position);
+        size_t rightBracket = inputs.find(']', position);
+        if (leftBracket == std::string::npos || rightBracket == std::string::npos || leftBracket > rightBracket) {
+            throw std::invalid_argument("Invalid shape argument: " + inputs);
+        }
+        std::string name = inputs.substr(position, leftBracket - position);
+        erase_spaces(name);
+        if (name.empty()) {
+            throw std::invalid_argument("Missing input name in shape argument: " + inputs);
+        }
+        result.push_back({name, datatype, parseDimensions(inputs.substr(leftBracket + 1, rightBracket - leftBracket - 1))});
+        position = rightBracket + 1;
+        while (position < inputs.size() && (inputs[position] == ';' || inputs[position] == ',' || inputs[position] == ' ')) {
+            ++position;
+        }
+    }
+    if (result.empty()) {
+        throw std::invalid_argument("Invalid shape argument: " + inputs);
+    }
+    return result;
+}
+
+ArrivalMode parseArrivalMode(const std::string& arrival) {
+    if (arrival == "CLOSED") {
+        return ArrivalMode::CLOSED;
+    } else if (arrival == "CONSTANT") {
+        return ArrivalMode::CONSTANT;
+    } else if (arrival == "POISSON") {
+        return ArrivalMode::POISSON;
+    }
+    throw std::invalid_argument("Invalid arrival mode: " + arrival);
+}
+
+WorkloadMode parseWorkloadMode(const std::string& mode) {
+    if (mode == "INFERENCE_ONLY") {
+        return WorkloadMode::INFERENCE_ONLY;
+    } else if (mode == "RESET_BUFFER") {
+        return WorkloadMode::RESET_BUFFER;
+    } else if (mode == "RESET_REQUEST") {
+        return WorkloadMode::RESET_REQUEST;
+    }
+    throw std::invalid_argument("Invalid mode requested: " + mode);
+}
+
+const char* toString(ArrivalMode arrival) {
+    switch (arrival) {
+    case ArrivalMode::CLOSED:
+        return "CLOSED";
+    case ArrivalMode::CONSTANT:
+        return "CONSTANT";
+    case ArrivalMode::POISSON:
+        return "POISSON";
+    }
+    return "";
+}
+
+const char* toString(WorkloadMode mode) {
+    switch (mode) {
+    case WorkloadMode::INFERENCE_ONLY:
+        return "INFERENCE_ONLY";
+    case WorkloadMode::RESET_BUFFER:
+        return "RESET_BUFFER";
+    case WorkloadMode::RESET_REQUEST:
+        return "RESET_REQUEST";
+    }
+    return "";
+}
+
+static BenchmarkStream parseStream(const rapidjson::Value& node) {
+    BenchmarkStream stream;
+    if (!node.IsObject() || !node.HasMember("servable_name") || !node["servable_name"].IsString()) {
+        throw std::invalid_argument("Stream requires servable_name");
+    }
+    stream.servableName = node["servable_name"].GetString();
+    if (node.HasMember("servable_version")) {
+        stream.servableVersion = node["servable_version"].GetInt64();
+    }
+    if (!node.HasMember("inputs") || !node["inputs"].IsArray() || node["inputs"].Empty()) {
+        throw std::invalid_argument("Stream: " + stream.servableName + " requires inputs");
+    }
+    for (const auto& inputNode : node["inputs"].GetArray()) {
+        if (!inputNode.HasMember("name") || !inputNode.HasMember("shape") || !inputNode["shape"].IsArray()) {
+            throw std::invalid_argument("Input of stream: " + stream.servableName + " requires name and shape");
+        }
+        BenchmarkInput input;
+        input.name = inputNode["name"].GetString();
+        for (const auto& dimension : inputNode["shape"].GetArray()) {
+            if (!dimension.IsInt64() || dimension.GetInt64() <= 0) {
+                throw std::invalid_argument("Invalid shape of input: " + input.name);
+            }
+            input.shape.push_back(dimension.GetInt64());
+        }
+        if (inputNode.HasMember("datatype")) {
+            input.datatype = parseDatatype(inputNode["datatype"].GetString());
+        }
+        stream.inputs.push_back(std::move(input));
+    }
+    if (node.HasMember("arrival")) {
+        stream.arrival = parseArrivalMode(node["arrival"].GetString());
+    }
+    if (node.HasMember("mode")) {
+        stream.mode = parseWorkloadMode(node["mode"].GetString());
+    }
+    if (node.HasMember("rate")) {
+        stream.rate = node["rate"].GetDouble();
+    }
+    if (node.HasMember("concurrency")) {
+        stream.concurrency = node["concurrency"].GetUint();
+    }
+    if (node.HasMember("niter")) {
+        stream.niter = node["niter"].GetUint64();
+    }
+    if (stream.concurrency == 0) {
+        throw std::invalid_argument("Concurrency of stream: " + stream.servableName + " has to be positive");
+    }
+    if (stream.arrival != ArrivalMode::CLOSED && stream.rate <= 0) {
+        throw std::invalid_argument("Open loop stream: " + stream.servableName + " requires positive rate");
+    }
+    return stream;
+}
+
+BenchmarkScenario parseScenario(const std::string& json) {
+    rapidjson::Document document;
+    rapidjson::ParseResult parseResult = document.Parse(json.c_str());
+    if (parseResult.IsError()) {
+        throw std::invalid_argument(std::string("Scenario is not valid JSON: ") + rapidjson::GetParseError_En(parseResult.Code()));
+    }
+    if (!document.IsObject() || !document.HasMember("streams") || !document["streams"].IsArray() || document["streams"].Empty()) {
+        throw std::invalid_argument("Scenario requires streams");
+    }
+    BenchmarkScenario scenario;
+    if (document.HasMember("name")) {
+        scenario.name = document["name"].GetString();
+    }
+    if (document.HasMember("config_path")) {
+        scenario.configPath = document["config_path"].GetString();
+    }
+    if (document.HasMember("warmup_seconds")) {
+        scenario.warmupSeconds = document["warmup_seconds"].GetDouble();
+    }
+    if (document.HasMember("duration_seconds")) {
+        scenario.durationSeconds = document["duration_seconds"].GetDouble();
+    }
+    if (document.HasMember("seed")) {
+        scenario.seed = document["seed"].GetUint64();
+    }
+    for (const auto& streamNode : document["streams"].GetArray()) {
+        scenario.streams.push_back(parseStream(streamNode));
+        const auto& stream = scenario.streams.back();
+        if (scenario.durationSeconds <= 0 && (stream.arrival != ArrivalMode::CLOSED || stream.niter == 0)) {
+            throw std::invalid_argument("Stream: " + stream.servableName + " requires niter or scenario duration_seconds");
+        }
+    }
+    return scenario;
+}
+
+BenchmarkScenario loadScenario(const std::string& path) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        throw std::invalid_argument("Cannot open scenario file: " + path);
+    }
+    std::stringstream content;
+    content << file.rdbuf();
+    return parseScenario(content.str());
+}
+
+std::vector<uint64_t> createArrivalSchedule(ArrivalMode arrival, double rate, double durationSeconds, uint64_t seed) {
+    std::vector<uint64_t> schedule;
+    if (arrival == ArrivalMode::CLOSED || rate <= 0 || durationSeconds <= 0) {
+        return schedule;
+    }
+    const double durationUs = durationSeconds * 1'000'000;
+    const double intervalUs = 1'000'000 / rate;
+    schedule.reserve(static_cast<size_t>(durationSeconds * rate) + 1);
+    std::mt19937_64 generator(seed);
+    std::exponential_distribution<double> distribution(1.0 / intervalUs);
+    for (double time = 0; time < durationUs;) {
+        schedule.push_back(static_cast<uint64_t>(time));
+        time += (arrival == ArrivalMode::POISSON) ? distribution(generator) : intervalUs;
+    }
+    return schedule;
+}
+
+}  // namespace benchmark
+}  // namespace ovms
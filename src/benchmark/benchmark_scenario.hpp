@@ -0,0 +1,93 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "../ovms.h"  // NOLINT
+
+namespace ovms {
+namespace benchmark {
+
+using signed_shape_t = std::vector<int64_t>;
+
+enum class ArrivalMode {
+    CLOSED,    // each worker sends next request right after previous response
+    CONSTANT,  // requests are scheduled with fixed interval
+    POISSON    // requests are scheduled with exponentially distributed intervals
+};
+
+enum class WorkloadMode {
+    INFERENCE_ONLY,  // the same request is reused
+    RESET_BUFFER,    // input data is replaced in reused request
+    RESET_REQUEST    // request is created for each inference
+};
+
+struct BenchmarkInput {
+    std::string name;
+    OVMS_DataType datatype = OVMS_DATATYPE_FP32;
+    signed_shape_t shape;
+};
+
+/**
+ * @brief Load sent to single servable (model or DAG)
+ */
+struct BenchmarkStream {
+    std::string servableName;
+    int64_t servableVersion = 0;
+    std::vector<BenchmarkInput> inputs;
+    ArrivalMode arrival = ArrivalMode::CLOSED;
+    WorkloadMode mode = WorkloadMode::INFERENCE_ONLY;
+    double rate = 0;  // requests per second, open loop only
+    uint32_t concurrency = 1;  // number of workers, in open loop this limits requests in flight
+    uint64_t niter = 0;  // closed loop only, when 0 duration is used
+};
+
+struct BenchmarkScenario {
+    std::string name = "cli";
+    std::string configPath;
+    double warmupSeconds = 0;
+    double durationSeconds = 0;
+    std::optional<uint64_t> seed;
+    std::vector<BenchmarkStream> streams;
+};
+
+/**
+ * @brief Parses inputs specification "name[d0,d1,...]" with entries separated by ';' or ','
+ */
+std::vector<BenchmarkInput> parseInputs(const std::string& inputs, OVMS_DataType datatype = OVMS_DATATYPE_FP32);
+
+ArrivalMode parseArrivalMode(const std::string& arrival);
+WorkloadMode parseWorkloadMode(const std::string& mode);
+const char* toString(ArrivalMode arrival);
+const char* toString(WorkloadMode mode);
+
+/**
+ * @brief Reads scenario from JSON file, throws std::invalid_argument on invalid content
+ */
+BenchmarkScenario loadScenario(const std::string& path);
+BenchmarkScenario parseScenario(const std::string& json);
+
+/**
+ * @brief Intended send times of open loop requests, in microseconds from workload start
+ */
+std::vector<uint64_t> createArrivalSchedule(ArrivalMode arrival, double rate, double durationSeconds, uint64_t seed);
+
+}  // namespace benchmark
+}  // namespace ovms
@@ -0,0 +1,846 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+// Loopback benchmark of gRPC and REST frontends. Server is started in-process on 127.0.0.1 and
+// driven by multi-threaded clients. Server side stages of the same request are measured by replaying
+// the steps frontend executes - parse, validate, deserialize, infer, serialize, write - so that
+// frontend overhead can be compared with pure inference.
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <cxxopts.hpp>
+#include <grpcpp/create_channel.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <openvino/openvino.hpp>
+#include <sys/socket.h>
+#include <sysexits.h>
+#include <unistd.h>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wall"
+#include "tensorflow_serving/apis/prediction_service.grpc.pb.h"
+#pragma GCC diagnostic pop
+
+#include "../capi_frontend/capi_utils.hpp"
+#include "../capi_frontend/server_settings.hpp"
+#include "../deserialization.hpp"
+#include "../executingstreamidguard.hpp"
+#include "../http_rest_api_handler.hpp"
+#include "../kfs_frontend/kfs_grpc_inference_service.hpp"
+#include "../kfs_frontend/kfs_utils.hpp"
+#include "../modelconfig.hpp"
+#include "../modelinstance.hpp"
+#include "../modelinstanceunloadguard.hpp"
+#include "../modelmanager.hpp"
+#include "../predict_request_validation_utils.hpp"
+#include "../prediction_service_utils.hpp"
+#include "../rest_parser.hpp"
+#include "../rest_utils.hpp"
+#include "../serialization.hpp"
+#include "../servablemanagermodule.hpp"
+#include "../server.hpp"
+#include "../status.hpp"
+#include "../stringutils.hpp"
+#include "../tfs_frontend/tfs_utils.hpp"
+#include "benchmark_results.hpp"
+#include "benchmark_scenario.hpp"
+#include "latency_histogram.hpp"
+
+namespace {
+
+using ovms::benchmark::BenchmarkInput;
+using ovms::benchmark::LatencyHistogram;
+using ovms::benchmark::writeHistogram;
+using clock_type = std::chrono::steady_clock;
+
+enum class Frontend {
+    TFS_GRPC,
+    KFS_GRPC,
+    TFS_REST,
+    KFS_REST
+};
+
+const std::array<Frontend, 4> ALL_FRONTENDS{Frontend::TFS_GRPC, Frontend::KFS_GRPC, Frontend::TFS_REST, Frontend::KFS_REST};
+
+const char* toString(Frontend frontend) {
+    switch (frontend) {
+    case Frontend::TFS_GRPC:
+        return "tfs_grpc";
+    case Frontend::KFS_GRPC:
+        return "kfs_grpc";
+    case Frontend::TFS_REST:
+        return "tfs_rest";
+    case Frontend::KFS_REST:
+        return "kfs_rest";
+    }
+    return "";
+}
+
+std::vector<Frontend> parseFrontends(const std::string& frontends) {
+    std::vector<Frontend> result;
+    for (const auto& name : ovms::tokenize(frontends, ',')) {
+        auto frontend = std::find_if(ALL_FRONTENDS.begin(), ALL_FRONTENDS.end(), [&name](Frontend f) { return name == toString(f); });
+        if (frontend == ALL_FRONTENDS.end()) {
+            throw std::invalid_argument("Invalid frontend: " + name);
+        }
+        result.push_back(*frontend);
+    }
+    if (result.empty()) {
+        throw std::invalid_argument("At least one frontend is required");
+    }
+    return result;
+}
+
+enum Stage : size_t {
+    PARSE,
+    VALIDATE,
+    DESERIALIZE,
+    INFER,
+    SERIALIZE,
+    WRITE,
+    STAGE_END
+};
+
+const std::array<const char*, STAGE_END> STAGE_NAMES{"parse", "validate", "deserialize", "infer", "serialize", "write"};
+
+using StageHistograms = std::array<LatencyHistogram, STAGE_END>;
+
+class BenchmarkCLIParser {
+    std::unique_ptr<cxxopts::Options> options;
+
+public:
+    std::unique_ptr<cxxopts::ParseResult> result;
+
+    BenchmarkCLIParser() = default;
+    void parse(int argc, char** argv);
+};
+
+void BenchmarkCLIParser::parse(int argc, char** argv) {
+    try {
+        options = std::make_unique<cxxopts::Options>(argv[0], "OpenVINO Model Server frontends benchmark");
+
+        // clang-format off
+        options->add_options()
+            ("h, help",
+                "Show this help message and exit")
+            // server options
+            ("port",
+                "gRPC server port on loopback interface",
+                cxxopts::value<uint32_t>()->default_value("9178"),
+                "PORT")
+            ("rest_port",
+                "REST server port on loopback interface",
+                cxxopts::value<uint32_t>()->default_value("9179"),
+                "REST_PORT")
+            ("grpc_workers",
+                "Number of gRPC servers",
+                cxxopts::value<uint32_t>()->default_value("1"),
+                "GRPC_WORKERS")
+            ("rest_workers",
+                "Number of REST worker threads, default is set by the server",
+                cxxopts::value<uint32_t>(),
+                "REST_WORKERS")
+            ("log_level",
+                "serving log level - one of TRACE, DEBUG, INFO, WARNING, ERROR",
+                cxxopts::value<std::string>()->default_value("ERROR"),
+                "LOG_LEVEL")
+            ("config_path",
+                "Config file path for OVMS to read",
+                cxxopts::value<std::string>()->default_value("/ovms/src/test/c_api/config_standard_dummy.json"),
+                "CONFIG_PATH")
+            // benchmark options
+            ("frontends",
+                "Comma separated list of benchmarked frontends. Possible values: tfs_grpc, kfs_grpc, tfs_rest, kfs_rest",
+                cxxopts::value<std::string>()->default_value("tfs_grpc,kfs_grpc,tfs_rest,kfs_rest"),
+                "FRONTENDS")
+            ("concurrency",
+                "Number of client threads, each with its own connection",
+                cxxopts::value<uint32_t>()->default_value("4"),
+                "CONCURRENCY")
+            ("niter",
+                "Number of measured requests sent to each frontend",
+                cxxopts::value<uint64_t>()->default_value("10000"),
+                "NITER")
+            ("warmup_niter",
+                "Number of requests sent to each frontend before measurement",
+                cxxopts::value<uint64_t>()->default_value("100"),
+                "WARMUP_NITER")
+            ("stage_niter",
+                "Number of sequential requests replayed in-process to measure server stages. 0 disables stages breakdown",
+                cxxopts::value<uint64_t>()->default_value("1000"),
+                "STAGE_NITER")
+            ("output",
+                "Path to file in which JSON results are saved",
+                cxxopts::value<std::string>(),
+                "OUTPUT")
+            ("label",
+                "Label stored in JSON results, for example commit id",
+                cxxopts::value<std::string>()->default_value(""),
+                "LABEL")
+            // inference data
+            ("servable_name",
+                "Servable name to sent requests to",
+                cxxopts::value<std::string>()->default_value("dummy"),
+                "SERVABLE_NAME")
+            ("servable_version",
+                "Servable version, 0 means default version",
+                cxxopts::value<int64_t>()->default_value("0"),
+                "SERVABLE_VERSION")
+            ("shape",
+                "Semicolon separated list of inputs names followed by their shapes in brackets. For example: \"inputA[1,3,224,224];inputB[1,10]\"",
+                cxxopts::value<std::string>()->default_value("b[1,10]"),
+                "SHAPE");
+        // clang-format on
+
+        result = std::make_unique<cxxopts::ParseResult>(options->parse(argc, argv));
+
+        if (result->count("help")) {
+            std::cout << options->help() << std::endl;
+            exit(EX_OK);
+        }
+    } catch (const cxxopts::OptionException& e) {
+        std::cerr << "error parsing options: " << e.what() << std::endl;
+        exit(EX_USAGE);
+    }
+}
+
+/**
+ * Requests with identical content in each frontend format, zero filled.
+ */
+struct Payload {
+    std::string servableName;
+    int64_t servableVersion = 0;
+    tensorflow::serving::PredictRequest tfsRequest;
+    ::KFSRequest kfsRequest;
+    std::string tfsGrpc;
+    std::string kfsGrpc;
+    std::string tfsJson;
+    std::string kfsJson;
+    std::string tfsPath;
+    std::string kfsPath;
+};
+
+void appendNestedArray(std::stringstream& json, const ovms::benchmark::signed_shape_t& shape, size_t dimension) {
+    if (dimension == shape.size()) {
+        json << "0";
+        return;
+    }
+    json << "[";
+    for (int64_t i = 0; i < shape[dimension]; ++i) {
+        if (i > 0) {
+            json << ",";
+        }
+        appendNestedArray(json, shape, dimension + 1);
+    }
+    json << "]";
+}
+
+Payload createPayload(const std::string& servableName, int64_t servableVersion, const std::vector<BenchmarkInput>& inputs) {
+    Payload payload;
+    payload.servableName = servableName;
+    payload.servableVersion = servableVersion;
+    std::string versionPath = servableVersion > 0 ? "/versions/" + std::to_string(servableVersion) : "";
+    payload.tfsPath = "/v1/models/" + servableName + versionPath + ":predict";
+    payload.kfsPath = "/v2/models/" + servableName + versionPath + "/infer";
+
+    payload.tfsRequest.mutable_model_spec()->set_name(servableName);
+    payload.kfsRequest.set_model_name(servableName);
+    if (servableVersion > 0) {
+        payload.tfsRequest.mutable_model_spec()->mutable_version()->set_value(servableVersion);
+        payload.kfsRequest.set_model_version(std::to_string(servableVersion));
+    }
+    std::stringstream tfsJson;
+    std::stringstream kfsJson;
+    tfsJson << "{\"inputs\":{";
+    kfsJson << "{\"inputs\":[";
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        const auto& input = inputs[i];
+        const size_t itemsize = ovms::DataTypeToByteSize(input.datatype);
+        if (itemsize == 0) {
+            throw std::invalid_argument("Unsupported datatype of input: " + input.name);
+        }
+        const auto precision = ovms::getOVMSDataTypeAsPrecision(input.datatype);
+        const auto elementsCount = std::accumulate(input.shape.begin(), input.shape.end(), int64_t{1}, std::multiplies<int64_t>());
+        const std::string content(itemsize * elementsCount, '\0');
+
+        auto& tensorProto = (*payload.tfsRequest.mutable_inputs())[input.name];
+        tensorProto.set_dtype(ovms::getPrecisionAsDataType(precision));
+        for (auto dim : input.shape) {
+            tensorProto.mutable_tensor_shape()->add_dim()->set_size(dim);
+        }
+        tensorProto.set_tensor_content(content);
+
+        auto* kfsInput = payload.kfsRequest.add_inputs();
+        kfsInput->set_name(input.name);
+        kfsInput->set_datatype(ovms::ovmsPrecisionToKFSPrecision(precision));
+        for (auto dim : input.shape) {
+            kfsInput->add_shape(dim);
+        }
+        payload.kfsRequest.add_raw_input_contents()->assign(content);
+
+        if (i > 0) {
+            tfsJson << ",";
+            kfsJson << ",";
+        }
+        tfsJson << "\"" << input.name << "\":";
+        appendNestedArray(tfsJson, input.shape, 0);
+        kfsJson << "{\"name\":\"" << input.name << "\",\"datatype\":\"" << ovms::ovmsPrecisionToKFSPrecision(precision) << "\",\"shape\":[";
+        for (size_t d = 0; d < input.shape.size(); ++d) {
+            kfsJson << (d > 0 ? "," : "") << input.shape[d];
+        }
+        kfsJson << "],\"data\":[";
+        for (int64_t e = 0; e < elementsCount; ++e) {
+            kfsJson << (e > 0 ? ",0" : "0");
+        }
+        kfsJson << "]}";
+    }
+    tfsJson << "}}";
+    kfsJson << "]}";
+    payload.tfsJson = tfsJson.str();
+    payload.kfsJson = kfsJson.str();
+    payload.tfsRequest.SerializeToString(&payload.tfsGrpc);
+    payload.kfsRequest.SerializeToString(&payload.kfsGrpc);
+    return payload;
+}
+
+/**
+ * Minimal blocking HTTP/1.1 client keeping single connection alive. Supports responses with Content-Length only.
+ */
+class HttpConnection {
+    int fd = -1;
+    std::string buffer;
+
+public:
+    explicit HttpConnection(uint32_t port) {
+        fd = socket(AF_INET, SOCK_STREAM, 0);
+        if (fd < 0) {
+            throw std::runtime_error("Cannot create socket");
+        }
+        int flag = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(port);
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        if (connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+            close(fd);
+            throw std::runtime_error("Cannot connect to REST port: " + std::to_string(port));
+        }
+    }
+    ~HttpConnection() {
+        close(fd);
+    }
+    HttpConnection(const HttpConnection&) = delete;
+    HttpConnection& operator=(const HttpConnection&) = delete;
+
+    /**
+     * @return HTTP status code or -1 on connection error
+     */
+    int post(const std::string& path, const std::string& body, std::string& response) {
+        std::string request = "POST " + path + " HTTP/1.1\r\nHost: localhost\r\nContent-Type: application/json\r\nContent-Length: " + std::to_string(body.size()) + "\r\n\r\n";
+        request += body;
+        if (!sendAll(request)) {
+            return -1;
+        }
+        size_t headersEnd;
+        while ((headersEnd = buffer.find("\r\n\r\n")) == std::string::npos) {
+            if (!receive()) {
+                return -1;
+            }
+        }
+        std::string headers = buffer.substr(0, headersEnd);
+        std::transform(headers.begin(), headers.end(), headers.begin(), ::tolower);
+        const size_t statusStart = headers.find(' ');
+        const size_t lengthStart = headers.find("content-length:");
+        if (statusStart == std::string::npos || lengthStart == std::string::npos) {
+            return -1;
+        }
+        const int statusCode = std::atoi(headers.c_str() + statusStart + 1);
+        const size_t contentLength = std::strtoull(headers.c_str() + lengthStart + std::strlen("content-length:"), nullptr, 10);
+        const size_t bodyStart = headersEnd + 4;
+        while (buffer.size() < bodyStart + contentLength) {
+            if (!receive()) {
+                return -1;
+            }
+        }
+        response.assign(buffer, bodyStart, contentLength);
+        buffer.erase(0, bodyStart + contentLength);
+        return statusCode;
+    }
+
+private:
+    bool sendAll(const std::string& data) {
+        size_t sent = 0;
+        while (sent < data.size()) {
+            auto result = send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+            if (result <= 0) {
+                return false;
+            }
+            sent += result;
+        }
+        return true;
+    }
+    bool receive() {
+        char chunk[16384];
+        auto result = recv(fd, chunk, sizeof(chunk), 0);
+        if (result <= 0) {
+            return false;
+        }
+        buffer.append(chunk, result);
+        return true;
+    }
+};
+
+/**
+ * Client of single frontend owned by one worker thread
+ */
+class LoopbackClient {
+public:
+    virtual ~LoopbackClient() = default;
+    virtual bool send() = 0;
+};
+
+std::shared_ptr<grpc::Channel> createChannel(uint32_t port) {
+    grpc::ChannelArguments args;
+    // Separate connection for each worker instead of shared subchannel
+    args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+    args.SetMaxReceiveMessageSize(-1);
+    return grpc::CreateCustomChannel("127.0.0.1:" + std::to_string(port), grpc::InsecureChannelCredentials(), args);
+}
+
+class TfsGrpcClient : public LoopbackClient {
+    std::unique_ptr<tensorflow::serving::PredictionService::Stub> stub;
+    const Payload& payload;
+
+public:
+    TfsGrpcClient(uint32_t port, const Payload& payload) :
+        stub(tensorflow::serving::PredictionService::NewStub(createChannel(port))),
+        payload(payload) {}
+    bool send() override {
+        grpc::ClientContext context;
+        tensorflow::serving::PredictResponse response;
+        return stub->Predict(&context, payload.tfsRequest, &response).ok();
+    }
+};
+
+class KfsGrpcClient : public LoopbackClient {
+    std::unique_ptr<inference::GRPCInferenceService::Stub> stub;
+    const Payload& payload;
+
+public:
+    KfsGrpcClient(uint32_t port, const Payload& payload) :
+        stub(inference::GRPCInferenceService::NewStub(createChannel(port))),
+        payload(payload) {}
+    bool send() override {
+        grpc::ClientContext context;
+        ::KFSResponse response;
+        return stub->ModelInfer(&context, payload.kfsRequest, &response).ok();
+    }
+};
+
+class RestClient : public LoopbackClient {
+    HttpConnection connection;
+    const std::string& path;
+    const std::string& body;
+    std::string response;
+
+public:
+    RestClient(uint32_t port, const std::string& path, const std::string& body) :
+        connection(port),
+        path(path),
+        body(body) {}
+    bool send() override {
+        return connection.post(path, body, response) == 200;
+    }
+};
+
+std::unique_ptr<LoopbackClient> createClient(Frontend frontend, uint32_t grpcPort, uint32_t restPort, const Payload& payload) {
+    switch (frontend) {
+    case Frontend::TFS_GRPC:
+        return std::make_unique<TfsGrpcClient>(grpcPort, payload);
+    case Frontend::KFS_GRPC:
+        return std::make_unique<KfsGrpcClient>(grpcPort, payload);
+    case Frontend::TFS_REST:
+        return std::make_unique<RestClient>(restPort, payload.tfsPath, payload.tfsJson);
+    case Frontend::KFS_REST:
+        return std::make_unique<RestClient>(restPort, payload.kfsPath, payload.kfsJson);
+    }
+    return nullptr;
+}
+
+struct LoopbackResult {
+    LatencyHistogram latency;  // microseconds
+    uint64_t errors = 0;
+    double measuredSeconds = 0;
+};
+
+LoopbackResult runLoopback(Frontend frontend, uint32_t grpcPort, uint32_t restPort, const Payload& payload, uint32_t concurrency, uint64_t niter, uint64_t warmupNiter) {
+    std::vector<std::unique_ptr<LoopbackClient>> clients;
+    for (uint32_t i = 0; i < concurrency; ++i) {
+        clients.push_back(createClient(frontend, grpcPort, restPort, payload));
+    }
+    for (uint64_t i = 0; i < warmupNiter; ++i) {
+        clients[i % concurrency]->send();
+    }
+    std::vector<LoopbackResult> results(concurrency);
+    std::atomic<uint64_t> remaining{niter};
+    std::vector<std::thread> workers;
+    auto start = clock_type::now();
+    for (uint32_t i = 0; i < concurrency; ++i) {
+        workers.emplace_back([&clients, &results, &remaining, i]() {
+            auto& client = *clients[i];
+            auto& result = results[i];
+            while (true) {
+                uint64_t left = remaining.load();
+                do {
+                    if (left == 0) {
+                        return;
+                    }
+                } while (!remaining.compare_exchange_weak(left, left - 1));
+                auto requestStart = clock_type::now();
+                if (!client.send()) {
+                    result.errors++;
+                    continue;
+                }
+                result.latency.record(std::chrono::duration_cast<std::chrono::microseconds>(clock_type::now() - requestStart).count());
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    LoopbackResult merged;
+    merged.measuredSeconds = std::chrono::duration<double>(clock_type::now() - start).count();
+    for (const auto& result : results) {
+        merged.latency.merge(result.latency);
+        merged.errors += result.errors;
+    }
+    return merged;
+}
+
+template <typename Function>
+ovms::Status measureStage(LatencyHistogram& histogram, Function&& function) {
+    auto start = clock_type::now();
+    ovms::Status status = function();
+    histogram.record(std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now() - start).count());
+    return status;
+}
+
+/**
+ * Stages following parsing, executed the same way as in ModelInstance::infer for model with static shapes
+ */
+template <typename RequestType, typename ResponseType, typename WriteFunction>
+ovms::Status replayModelStages(ovms::ModelInstance& instance, const RequestType& request, StageHistograms& stages, WriteFunction&& write) {
+    auto status = measureStage(stages[VALIDATE], [&]() {
+        return ovms::request_validation_utils::validate(
+            request,
+            instance.getInputsInfo(),
+            instance.getName(),
+            instance.getVersion(),
+            instance.getOptionalInputNames(),
+            instance.getModelConfig().getBatchingMode(),
+            instance.getModelConfig().getShapes(),
+            instance.getModelConfig().getShapeBuckets());
+    });
+    if (!status.ok()) {
+        return status;
+    }
+    ovms::ExecutingStreamIdGuard executingStreamIdGuard(instance.getInferRequestsQueue(), instance.getMetricReporter());
+    ov::InferRequest& inferRequest = executingStreamIdGuard.getInferRequest();
+    status = measureStage(stages[DESERIALIZE], [&]() {
+        ovms::InputSink<ov::InferRequest&> inputSink(inferRequest);
+        bool isPipeline = false;
+        return ovms::deserializePredictRequest<ovms::ConcreteTensorProtoDeserializator>(request, instance.getInputsInfo(), inputSink, isPipeline);
+    });
+    if (!status.ok()) {
+        return status;
+    }
+    status = measureStage(stages[INFER], [&]() {
+        return instance.performInference(inferRequest);
+    });
+    if (!status.ok()) {
+        return status;
+    }
+    ResponseType response;
+    status = measureStage(stages[SERIALIZE], [&]() {
+        ovms::OutputGetter<ov::InferRequest&> outputGetter(inferRequest);
+        return ovms::serializePredictResponse(outputGetter, instance.getName(), instance.getVersion(), instance.getOutputsInfo(), &response, ovms::getTensorInfoName, ovms::useSharedOutputContentFn(&request));
+    });
+    if (!status.ok()) {
+        return status;
+    }
+    std::string output;
+    return measureStage(stages[WRITE], [&]() {
+        return write(response, output);
+    });
+}
+
+ovms::Status replayStages(Frontend frontend, ovms::ModelInstance& instance, const Payload& payload, StageHistograms& stages) {
+    std::optional<int64_t> servableVersion;
+    if (payload.servableVersion > 0) {
+        servableVersion = payload.servableVersion;
+    }
+    switch (frontend) {
+    case Frontend::TFS_GRPC: {
+        tensorflow::serving::PredictRequest request;
+        auto status = measureStage(stages[PARSE], [&]() -> ovms::Status {
+            return request.ParseFromString(payload.tfsGrpc) ? ovms::StatusCode::OK : ovms::StatusCode::INTERNAL_ERROR;
+        });
+        if (!status.ok()) {
+            return status;
+        }
+        return replayModelStages<tensorflow::serving::PredictRequest, tensorflow::serving::PredictResponse>(instance, request, stages,
+            [](tensorflow::serving::PredictResponse& response, std::string& output) -> ovms::Status {
+                return response.SerializeToString(&output) ? ovms::StatusCode::OK : ovms::StatusCode::INTERNAL_ERROR;
+            });
+    }
+    case Frontend::KFS_GRPC: {
+        ::KFSRequest request;
+        auto status = measureStage(stages[PARSE], [&]() -> ovms::Status {
+            return request.ParseFromString(payload.kfsGrpc) ? ovms::StatusCode::OK : ovms::StatusCode::INTERNAL_ERROR;
+        });
+        if (!status.ok()) {
+            return status;
+        }
+        return replayModelStages<::KFSRequest, ::KFSResponse>(instance, request, stages,
+            [](::KFSResponse& response, std::string& output) -> ovms::Status {
+                return response.SerializeToString(&output) ? ovms::StatusCode::OK : ovms::StatusCode::INTERNAL_ERROR;
+            });
+    }
+    case Frontend::TFS_REST: {
+        ovms::TFSRestParser parser(instance.getInputsInfo());
+        auto status = measureStage(stages[PARSE], [&]() {
+            return parser.parse(payload.tfsJson.c_str());
+        });
+        if (!status.ok()) {
+            return status;
+        }
+        auto& request = parser.getProto();
+        request.mutable_model_spec()->set_name(payload.servableName);
+        const ovms::Order order = parser.getOrder();
+        return replayModelStages<tensorflow::serving::PredictRequest, tensorflow::serving::PredictResponse>(instance, request, stages,
+            [order](tensorflow::serving::PredictResponse& response, std::string& output) {
+                return ovms::makeJsonFromPredictResponse(response, &output, order);
+            });
+    }
+    case Frontend::KFS_REST: {
+        ::KFSRequest request;
+        auto status = measureStage(stages[PARSE], [&]() {
+            return ovms::HttpRestApiHandler::prepareGrpcRequest(payload.servableName, servableVersion, payload.kfsJson, request);
+        });
+        if (!status.ok()) {
+            return status;
+        }
+        return replayModelStages<::KFSRequest, ::KFSResponse>(instance, request, stages,
+            [](::KFSResponse& response, std::string& output) {
+                std::optional<int> inferenceHeaderContentLength;
+                return ovms::makeJsonFromPredictResponse(response, &output, inferenceHeaderContentLength);
+            });
+    }
+    }
+    return ovms::StatusCode::NOT_IMPLEMENTED;
+}
+
+struct FrontendResult {
+    Frontend frontend;
+    LoopbackResult loopback;
+    std::optional<StageHistograms> stages;  // nanoseconds
+};
+
+double getStagesMeanSumUs(const StageHistograms& stages) {
+    return std::accumulate(stages.begin(), stages.end(), 0.0, [](double sum, const LatencyHistogram& stage) { return sum + stage.getMean(); }) / 1'000;
+}
+
+void printResult(const FrontendResult& result, uint32_t concurrency) {
+    const auto& latency = result.loopback.latency;
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "Frontend: " << toString(result.frontend) << "; concurrency: " << concurrency << std::endl;
+    std::cout << "FPS: " << latency.getCount() / result.loopback.measuredSeconds << "; errors: " << result.loopback.errors << std::endl;
+    std::cout << "Average latency end to end:" << latency.getMean() / 1'000 << "ms" << std::endl;
+    std::cout << "Latency percentiles p50/p90/p99/p99.9: "
+              << latency.getValueAtPercentile(50) / 1'000.0 << "/"
+              << latency.getValueAtPercentile(90) / 1'000.0 << "/"
+              << latency.getValueAtPercentile(99) / 1'000.0 << "/"
+              << latency.getValueAtPercentile(99.9) / 1'000.0 << "ms" << std::endl;
+    if (!result.stages.has_value()) {
+        return;
+    }
+    std::cout << "Server stages mean/p99 in sequential replay:" << std::endl;
+    for (size_t stage = 0; stage < STAGE_END; ++stage) {
+        const auto& histogram = result.stages.value()[stage];
+        std::cout << "  " << std::left << std::setw(12) << STAGE_NAMES[stage] << std::right
+                  << histogram.getMean() / 1'000 << "/" << histogram.getValueAtPercentile(99) / 1'000.0 << "us" << std::endl;
+    }
+    // Remainder of end to end latency is spent in transport, threading and framework of the frontend
+    const double other = std::max(0.0, latency.getMean() - getStagesMeanSumUs(result.stages.value()));
+    std::cout << "  " << std::left << std::setw(12) << "other" << std::right << other << "us" << std::endl;
+}
+
+std::string resultsToJson(const std::string& label, const Payload& payload, uint32_t concurrency, const std::vector<FrontendResult>& results) {
+    rapidjson::StringBuffer buffer;
+    ovms::benchmark::ResultsWriter writer(buffer);
+    writer.StartObject();
+    writer.Key("label");
+    writer.String(label.c_str());
+    writer.Key("servable_name");
+    writer.String(payload.servableName.c_str());
+    writer.Key("servable_version");
+    writer.Int64(payload.servableVersion);
+    writer.Key("concurrency");
+    writer.Uint(concurrency);
+    writer.Key("frontends");
+    writer.StartArray();
+    for (const auto& result : results) {
+        writer.StartObject();
+        writer.Key("frontend");
+        writer.String(toString(result.frontend));
+        writer.Key("requests");
+        writer.Uint64(result.loopback.latency.getCount());
+        writer.Key("errors");
+        writer.Uint64(result.loopback.errors);
+        writer.Key("throughput");
+        writer.Double(result.loopback.latency.getCount() / result.loopback.measuredSeconds);
+        writeHistogram(writer, "latency_us", result.loopback.latency);
+        if (result.stages.has_value()) {
+            writer.Key("stages_ns");
+            writer.StartObject();
+            for (size_t stage = 0; stage < STAGE_END; ++stage) {
+                writeHistogram(writer, STAGE_NAMES[stage], result.stages.value()[stage]);
+            }
+            writer.EndObject();
+            writer.Key("other_us");
+            writer.Double(std::max(0.0, result.loopback.latency.getMean() - getStagesMeanSumUs(result.stages.value())));
+        }
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.EndObject();
+    return buffer.GetString();
+}
+
+bool waitForServerReady(const ovms::Server& server) {
+    auto start = clock_type::now();
+    while (!server.isReady()) {
+        if (clock_type::now() - start > std::chrono::seconds(60)) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    BenchmarkCLIParser cliparser;
+    cliparser.parse(argc, argv);
+    const auto& cli = *cliparser.result;
+
+    std::vector<Frontend> frontends;
+    Payload payload;
+    try {
+        frontends = parseFrontends(cli["frontends"].as<std::string>());
+        payload = createPayload(cli["servable_name"].as<std::string>(), cli["servable_version"].as<int64_t>(), ovms::benchmark::parseInputs(cli["shape"].as<std::string>()));
+    } catch (const std::exception& e) {
+        std::cerr << "Invalid benchmark configuration: " << e.what() << std::endl;
+        return EX_USAGE;
+    }
+    const uint32_t concurrency = std::max<uint32_t>(1, cli["concurrency"].as<uint32_t>());
+    const uint32_t grpcPort = cli["port"].as<uint32_t>();
+    const uint32_t restPort = cli["rest_port"].as<uint32_t>();
+
+    ovms::ServerSettingsImpl serverSettings;
+    serverSettings.grpcPort = grpcPort;
+    serverSettings.restPort = restPort;
+    serverSettings.grpcBindAddress = "127.0.0.1";
+    serverSettings.restBindAddress = "127.0.0.1";
+    serverSettings.grpcWorkers = cli["grpc_workers"].as<uint32_t>();
+    if (cli.count("rest_workers")) {
+        serverSettings.restWorkers = cli["rest_workers"].as<uint32_t>();
+    }
+    serverSettings.logLevel = cli["log_level"].as<std::string>();
+    ovms::ModelsSettingsImpl modelsSettings;
+    modelsSettings.configPath = cli["config_path"].as<std::string>();
+
+    auto& server = ovms::Server::instance();
+    auto status = server.start(&serverSettings, &modelsSettings);
+    if (!status.ok() || !waitForServerReady(server)) {
+        std::cerr << "Failed to start server: " << status.string() << std::endl;
+        server.shutdownModules();
+        return EX_SOFTWARE;
+    }
+    const auto& modelManager = dynamic_cast<const ovms::ServableManagerModule*>(server.getModule(ovms::SERVABLE_MANAGER_MODULE_NAME))->getServableManager();
+
+    std::vector<FrontendResult> results;
+    for (auto frontend : frontends) {
+        FrontendResult result{frontend};
+        const uint64_t stageNiter = cli["stage_niter"].as<uint64_t>();
+        std::shared_ptr<ovms::ModelInstance> instance;
+        std::unique_ptr<ovms::ModelInstanceUnloadGuard> unloadGuard;
+        if (stageNiter > 0 && modelManager.getModelInstance(payload.servableName, payload.servableVersion, instance, unloadGuard).ok()) {
+            StageHistograms stages;
+            for (uint64_t i = 0; i < stageNiter; ++i) {
+                status = replayStages(frontend, *instance, payload, stages);
+                if (!status.ok()) {
+                    std::cerr << "Stages replay failed for frontend: " << toString(frontend) << "; " << status.string() << std::endl;
+                    break;
+                }
+            }
+            if (status.ok()) {
+                result.stages = std::move(stages);
+            }
+        } else if (stageNiter > 0) {
+            std::cout << "Stages breakdown is available for models only, servable: " << payload.servableName << std::endl;
+        }
+        unloadGuard.reset();
+        try {
+            result.loopback = runLoopback(frontend, grpcPort, restPort, payload, concurrency, cli["niter"].as<uint64_t>(), cli["warmup_niter"].as<uint64_t>());
+        } catch (const std::exception& e) {
+            std::cerr << "Loopback benchmark of frontend: " << toString(frontend) << " failed: " << e.what() << std::endl;
+            server.shutdownModules();
+            return EX_SOFTWARE;
+        }
+        printResult(result, concurrency);
+        results.push_back(std::move(result));
+    }
+
+    if (cli.count("output")) {
+        std::ofstream output(cli["output"].as<std::string>());
+        output << resultsToJson(cli["label"].as<std::string>(), payload, concurrency, results) << std::endl;
+        std::cout << "Results saved to: " << cli["output"].as<std::string>() << std::endl;
+    }
+    server.shutdownModules();
+    return 0;
+}
@@ -0,0 +1,92 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "latency_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ovms {
+namespace benchmark {
+
+namespace {
+// Values below SUB_BUCKET_COUNT have own buckets, each further power of 2 range is split into SUB_BUCKET_HALF_COUNT buckets
+constexpr uint32_t SUB_BUCKET_BITS = 11;
+constexpr uint64_t SUB_BUCKET_COUNT = 1ULL << SUB_BUCKET_BITS;
+constexpr uint64_t SUB_BUCKET_HALF_COUNT = SUB_BUCKET_COUNT / 2;
+constexpr uint32_t MAGNITUDES = 64 - SUB_BUCKET_BITS + 1;
+}  // namespace
+
+LatencyHistogram::LatencyHistogram() :
+    counts(SUB_BUCKET_COUNT + (MAGNITUDES - 1) * SUB_BUCKET_HALF_COUNT, 0) {}
+
+size_t LatencyHistogram::getIndex(uint64_t value) {
+    if (value < SUB_BUCKET_COUNT) {
+        return value;
+    }
+    // Shift moves value into [SUB_BUCKET_HALF_COUNT, SUB_BUCKET_COUNT) range
+    const uint32_t shift = (63 - __builtin_clzll(value)) - (SUB_BUCKET_BITS - 1);
+    return SUB_BUCKET_COUNT + (shift - 1) * SUB_BUCKET_HALF_COUNT + ((value >> shift) - SUB_BUCKET_HALF_COUNT);
+}
+
+uint64_t LatencyHistogram::getHighestEquivalentValue(size_t index) {
+    if (index < SUB_BUCKET_COUNT) {
+        return index;
+    }
+    const uint64_t shift = (index - SUB_BUCKET_COUNT) / SUB_BUCKET_HALF_COUNT + 1;
+    const uint64_t subBucket = (index - SUB_BUCKET_COUNT) % SUB_BUCKET_HALF_COUNT + SUB_BUCKET_HALF_COUNT;
+    return ((subBucket + 1) << shift) - 1;
+}
+
+void LatencyHistogram::record(uint64_t valueUs) {
+    counts[getIndex(valueUs)]++;
+    count++;
+    min = std::min(min, valueUs);
+    max = std::max(max, valueUs);
+    sum += valueUs;
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    for (size_t i = 0; i < counts.size(); ++i) {
+        counts[i] += other.counts[i];
+    }
+    count += other.count;
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+    sum += other.sum;
+}
+
+double LatencyHistogram::getMean() const {
+    return count ? static_cast<double>(sum) / static_cast<double>(count) : 0.0;
+}
+
+uint64_t LatencyHistogram::getValueAtPercentile(double percentile) const {
+    if (count == 0) {
+        return 0;
+    }
+    percentile = std::clamp(percentile, 0.0, 100.0);
+    const uint64_t target = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(percentile / 100.0 * count)));
+    uint64_t accumulated = 0;
+    for (size_t i = 0; i < counts.size(); ++i) {
+        accumulated += counts[i];
+        if (accumulated >= target) {
+            return std::min(getHighestEquivalentValue(i), max);
+        }
+    }
+    return max;
+}
+
+}  // namespace benchmark
+}  // namespace ovms
@@ -0,0 +1,61 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ovms {
+namespace benchmark {
+
+/**
+ * @brief Log-linear histogram of latencies in microseconds, following HdrHistogram bucketing.
+ * Values below 2048 are recorded exactly, larger ones with relative error below 0.1%.
+ */
+class LatencyHistogram {
+public:
+    LatencyHistogram();
+
+    void record(uint64_t valueUs);
+
+    void merge(const LatencyHistogram& other);
+
+    uint64_t getCount() const { return count; }
+    uint64_t getMin() const { return count ? min : 0; }
+    uint64_t getMax() const { return max; }
+    double getMean() const;
+
+    /**
+     * @brief Value below which given percent of recorded values falls, reported as the highest value equivalent to bucket
+     *
+     * @param percentile in range [0, 100]
+     */
+    uint64_t getValueAtPercentile(double percentile) const;
+
+private:
+    static size_t getIndex(uint64_t value);
+    static uint64_t getHighestEquivalentValue(size_t index);
+
+    std::vector<uint64_t> counts;
+    uint64_t count = 0;
+    uint64_t min = UINT64_MAX;
+    uint64_t max = 0;
+    long double sum = 0;
+};
+
+}  // namespace benchmark
+}  // namespace ovms
@@ -0,0 +1,448 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+// Microbenchmarks of request deserialization, response serialization and tensor conversion of TFS, KFS and C-API
+// frontends, together with REST JSON building, across tensor sizes and precisions. Benchmarks do not load any model,
+// so they measure only the conversion code. Results are printed in Google Benchmark JSON format unless other format
+// is requested, so that they can be stored and compared between builds, e.g.:
+//   bazel run -c opt //src:serialization_benchmark -- --benchmark_out=results.json --benchmark_out_format=json --benchmark_repetitions=5
+// Benchmark names are stable: <frontend>_<operation>/<variant>/<precision>/<elements count, batch or image side>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <openvino/openvino.hpp>
+#include <opencv2/opencv.hpp>
+#include <spdlog/spdlog.h>
+#include <sysexits.h>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wall"
+#include "tensorflow_serving/apis/prediction_service.grpc.pb.h"
+#pragma GCC diagnostic pop
+
+#include "../capi_frontend/capi_utils.hpp"
+#include "../capi_frontend/inferencerequest.hpp"
+#include "../capi_frontend/inferenceresponse.hpp"
+#include "../deserialization.hpp"
+#include "../kfs_frontend/kfs_grpc_inference_service.hpp"
+#include "../kfs_frontend/kfs_utils.hpp"
+#include "../layout.hpp"
+#include "../precision.hpp"
+#include "../rest_parser.hpp"
+#include "../rest_utils.hpp"
+#include "../serialization.hpp"
+#include "../shape.hpp"
+#include "../status.hpp"
+#include "../tensor_conversion.hpp"
+#include "../tensorinfo.hpp"
+#include "../tfs_frontend/tfs_utils.hpp"
+
+namespace ovms {
+// Tensors passed between frontend conversions and the benchmark instead of OpenVINO infer request
+struct BenchmarkTensors {
+    std::map<std::string, ov::Tensor> tensors;
+};
+
+template <>
+Status InputSink<BenchmarkTensors&>::give(const std::string& name, ov::Tensor& tensor) {
+    requester.tensors[name] = tensor;
+    return StatusCode::OK;
+}
+
+template <>
+Status OutputGetter<BenchmarkTensors&>::get(const std::string& name, ov::Tensor& tensor) {
+    auto it = outputSource.tensors.find(name);
+    if (it == outputSource.tensors.end()) {
+        return StatusCode::INTERNAL_ERROR;
+    }
+    tensor = it->second;
+    return StatusCode::OK;
+}
+}  // namespace ovms
+
+using namespace ovms;
+
+namespace {
+const std::string SERVABLE_NAME = "benchmark";
+const model_version_t SERVABLE_VERSION = 1;
+const std::string INPUT_NAME = "input";
+const std::string OUTPUT_NAME = "output";
+const size_t STRING_LENGTH = 64;
+
+const std::vector<Precision> NUMERIC_PRECISIONS{Precision::FP32, Precision::FP16, Precision::I32, Precision::U8};
+const std::vector<int64_t> ELEMENTS_COUNTS{1 << 8, 1 << 12, 1 << 16, 1 << 20};
+const std::vector<int64_t> STRING_BATCHES{1, 64, 1024};
+const std::vector<int64_t> IMAGE_SIDES{64, 224, 640};
+
+template <typename T>
+void fill(ov::Tensor& tensor, T (*value)(size_t)) {
+    T* data = tensor.data<T>();
+    for (size_t i = 0; i < tensor.get_size(); ++i) {
+        data[i] = value(i);
+    }
+}
+
+// Deterministic data, without NaNs which could not be written to JSON
+ov::Tensor makeTensor(Precision precision, size_t elements) {
+    ov::Tensor tensor(ovmsPrecisionToIE2Precision(precision), ov::Shape{1, elements});
+    switch (precision) {
+    case Precision::FP32:
+        fill<float>(tensor, [](size_t i) { return static_cast<float>(i % 1000) * 0.25f; });
+        break;
+    case Precision::FP16:
+        fill<ov::float16>(tensor, [](size_t i) { return ov::float16(static_cast<float>(i % 1000) * 0.25f); });
+        break;
+    case Precision::I32:
+        fill<int32_t>(tensor, [](size_t i) { return static_cast<int32_t>(i % 100000) - 50000; });
+        break;
+    case Precision::U8:
+        fill<uint8_t>(tensor, [](size_t i) { return static_cast<uint8_t>(i % 251); });
+        break;
+    default:
+        std::memset(tensor.data(), 0, tensor.get_byte_size());
+    }
+    return tensor;
+}
+
+tensor_map_t makeTensorsInfo(const std::string& name, Precision precision, size_t elements) {
+    return {{name, std::make_shared<const TensorInfo>(name, precision, shape_t{1, elements})}};
+}
+
+void setBytesProcessed(benchmark::State& state, size_t bytes) {
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(bytes));
+}
+
+void prepareTFSRequest(tensorflow::serving::PredictRequest& request, const ov::Tensor& tensor, Precision precision) {
+    auto& proto = (*request.mutable_inputs())[INPUT_NAME];
+    proto.set_dtype(getPrecisionAsDataType(precision));
+    for (const auto dim : tensor.get_shape()) {
+        proto.mutable_tensor_shape()->add_dim()->set_size(dim);
+    }
+    if (precision == Precision::FP16) {
+        // TFS sends FP16 in half_val field, zero padded to 32 bits
+        const uint16_t* data = reinterpret_cast<const uint16_t*>(tensor.data());
+        for (size_t i = 0; i < tensor.get_size(); ++i) {
+            proto.add_half_val(data[i]);
+        }
+    } else {
+        proto.mutable_tensor_content()->assign(reinterpret_cast<const char*>(tensor.data()), tensor.get_byte_size());
+    }
+}
+
+void prepareKFSRequest(::KFSRequest& request, const ov::Tensor& tensor, Precision precision, bool rawInputContents) {
+    auto* input = request.add_inputs();
+    input->set_name(INPUT_NAME);
+    input->set_datatype(ovmsPrecisionToKFSPrecision(precision));
+    for (const auto dim : tensor.get_shape()) {
+        input->add_shape(dim);
+    }
+    if (rawInputContents) {
+        request.add_raw_input_contents()->assign(reinterpret_cast<const char*>(tensor.data()), tensor.get_byte_size());
+        return;
+    }
+    const float* data = tensor.data<float>();
+    for (size_t i = 0; i < tensor.get_size(); ++i) {
+        input->mutable_contents()->add_fp32_contents(data[i]);
+    }
+}
+
+template <typename RequestType>
+void deserialize(benchmark::State& state, const RequestType& request, const tensor_map_t& inputsInfo, size_t bytes) {
+    for (auto _ : state) {
+        BenchmarkTensors tensors;
+        InputSink<BenchmarkTensors&> inputSink(tensors);
+        auto status = deserializePredictRequest<ConcreteTensorProtoDeserializator>(request, inputsInfo, inputSink, false);
+        if (!status.ok()) {
+            state.SkipWithError(status.string().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(tensors);
+    }
+    setBytesProcessed(state, bytes);
+}
+
+void tfsDeserializePredictRequest(benchmark::State& state, Precision precision) {
+    const size_t elements = state.range(0);
+    const auto tensor = makeTensor(precision, elements);
+    tensorflow::serving::PredictRequest request;
+    prepareTFSRequest(request, tensor, precision);
+    deserialize(state, request, makeTensorsInfo(INPUT_NAME, precision, elements), tensor.get_byte_size());
+}
+
+void kfsDeserializePredictRequest(benchmark::State& state, Precision precision, bool rawInputContents) {
+    const size_t elements = state.range(0);
+    const auto tensor = makeTensor(precision, elements);
+    ::KFSRequest request;
+    prepareKFSRequest(request, tensor, precision, rawInputContents);
+    deserialize(state, request, makeTensorsInfo(INPUT_NAME, precision, elements), tensor.get_byte_size());
+}
+
+void capiDeserializePredictRequest(benchmark::State& state, Precision precision) {
+    const size_t elements = state.range(0);
+    const auto tensor = makeTensor(precision, elements);
+    InferenceRequest request(SERVABLE_NAME.c_str(), SERVABLE_VERSION);
+    const int64_t shape[] = {1, static_cast<int64_t>(elements)};
+    auto status = request.addInput(INPUT_NAME.c_str(), getPrecisionAsOVMSDataType(precision), shape, 2);
+    if (status.ok()) {
+        status = request.setInputBuffer(INPUT_NAME.c_str(), tensor.data(), tensor.get_byte_size(), OVMS_BUFFERTYPE_CPU, std::nullopt);
+    }
+    if (!status.ok()) {
+        state.SkipWithError(status.string().c_str());
+        return;
+    }
+    deserialize(state, request, makeTensorsInfo(INPUT_NAME, precision, elements), tensor.get_byte_size());
+}
+
+template <typename ResponseType, typename... ResponseArgs>
+void serialize(benchmark::State& state, Precision precision, bool useSharedOutputContent, ResponseArgs... responseArgs) {
+    const size_t elements = state.range(0);
+    BenchmarkTensors outputs;
+    outputs.tensors[OUTPUT_NAME] = makeTensor(precision, elements);
+    OutputGetter<BenchmarkTensors&> outputGetter(outputs);
+    const auto outputsInfo = makeTensorsInfo(OUTPUT_NAME, precision, elements);
+    for (auto _ : state) {
+        ResponseType response(responseArgs...);
+        auto status = serializePredictResponse(outputGetter, SERVABLE_NAME, SERVABLE_VERSION, outputsInfo, &response, getTensorInfoName, useSharedOutputContent);
+        if (!status.ok()) {
+            state.SkipWithError(status.string().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(response);
+    }
+    setBytesProcessed(state, outputs.tensors[OUTPUT_NAME].get_byte_size());
+}
+
+void tfsSerializePredictResponse(benchmark::State& state, Precision precision) {
+    serialize<tensorflow::serving::PredictResponse>(state, precision, false);
+}
+
+void kfsSerializePredictResponse(benchmark::State& state, Precision precision, bool useSharedOutputContent) {
+    serialize<::KFSResponse>(state, precision, useSharedOutputContent);
+}
+
+void capiSerializePredictResponse(benchmark::State& state, Precision precision) {
+    serialize<InferenceResponse>(state, precision, false, SERVABLE_NAME, SERVABLE_VERSION);
+}
+
+std::string encodeImage(const std::string& extension, int side) {
+    cv::Mat image(side, side, CV_8UC3);
+    for (int row = 0; row < side; ++row) {
+        for (int col = 0; col < side; ++col) {
+            image.at<cv::Vec3b>(row, col) = cv::Vec3b(row % 256, col % 256, (row + col) % 256);
+        }
+    }
+    std::vector<uchar> encoded;
+    cv::imencode(extension, image, encoded);
+    return std::string(encoded.begin(), encoded.end());
+}
+
+template <typename TensorType>
+void convertNativeFileFormat(benchmark::State& state, const TensorType& requestTensor, int side) {
+    auto tensorInfo = std::make_shared<const TensorInfo>(INPUT_NAME, Precision::U8, Shape{1, side, side, 3}, Layout{"NHWC"});
+    for (auto _ : state) {
+        ov::Tensor tensor;
+        auto status = convertNativeFileFormatRequestTensorToOVTensor(requestTensor, tensor, tensorInfo, nullptr);
+        if (!status.ok()) {
+            state.SkipWithError(status.string().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(tensor);
+    }
+    setBytesProcessed(state, static_cast<size_t>(side) * side * 3);
+}
+
+void tfsConvertNativeFileFormat(benchmark::State& state, const std::string& extension) {
+    const int side = state.range(0);
+    tensorflow::TensorProto requestTensor;
+    requestTensor.set_dtype(tensorflow::DataType::DT_STRING);
+    requestTensor.mutable_tensor_shape()->add_dim()->set_size(1);
+    requestTensor.add_string_val(encodeImage(extension, side));
+    convertNativeFileFormat(state, requestTensor, side);
+}
+
+void kfsConvertNativeFileFormat(benchmark::State& state, const std::string& extension) {
+    const int side = state.range(0);
+    ::KFSRequest::InferInputTensor requestTensor;
+    requestTensor.set_name(INPUT_NAME);
+    requestTensor.set_datatype("BYTES");
+    requestTensor.add_shape(1);
+    requestTensor.mutable_contents()->add_bytes_contents(encodeImage(extension, side));
+    convertNativeFileFormat(state, requestTensor, side);
+}
+
+void prepareStrings(tensorflow::TensorProto& requestTensor, size_t batch) {
+    requestTensor.set_dtype(tensorflow::DataType::DT_STRING);
+    requestTensor.mutable_tensor_shape()->add_dim()->set_size(batch);
+    for (size_t i = 0; i < batch; ++i) {
+        // Strings of different lengths, 2D conversion pads them to the longest one
+        requestTensor.add_string_val(std::string(STRING_LENGTH - i % (STRING_LENGTH / 2), 'a' + i % 26));
+    }
+}
+
+void tfsConvertStringRequest(benchmark::State& state, bool twoDimensional) {
+    const size_t batch = state.range(0);
+    tensorflow::TensorProto requestTensor;
+    prepareStrings(requestTensor, batch);
+    for (auto _ : state) {
+        ov::Tensor tensor;
+        auto status = twoDimensional ? convertStringRequestToOVTensor2D(requestTensor, tensor, nullptr) : convertStringRequestToOVTensor1D(requestTensor, tensor, nullptr);
+        if (!status.ok()) {
+            state.SkipWithError(status.string().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(tensor);
+    }
+    setBytesProcessed(state, batch * STRING_LENGTH);
+}
+
+void tfsConvertStringResponse(benchmark::State& state) {
+    const size_t batch = state.range(0);
+    tensorflow::TensorProto requestTensor;
+    prepareStrings(requestTensor, batch);
+    ov::Tensor tensor;
+    auto status = convertStringRequestToOVTensor2D(requestTensor, tensor, nullptr);
+    if (!status.ok()) {
+        state.SkipWithError(status.string().c_str());
+        return;
+    }
+    for (auto _ : state) {
+        tensorflow::TensorProto responseTensor;
+        status = convertOVTensor2DToStringResponse(tensor, responseTensor);
+        if (!status.ok()) {
+            state.SkipWithError(status.string().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(responseTensor);
+    }
+    setBytesProcessed(state, tensor.get_byte_size());
+}
+
+void tfsMakeJsonFromPredictResponse(benchmark::State& state, Precision precision, Order order) {
+    const size_t elements = state.range(0);
+    BenchmarkTensors outputs;
+    outputs.tensors[OUTPUT_NAME] = makeTensor(precision, elements);
+    OutputGetter<BenchmarkTensors&> outputGetter(outputs);
+    tensorflow::serving::PredictResponse serializedResponse;
+    auto status = serializePredictResponse(outputGetter, SERVABLE_NAME, SERVABLE_VERSION, makeTensorsInfo(OUTPUT_NAME, precision, elements), &serializedResponse, getTensorInfoName);
+    if (!status.ok()) {
+        state.SkipWithError(status.string().c_str());
+        return;
+    }
+    for (auto _ : state) {
+        // JSON conversion fills value fields of the response, so each iteration starts from serialized response
+        state.PauseTiming();
+        tensorflow::serving::PredictResponse response = serializedResponse;
+        state.ResumeTiming();
+        std::string json;
+        status = makeJsonFromPredictResponse(response, &json, order);
+        if (!status.ok()) {
+            state.SkipWithError(status.string().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(json);
+    }
+    setBytesProcessed(state, outputs.tensors[OUTPUT_NAME].get_byte_size());
+}
+
+void kfsMakeJsonFromPredictResponse(benchmark::State& state, Precision precision, bool binaryOutput) {
+    const size_t elements = state.range(0);
+    BenchmarkTensors outputs;
+    outputs.tensors[OUTPUT_NAME] = makeTensor(precision, elements);
+    OutputGetter<BenchmarkTensors&> outputGetter(outputs);
+    ::KFSResponse response;
+    auto status = serializePredictResponse(outputGetter, SERVABLE_NAME, SERVABLE_VERSION, makeTensorsInfo(OUTPUT_NAME, precision, elements), &response, getTensorInfoName);
+    if (!status.ok()) {
+        state.SkipWithError(status.string().c_str());
+        return;
+    }
+    const std::set<std::string> binaryOutputsNames = binaryOutput ? std::set<std::string>{OUTPUT_NAME} : std::set<std::string>{};
+    for (auto _ : state) {
+        std::string json;
+        std::optional<int> inferenceHeaderContentLength;
+        status = makeJsonFromPredictResponse(response, &json, inferenceHeaderContentLength, binaryOutputsNames);
+        if (!status.ok()) {
+            state.SkipWithError(status.string().c_str());
+            break;
+        }
+        benchmark::DoNotOptimize(json);
+    }
+    setBytesProcessed(state, outputs.tensors[OUTPUT_NAME].get_byte_size());
+}
+
+template <typename Function>
+void registerBenchmark(const std::string& name, Function function, const std::vector<int64_t>& args) {
+    auto* registered = benchmark::RegisterBenchmark(name.c_str(), function);
+    for (const auto arg : args) {
+        registered->Arg(arg);
+    }
+    registered->Unit(benchmark::kMicrosecond);
+}
+
+void registerBenchmarks() {
+    for (const auto precision : NUMERIC_PRECISIONS) {
+        const std::string precisionName = toString(precision);
+        registerBenchmark("TFS_DeserializePredictRequest/" + precisionName, [precision](benchmark::State& state) { tfsDeserializePredictRequest(state, precision); }, ELEMENTS_COUNTS);
+        registerBenchmark("KFS_DeserializePredictRequest/raw/" + precisionName, [precision](benchmark::State& state) { kfsDeserializePredictRequest(state, precision, true); }, ELEMENTS_COUNTS);
+        registerBenchmark("CAPI_DeserializePredictRequest/" + precisionName, [precision](benchmark::State& state) { capiDeserializePredictRequest(state, precision); }, ELEMENTS_COUNTS);
+        registerBenchmark("TFS_SerializePredictResponse/" + precisionName, [precision](benchmark::State& state) { tfsSerializePredictResponse(state, precision); }, ELEMENTS_COUNTS);
+        registerBenchmark("KFS_SerializePredictResponse/raw/" + precisionName, [precision](benchmark::State& state) { kfsSerializePredictResponse(state, precision, true); }, ELEMENTS_COUNTS);
+        registerBenchmark("CAPI_SerializePredictResponse/" + precisionName, [precision](benchmark::State& state) { capiSerializePredictResponse(state, precision); }, ELEMENTS_COUNTS);
+        registerBenchmark("TFS_MakeJsonFromPredictResponse/row/" + precisionName, [precision](benchmark::State& state) { tfsMakeJsonFromPredictResponse(state, precision, Order::ROW); }, ELEMENTS_COUNTS);
+        registerBenchmark("TFS_MakeJsonFromPredictResponse/column/" + precisionName, [precision](benchmark::State& state) { tfsMakeJsonFromPredictResponse(state, precision, Order::COLUMN); }, ELEMENTS_COUNTS);
+        registerBenchmark("KFS_MakeJsonFromPredictResponse/json/" + precisionName, [precision](benchmark::State& state) { kfsMakeJsonFromPredictResponse(state, precision, false); }, ELEMENTS_COUNTS);
+        registerBenchmark("KFS_MakeJsonFromPredictResponse/binary/" + precisionName, [precision](benchmark::State& state) { kfsMakeJsonFromPredictResponse(state, precision, true); }, ELEMENTS_COUNTS);
+    }
+    // Typed contents fields are used by clients which do not send raw buffers
+    registerBenchmark("KFS_DeserializePredictRequest/contents/FP32", [](benchmark::State& state) { kfsDeserializePredictRequest(state, Precision::FP32, false); }, ELEMENTS_COUNTS);
+    registerBenchmark("KFS_SerializePredictResponse/contents/FP32", [](benchmark::State& state) { kfsSerializePredictResponse(state, Precision::FP32, false); }, ELEMENTS_COUNTS);
+    for (const std::string format : {"jpeg", "png"}) {
+        const std::string extension = "." + format;
+        registerBenchmark("TFS_ConvertNativeFileFormat/" + format, [extension](benchmark::State& state) { tfsConvertNativeFileFormat(state, extension); }, IMAGE_SIDES);
+        registerBenchmark("KFS_ConvertNativeFileFormat/" + format, [extension](benchmark::State& state) { kfsConvertNativeFileFormat(state, extension); }, IMAGE_SIDES);
+    }
+    registerBenchmark("TFS_ConvertStringRequest/1D", [](benchmark::State& state) { tfsConvertStringRequest(state, false); }, STRING_BATCHES);
+    registerBenchmark("TFS_ConvertStringRequest/2D", [](benchmark::State& state) { tfsConvertStringRequest(state, true); }, STRING_BATCHES);
+    registerBenchmark("TFS_ConvertStringResponse/2D", [](benchmark::State& state) { tfsConvertStringResponse(state); }, STRING_BATCHES);
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+    // Debug logs of conversions would dominate measured time
+    spdlog::set_level(spdlog::level::err);
+    std::vector<char*> args(argv, argv + argc);
+    std::string jsonFormat = "--benchmark_format=json";
+    const bool formatRequested = std::any_of(args.begin(), args.end(), [](const char* arg) { return std::strncmp(arg, "--benchmark_format", std::strlen("--benchmark_format")) == 0; });
+    if (!formatRequested) {
+        args.insert(args.begin() + 1, jsonFormat.data());
+    }
+    int argsCount = static_cast<int>(args.size());
+    registerBenchmarks();
+    benchmark::Initialize(&argsCount, args.data());
+    if (benchmark::ReportUnrecognizedArguments(argsCount, args.data())) {
+        return EX_USAGE;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    return EXIT_SUCCESS;
+}
@@ -38,6 +38,9 @@ PYBIND11_MODULE(pyovms, m) {
         .def_static("create_from_data", [](const std::string& name, void* ptr, const std::vector<py::ssize_t>& shape, const std::string& datatype, py::ssize_t size, bool copy) {
             return std::make_unique<OvmsPyTensor>(name, ptr, shape, datatype, size, copy);
         })
+        .def_static("create_from_buffer", [](const std::string& name, const py::buffer& buffer, const std::string& datatype, const std::vector<py::ssize_t>& shape, const std::string& format, const std::vector<py::ssize_t>& bufferShape, py::ssize_t itemsize) {
+            return std::make_unique<OvmsPyTensor>(name, buffer, datatype, shape, format, bufferShape, itemsize);
+        })
         .def_readonly("name", &OvmsPyTensor::name)
         .def_readonly("ptr", &OvmsPyTensor::ptr)
         .def_readonly("size", &OvmsPyTensor::size)
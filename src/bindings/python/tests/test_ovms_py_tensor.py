@@ -58,3 +58,21 @@ def test_creating_from_python_bytes():
     assert ovms_py_tensor.data.itemsize == 1
     assert ovms_py_tensor.data.strides == (1,)
     assert ovms_py_tensor.data.tobytes() == data
+
+def test_creating_from_buffer_keeps_tensor_metadata():
+    npy_arr = np.array(["batch", "of", "strings"])
+    data = bytearray(npy_arr.tobytes())
+    ovms_py_tensor = Tensor.create_from_buffer("input", data, "CUSTOM", [3], npy_arr.data.format, list(npy_arr.shape), npy_arr.itemsize)
+    assert ovms_py_tensor.name == "input"
+    assert ovms_py_tensor.datatype == "CUSTOM"
+    assert ovms_py_tensor.shape == (3,)
+    assert ovms_py_tensor.data.format == npy_arr.data.format
+    assert ovms_py_tensor.data.strides == npy_arr.data.strides
+    assert ovms_py_tensor.data.tobytes() == npy_arr.tobytes()
+    # Tensor does not copy the buffer
+    data[0] = ord("B")
+    assert ovms_py_tensor.data.tobytes()[0] == ord("B")
+
+def test_creating_from_buffer_of_wrong_size():
+    with pytest.raises(ValueError):
+        Tensor.create_from_buffer("input", bytes(10), "FP32", [1, 3], "f", [1, 3], 4)
@@ -0,0 +1,68 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "bounded_executor.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace ovms {
+
+BoundedExecutor::BoundedExecutor(size_t threadsCount, size_t queueCapacity) :
+    queueCapacity(std::max<size_t>(queueCapacity, 1)) {
+    threadsCount = std::max<size_t>(threadsCount, 1);
+    threads.reserve(threadsCount);
+    for (size_t i = 0; i < threadsCount; ++i) {
+        threads.emplace_back(&BoundedExecutor::run, this);
+    }
+}
+
+BoundedExecutor::~BoundedExecutor() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        stopped = true;
+    }
+    taskAvailable.notify_all();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+void BoundedExecutor::submit(std::function<void()> task) {
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        spaceAvailable.wait(lock, [this]() { return tasks.size() < queueCapacity; });
+        tasks.push(std::move(task));
+    }
+    taskAvailable.notify_one();
+}
+
+void BoundedExecutor::run() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            taskAvailable.wait(lock, [this]() { return stopped || !tasks.empty(); });
+            if (tasks.empty()) {
+                return;
+            }
+            task = std::move(tasks.front());
+            tasks.pop();
+        }
+        spaceAvailable.notify_one();
+        task();
+    }
+}
+}  // namespace ovms
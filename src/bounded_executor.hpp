@@ -0,0 +1,52 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace ovms {
+
+/**
+ * @brief Fixed number of threads executing tasks from a bounded queue.
+ * Submitting a task blocks while the queue is full, so producers are throttled instead of queueing unbounded work.
+ * Tasks queued before destruction are executed before threads are joined.
+ */
+class BoundedExecutor {
+    const size_t queueCapacity;
+    std::mutex mtx;
+    std::condition_variable taskAvailable;
+    std::condition_variable spaceAvailable;
+    std::queue<std::function<void()>> tasks;
+    bool stopped = false;
+    std::vector<std::thread> threads;
+
+    void run();
+
+public:
+    BoundedExecutor(size_t threadsCount, size_t queueCapacity);
+    ~BoundedExecutor();
+    BoundedExecutor(const BoundedExecutor&) = delete;
+    BoundedExecutor& operator=(const BoundedExecutor&) = delete;
+
+    void submit(std::function<void()> task);
+    size_t getThreadsCount() const { return threads.size(); }
+};
+}  // namespace ovms
@@ -70,6 +70,7 @@ using ovms::Server;
 using ovms::Status;
 using ovms::StatusCode;
 using ovms::Timer;
+using ovms::TraceRequestGuard;
 using std::chrono::microseconds;
 
 #ifdef __cplusplus
@@ -388,6 +389,16 @@ DLL_PUBLIC OVMS_Status* OVMS_ServerSettingsSetFileSystemPollWaitSeconds(OVMS_Ser
     return nullptr;
 }
 
+DLL_PUBLIC OVMS_Status* OVMS_ServerSettingsSetFileSystemEventsEnabled(OVMS_ServerSettings* settings,
+    bool enabled) {
+    if (settings == nullptr) {
+        return reinterpret_cast<OVMS_Status*>(new Status(StatusCode::NONEXISTENT_PTR, "server settings"));
+    }
+    ovms::ServerSettingsImpl* serverSettings = reinterpret_cast<ovms::ServerSettingsImpl*>(settings);
+    serverSettings->filesystemEventsEnabled = enabled;
+    return nullptr;
+}
+
 DLL_PUBLIC OVMS_Status* OVMS_ServerSettingsSetSequenceCleanerPollWaitMinutes(OVMS_ServerSettings* settings,
     uint32_t minutes) {
     if (settings == nullptr) {
@@ -408,6 +419,26 @@ DLL_PUBLIC OVMS_Status* OVMS_ServerSettingsSetCustomNodeResourcesCleanerInterval
     return nullptr;
 }
 
+DLL_PUBLIC OVMS_Status* OVMS_ServerSettingsSetModelLoadingThreads(OVMS_ServerSettings* settings,
+    uint32_t threads) {
+    if (settings == nullptr) {
+        return reinterpret_cast<OVMS_Status*>(new Status(StatusCode::NONEXISTENT_PTR, "server settings"));
+    }
+    ovms::ServerSettingsImpl* serverSettings = reinterpret_cast<ovms::ServerSettingsImpl*>(settings);
+    serverSettings->modelLoadingThreads = threads;
+    return nullptr;
+}
+
+DLL_PUBLIC OVMS_Status* OVMS_ServerSettingsSetModelLoadingMemoryBudgetMB(OVMS_ServerSettings* settings,
+    uint32_t megabytes) {
+    if (settings == nullptr) {
+        return reinterpret_cast<OVMS_Status*>(new Status(StatusCode::NONEXISTENT_PTR, "server settings"));
+    }
+    ovms::ServerSettingsImpl* serverSettings = reinterpret_cast<ovms::ServerSettingsImpl*>(settings);
+    serverSettings->modelLoadingMemoryBudgetMB = megabytes;
+    return nullptr;
+}
+
 DLL_PUBLIC OVMS_Status* OVMS_ServerSettingsSetCpuExtensionPath(OVMS_ServerSettings* settings,
     const char* cpu_extension_path) {
     if (settings == nullptr) {
@@ -434,6 +465,16 @@ DLL_PUBLIC OVMS_Status* OVMS_ServerSettingsSetCacheDir(OVMS_ServerSettings* sett
     return nullptr;
 }
 
+DLL_PUBLIC OVMS_Status* OVMS_ServerSettingsSetPrecompileStagedVersions(OVMS_ServerSettings* settings,
+    bool enabled) {
+    if (settings == nullptr) {
+        return reinterpret_cast<OVMS_Status*>(new Status(StatusCode::NONEXISTENT_PTR, "server settings"));
+    }
+    ovms::ServerSettingsImpl* serverSettings = reinterpret_cast<ovms::ServerSettingsImpl*>(settings);
+    serverSettings->precompileStagedVersions = enabled;
+    return nullptr;
+}
+
 DLL_PUBLIC OVMS_Status* OVMS_ServerSettingsSetLogLevel(OVMS_ServerSettings* settings,
     OVMS_LogLevel log_level) {
     if (settings == nullptr) {
@@ -819,6 +860,7 @@ static Status getPipelineDefinition(Server& server, const std::string& servableN
 }  // namespace
 
 DLL_PUBLIC OVMS_Status* OVMS_Inference(OVMS_Server* serverPtr, OVMS_InferenceRequest* request, OVMS_InferenceResponse** response) {
+    TraceRequestGuard traceRequestGuard;
     OVMS_PROFILE_FUNCTION();
     using std::chrono::microseconds;
     Timer<TIMER_END> timer;
@@ -36,12 +36,17 @@ struct ServerSettingsImpl {
 #ifdef MTR_ENABLED
     std::string tracePath;
 #endif
+    uint32_t traceSamplingRate = 0;
     std::optional<size_t> grpcMemoryQuota;
     std::string grpcChannelArguments;
     uint32_t filesystemPollWaitSeconds = 1;
+    bool filesystemEventsEnabled = false;
     uint32_t sequenceCleanerPollWaitMinutes = 5;
     uint32_t resourcesCleanerPollWaitSeconds = 1;
+    uint32_t modelLoadingThreads = 1;
+    uint32_t modelLoadingMemoryBudgetMB = 0;
     std::string cacheDir;
+    bool precompileStagedVersions = false;
 };
 
 struct ModelsSettingsImpl {
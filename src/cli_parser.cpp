@@ -79,6 +79,10 @@ void CLIParser::parse(int argc, char** argv) {
                 "Path to the trace file",
                 cxxopts::value<std::string>(), "TRACE_PATH")
 #endif
+            ("trace_sampling_rate",
+                "Trace 1 in N inference requests. Traces from the last seconds are available via /v1/trace REST endpoint. Default is 0 - tracing disabled.",
+                cxxopts::value<uint32_t>()->default_value("0"),
+                "TRACE_SAMPLING_RATE")
             ("grpc_channel_arguments",
                 "A comma separated list of arguments to be passed to the gRPC server. (e.g. grpc.max_connection_age_ms=2000)",
                 cxxopts::value<std::string>(), "GRPC_CHANNEL_ARGUMENTS")
@@ -86,6 +90,10 @@ void CLIParser::parse(int argc, char** argv) {
                 "Time interval between config and model versions changes detection. Default is 1. Zero or negative value disables changes monitoring.",
                 cxxopts::value<uint32_t>()->default_value("1"),
                 "FILE_SYSTEM_POLL_WAIT_SECONDS")
+            ("file_system_events_enable",
+                "Flag enabling detection of config and local model repository changes using filesystem events instead of periodic polling. Models stored in cloud storage are polled with interval growing from file_system_poll_wait_seconds while no changes are detected.",
+                cxxopts::value<bool>()->default_value("false"),
+                "FILE_SYSTEM_EVENTS_ENABLE")
             ("sequence_cleaner_poll_wait_minutes",
                 "Time interval between two consecutive sequence cleanup scans. Default is 5. Zero value disables sequence cleaner. It also sets the schedule for releasing free memory from the heap.",
                 cxxopts::value<uint32_t>()->default_value("5"),
@@ -94,10 +102,22 @@ void CLIParser::parse(int argc, char** argv) {
                 "Time interval between two consecutive resources cleanup scans. Default is 1. Must be greater than 0.",
                 cxxopts::value<uint32_t>()->default_value("1"),
                 "CUSTOM_NODE_RESOURCES_CLEANER_INTERVAL_SECONDS")
+            ("model_loading_threads",
+                "Number of models loaded concurrently at startup and on config reload. Default is 1 - models are loaded one after another.",
+                cxxopts::value<uint32_t>()->default_value("1"),
+                "MODEL_LOADING_THREADS")
+            ("model_loading_memory_budget_mb",
+                "Upper limit for the total size of model files (in megabytes) being loaded concurrently. Default is 0 - no limit. Effective when model_loading_threads > 1.",
+                cxxopts::value<uint32_t>()->default_value("0"),
+                "MODEL_LOADING_MEMORY_BUDGET_MB")
             ("cache_dir",
                 "Overrides model cache directory. By default cache files are saved into /opt/cache if the directory is present. When enabled, first model load will produce cache files.",
                 cxxopts::value<std::string>(),
                 "CACHE_DIR")
+            ("precompile_staged_versions",
+                "Flag enabling background compilation of local model versions newer than the served ones, to populate the model cache before they are served. Effective when model cache is enabled.",
+                cxxopts::value<bool>()->default_value("false"),
+                "PRECOMPILE_STAGED_VERSIONS")
             ("metrics_enable",
                 "Flag enabling metrics endpoint on rest_port.",
                 cxxopts::value<bool>()->default_value("false"),
@@ -269,17 +289,22 @@ void CLIParser::prepare(ServerSettingsImpl* serverSettings, ModelsSettingsImpl*
     if (result->count("trace_path"))
         serverSettings->tracePath = result->operator[]("trace_path").as<std::string>();
 #endif
+    serverSettings->traceSamplingRate = result->operator[]("trace_sampling_rate").as<uint32_t>();
 
     if (result->count("grpc_channel_arguments"))
         serverSettings->grpcChannelArguments = result->operator[]("grpc_channel_arguments").as<std::string>();
 
     serverSettings->filesystemPollWaitSeconds = result->operator[]("file_system_poll_wait_seconds").as<uint32_t>();
+    serverSettings->filesystemEventsEnabled = result->operator[]("file_system_events_enable").as<bool>();
     serverSettings->sequenceCleanerPollWaitMinutes = result->operator[]("sequence_cleaner_poll_wait_minutes").as<uint32_t>();
     serverSettings->resourcesCleanerPollWaitSeconds = result->operator[]("custom_node_resources_cleaner_interval_seconds").as<uint32_t>();
+    serverSettings->modelLoadingThreads = result->operator[]("model_loading_threads").as<uint32_t>();
+    serverSettings->modelLoadingMemoryBudgetMB = result->operator[]("model_loading_memory_budget_mb").as<uint32_t>();
 
     if (result != nullptr && result->count("cache_dir")) {
         serverSettings->cacheDir = result->operator[]("cache_dir").as<std::string>();
     }
+    serverSettings->precompileStagedVersions = result->operator[]("precompile_staged_versions").as<bool>();
 
     if (result->count("config_path"))
         modelsSettings->configPath = result->operator[]("config_path").as<std::string>();
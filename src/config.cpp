@@ -206,10 +206,15 @@ const std::string& Config::logPath() const { return this->serverSettings.logPath
 #ifdef MTR_ENABLED
 const std::string& Config::tracePath() const { return this->serverSettings.tracePath; }
 #endif
+uint32_t Config::traceSamplingRate() const { return this->serverSettings.traceSamplingRate; }
 const std::string& Config::grpcChannelArguments() const { return this->serverSettings.grpcChannelArguments; }
 uint32_t Config::filesystemPollWaitSeconds() const { return this->serverSettings.filesystemPollWaitSeconds; }
+bool Config::filesystemEventsEnabled() const { return this->serverSettings.filesystemEventsEnabled; }
 uint32_t Config::sequenceCleanerPollWaitMinutes() const { return this->serverSettings.sequenceCleanerPollWaitMinutes; }
 uint32_t Config::resourcesCleanerPollWaitSeconds() const { return this->serverSettings.resourcesCleanerPollWaitSeconds; }
+uint32_t Config::modelLoadingThreads() const { return this->serverSettings.modelLoadingThreads; }
+uint32_t Config::modelLoadingMemoryBudgetMB() const { return this->serverSettings.modelLoadingMemoryBudgetMB; }
 const std::string Config::cacheDir() const { return this->serverSettings.cacheDir; }
+bool Config::precompileStagedVersions() const { return this->serverSettings.precompileStagedVersions; }
 
 }  // namespace ovms
@@ -278,6 +278,13 @@ public:
     const std::string& tracePath() const;
 #endif
 
+    /**
+        * @brief Get the request tracing sampling rate
+        *
+        * @return uint32_t
+        */
+    uint32_t traceSamplingRate() const;
+
     /**
         * @brief Get the plugin config
         *
@@ -292,6 +299,13 @@ public:
      */
     uint32_t filesystemPollWaitSeconds() const;
 
+    /**
+     * @brief Get information if filesystem changes are detected using filesystem events
+     * 
+     * @return bool
+     */
+    bool filesystemEventsEnabled() const;
+
     /**
      * @brief Get the sequence cleanup poll wait time in minutes
      * 
@@ -306,11 +320,32 @@ public:
      */
     uint32_t resourcesCleanerPollWaitSeconds() const;
 
+    /**
+     * @brief Get the number of models loaded concurrently
+     * 
+     * @return uint32_t
+     */
+    uint32_t modelLoadingThreads() const;
+
+    /**
+     * @brief Get the limit for total size of model files loaded concurrently in megabytes
+     * 
+     * @return uint32_t
+     */
+    uint32_t modelLoadingMemoryBudgetMB() const;
+
     /**
          * @brief Model cache directory
          * 
          * @return const std::string& 
          */
     const std::string cacheDir() const;
+
+    /**
+         * @brief Get information if staged model versions are compiled in background
+         * 
+         * @return bool
+         */
+    bool precompileStagedVersions() const;
 };
 }  // namespace ovms
@@ -22,6 +22,7 @@
 
 #include "../custom_node_interface.h"  // NOLINT
 #include "../logging.hpp"
+#include "../model_metric_reporter.hpp"
 #include "../profiler.hpp"
 #include "../status.hpp"
 #include "../timer.hpp"
@@ -73,6 +74,9 @@ Status CustomNodeSession::execute(PipelineEventQueue& notifyEndQueue, Node& node
         customNodeLibraryInternalManager);
     OVMS_PROFILE_SYNC_END("Custom Node Library execute()");
     this->timer->stop(EXECUTE);
+    if (node.getMetrics()) {
+        OBSERVE_IF_ENABLED(node.getMetrics()->executionTime, this->timer->elapsed<std::chrono::microseconds>(EXECUTE));
+    }
     SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Custom node execution processing time for node {}; session: {} - {} ms",
         this->getName(),
         this->getSessionKey(),
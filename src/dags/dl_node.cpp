@@ -21,6 +21,7 @@
 #include "../executingstreamidguard.hpp"
 #include "../logging.hpp"
 #include "../metric.hpp"
+#include "../model_metric_reporter.hpp"
 #include "../modelinstance.hpp"
 #include "../modelinstanceunloadguard.hpp"
 #include "../modelmanager.hpp"
@@ -101,6 +102,9 @@ Status DLNode::fetchResults(TensorWithSourceMap& outputs, ov::InferRequest& infe
     }
     double ovInferTime = this->getNodeSession(sessionKey).getTimer().elapsed<std::chrono::microseconds>(EXECUTE);
     OBSERVE_IF_ENABLED(model.getMetricReporter().inferenceTime, ovInferTime);
+    if (this->metrics) {
+        OBSERVE_IF_ENABLED(this->metrics->executionTime, ovInferTime);
+    }
     SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} infer request finished", getName(), sessionKey);
     SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Inference processing time for node {}; model name: {}; session: {} - {} ms",
         this->getName(),
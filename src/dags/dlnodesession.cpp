@@ -20,6 +20,7 @@
 #include <string>
 
 #include "../logging.hpp"
+#include "../model_metric_reporter.hpp"
 #include "../modelinstance.hpp"
 #include "../modelinstanceunloadguard.hpp"
 #include "../modelmanager.hpp"
@@ -29,6 +30,7 @@
 #include "../status.hpp"
 #include "../tensorinfo.hpp"
 #include "../timer.hpp"
+#include "../tracer.hpp"
 #include "nodeinputhandler.hpp"
 #include "nodeoutputhandler.hpp"
 #include "nodestreamidguard.hpp"
@@ -83,8 +85,13 @@ Status DLNodeSession::requestExecuteRequiredResources() {
     if (!status.ok()) {
         return status;
     }
+    status = model->admitRequest(model->getInferRequestsQueue());
+    if (!status.ok()) {
+        SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} request rejected by model: {} admission control", getName(), getSessionKey(), getModelName());
+        return status;
+    }
     this->timer->start(GET_INFER_REQUEST);
-    this->nodeStreamIdGuard = std::make_unique<NodeStreamIdGuard>(model->getInferRequestsQueue(), model->getMetricReporter());
+    this->nodeStreamIdGuard = std::make_unique<NodeStreamIdGuard>(model->getInferRequestsQueue(), model->getMetricReporter(), model->getDefaultPriority());
     return status;
 }
 
@@ -221,6 +228,10 @@ Status DLNodeSession::execute(PipelineEventQueue& notifyEndQueue, uint waitForSt
     this->timer->stop(GET_INFER_REQUEST);
     double getInferRequestTime = this->timer->elapsed<std::chrono::microseconds>(GET_INFER_REQUEST);
     OBSERVE_IF_ENABLED(this->model->getMetricReporter().waitForInferReqTime, getInferRequestTime);
+    OBSERVE_IF_ENABLED(this->model->getMetricReporter().getWaitForInferReqTimeMetric(this->model->getDefaultPriority()), getInferRequestTime);
+    if (node.getMetrics()) {
+        OBSERVE_IF_ENABLED(node.getMetrics()->waitForInferReqTime, getInferRequestTime);
+    }
     status = setInputsForInference(inferRequest);
     if (!status.ok()) {
         notifyEndQueue.push({node, getSessionKey()});
@@ -278,7 +289,8 @@ Status DLNodeSession::executeInference(PipelineEventQueue& notifyEndQueue, ov::I
     OVMS_PROFILE_FUNCTION();
     try {
         SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Setting completion callback for node name: {}", this->getName());
-        inferRequest.set_callback([this, &notifyEndQueue, &inferRequest, &node](std::exception_ptr exception_ptr) {
+        inferRequest.set_callback([this, &notifyEndQueue, &inferRequest, &node, traceRequestId = Tracer::getCurrentRequestId()](std::exception_ptr exception_ptr) {
+            TraceRequestGuard traceRequestGuard(traceRequestId);
             OVMS_PROFILE_ASYNC_END("async inference", this);
             this->timer->stop(EXECUTE);
             SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Completion callback received for node name: {}", this->getName());
@@ -293,6 +305,7 @@ Status DLNodeSession::executeInference(PipelineEventQueue& notifyEndQueue, ov::I
         inferRequest.start_async();
         OVMS_PROFILE_SYNC_END("ov::InferRequest::start_async");
         OVMS_PROFILE_ASYNC_BEGIN("async inference", this);
+        this->startedInferRequest = &inferRequest;
     } catch (const ov::Exception& e) {
         SPDLOG_LOGGER_DEBUG(dag_executor_logger, "[Node: {}] Exception occured when starting async inference or setting completion callback on model: {}, error: {}",
             getName(), getModelName(), e.what());
@@ -310,11 +323,26 @@ Status DLNodeSession::executeInference(PipelineEventQueue& notifyEndQueue, ov::I
 }
 
 void DLNodeSession::release() {
+    this->startedInferRequest = nullptr;
     this->nodeStreamIdGuard.reset();
     this->model.reset();
     this->modelUnloadGuard.reset();
 }
 
+void DLNodeSession::cancel() {
+    if (this->startedInferRequest == nullptr) {
+        return;
+    }
+    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Cancelling inference of node: {} session: {}", getName(), getSessionKey());
+    try {
+        // Completion callback is still called, so pipeline is notified that session finished
+        this->startedInferRequest->cancel();
+    } catch (const ov::Exception& e) {
+        SPDLOG_LOGGER_DEBUG(dag_executor_logger, "[Node: {}] Exception occured when cancelling inference on model: {}, error: {}",
+            getName(), getModelName(), e.what());
+    }
+}
+
 bool DLNodeSession::tryDisarm(uint microseconds) {
     SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Trying to disarm stream id guard of node: {}", getName());
     if (this->nodeStreamIdGuard == nullptr) {
@@ -40,6 +40,8 @@ class DLNodeSession : public NodeSession {
     std::shared_ptr<ModelInstance> model;
     std::unique_ptr<NodeStreamIdGuard> nodeStreamIdGuard;
     std::unique_ptr<ModelInstanceUnloadGuard> modelUnloadGuard;
+    // Set while infer request of this session is bound to it and inference was started
+    ov::InferRequest* startedInferRequest = nullptr;
 
     ModelManager& modelManager;
     const std::string& modelName;
@@ -69,5 +71,6 @@ public:
 
     const std::string& getModelName() { return modelName; }
     bool tryDisarm(uint microseconds) override;
+    void cancel() override;
 };
 }  // namespace ovms
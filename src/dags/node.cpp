@@ -190,6 +190,13 @@ std::unique_ptr<NodeSession> Node::createNodeSession(const NodeSessionMetadata&
     return std::make_unique<NodeSession>(metadata, getName(), previous.size(), collapsingDetails);
 }
 
+void Node::cancel() {
+    for (auto& [sessionKey, nodeSession] : nodeSessions) {
+        SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Cancelling node: {} session: {}", getName(), sessionKey);
+        nodeSession->cancel();
+    }
+}
+
 std::vector<session_key_t> Node::getReadySessions() const {
     std::vector<session_key_t> readySessions;
     for (auto& [sessionKey, nodeSession] : nodeSessions) {
@@ -39,6 +39,7 @@ using session_key_t = std::string;
 class NodeSession;
 class NodeSessionMetadata;
 class Status;
+struct NodeMetrics;
 
 class Node {
 protected:
@@ -56,6 +57,8 @@ protected:
     const std::optional<int32_t> demultiplexCount;
     const std::optional<std::set<std::string>> gatherFrom;
 
+    NodeMetrics* metrics = nullptr;
+
 public:
     Node(const std::string& nodeName, std::optional<int32_t> demultiplyCount = std::nullopt, std::set<std::string> gatherFromNode = {});
 
@@ -63,6 +66,9 @@ public:
 
     const std::string& getName() const { return this->nodeName; }
 
+    NodeMetrics* getMetrics() const { return this->metrics; }
+    void setMetrics(NodeMetrics* metrics) { this->metrics = metrics; }
+
     virtual Status execute(session_key_t sessionId, PipelineEventQueue& notifyEndQueue) = 0;
     Status fetchResults(session_key_t sessionId, SessionResults& nodeSessionOutputs);
 
@@ -92,6 +98,10 @@ public:
     }
     virtual void release(session_key_t sessionId) {}
     virtual bool tryDisarm(const session_key_t& sessionKey, const uint microseconds = 1) { return true; }
+    /**
+     * @brief Stops execution in progress of all node sessions, which still notify pipeline when they finish
+     */
+    void cancel();
 
     static void printNodeConnections(const std::string& nodeName, const std::string& sourceNode, const Aliases& pairs);
 
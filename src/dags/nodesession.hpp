@@ -55,6 +55,7 @@ public:
     bool isReady() const;
     virtual void release() {}
     virtual bool tryDisarm(uint microseconds) { return true; }
+    virtual void cancel() {}
     Status notifyFinishedDependency();
     Timer<TIMER_END>& getTimer() const;
 };
@@ -25,9 +25,9 @@
 
 namespace ovms {
 
-NodeStreamIdGuard::NodeStreamIdGuard(OVInferRequestsQueue& inferRequestsQueue, ModelMetricReporter& reporter) :
+NodeStreamIdGuard::NodeStreamIdGuard(OVInferRequestsQueue& inferRequestsQueue, ModelMetricReporter& reporter, RequestPriority priority) :
     inferRequestsQueue_(inferRequestsQueue),
-    futureStreamId(inferRequestsQueue_.getIdleStream()),
+    futureStreamId(inferRequestsQueue_.getIdleStream(priority)),
     reporter(reporter) {
     INCREMENT_IF_ENABLED(this->reporter.currentRequests);
 }
@@ -18,6 +18,8 @@
 #include <future>
 #include <optional>
 
+#include "../requestpriority.hpp"
+
 namespace ovms {
 class OVInferRequestsQueue;
 
@@ -25,7 +27,7 @@ class ModelMetricReporter;
 class OVInferRequestsQueue;
 
 struct NodeStreamIdGuard {
-    NodeStreamIdGuard(OVInferRequestsQueue& inferRequestsQueue, ModelMetricReporter& reporter);
+    NodeStreamIdGuard(OVInferRequestsQueue& inferRequestsQueue, ModelMetricReporter& reporter, RequestPriority priority = RequestPriority::MEDIUM);
     ~NodeStreamIdGuard();
 
     std::optional<int> tryGetId(const uint microseconds = 1);
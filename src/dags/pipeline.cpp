@@ -118,6 +118,17 @@ Status Pipeline::execute(ExecutionContext context) {
     // process finished session nodes and if no one is finished check if any node session with deferred execution
     // has necessary resources already
     while (true) {
+        if (firstErrorStatus.ok()) {
+            status = context.checkClientWaiting();
+            if (!status.ok()) {
+                // New node sessions are not started after error, deferred ones are disarmed and running ones cancelled
+                SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Cancelling execution of pipeline: {}; {}", getName(), status.string());
+                firstErrorStatus = status;
+                for (auto& node : nodes) {
+                    node->cancel();
+                }
+            }
+        }
         spdlog::trace("Pipeline: {} waiting for message that node finished.", getName());
         OVMS_PROFILE_SYNC_BEGIN("PipelineEventQueue::tryPull");
         auto optionallyFinishedNode = finishedNodeQueue.tryPull(WAIT_FOR_FINISHED_NODE_TIMEOUT_MICROSECONDS);
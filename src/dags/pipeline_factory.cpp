@@ -33,13 +33,37 @@ bool PipelineFactory::definitionExists(const std::string& name) const {
     return definitions.find(name) != definitions.end();
 }
 
+PipelineFactory::PublishingBatch::PublishingBatch(PipelineFactory& factory) :
+    factory(factory) {
+    std::unique_lock lock(factory.definitionsMtx);
+    ++factory.publishingBatchesCount;
+}
+
+PipelineFactory::PublishingBatch::~PublishingBatch() {
+    std::unique_lock lock(factory.definitionsMtx);
+    if (--factory.publishingBatchesCount == 0 && factory.isSnapshotOutdated) {
+        factory.publishDefinitions();
+    }
+}
+
+// Needs to be called with definitionsMtx locked
+void PipelineFactory::publishDefinitions() {
+    auto snapshot = std::make_unique<std::map<std::string, PipelineDefinition*>>();
+    for (auto& [name, definition] : definitions) {
+        snapshot->emplace(name, definition.get());
+    }
+    definitionsSnapshot.publish(std::move(snapshot));
+    isSnapshotOutdated = false;
+}
+
 PipelineDefinition* PipelineFactory::findDefinitionByName(const std::string& name) const {
-    std::shared_lock lock(definitionsMtx);
-    auto it = definitions.find(name);
-    if (it == std::end(definitions)) {
+    RcuReadGuard guard;
+    const auto& snapshot = definitionsSnapshot.read(guard);
+    auto it = snapshot.find(name);
+    if (it == std::end(snapshot)) {
         return nullptr;
     } else {
-        return it->second.get();
+        return it->second;
     }
 }
 
@@ -77,6 +101,10 @@ Status PipelineFactory::createDefinition(const std::string& pipelineName,
 
     std::unique_lock lock(definitionsMtx);
     definitions[pipelineName] = std::move(pipelineDefinition);
+    isSnapshotOutdated = true;
+    if (publishingBatchesCount == 0) {
+        publishDefinitions();
+    }
 
     return validationResult;
 }
@@ -85,7 +113,10 @@ Status PipelineFactory::reloadDefinition(const std::string& pipelineName,
     const std::vector<NodeInfo>&& nodeInfos,
     const pipeline_connections_t&& connections,
     ModelManager& manager) {
-    auto pd = findDefinitionByName(pipelineName);
+    std::shared_lock lock(definitionsMtx);
+    auto it = definitions.find(pipelineName);
+    PipelineDefinition* pd = it != definitions.end() ? it->second.get() : nullptr;
+    lock.unlock();
     if (pd == nullptr) {
         SPDLOG_LOGGER_ERROR(modelmanager_logger, "Requested to reload pipeline definition but it does not exist: {}", pipelineName);
         return StatusCode::UNKNOWN_ERROR;
@@ -123,14 +154,12 @@ const std::vector<std::string> PipelineFactory::getPipelinesNames() const {
 
 template <typename RequestType, typename ResponseType>
 Status PipelineFactory::create(std::unique_ptr<Pipeline>& pipeline, const std::string& name, const RequestType* request, ResponseType* response, ModelManager& manager) const {
-    std::shared_lock lock(definitionsMtx);
-    if (!definitionExists(name)) {
+    auto definition = findDefinitionByName(name);
+    if (definition == nullptr) {
         SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Pipeline with requested name: {} does not exist", name);
         return StatusCode::PIPELINE_DEFINITION_NAME_MISSING;
     }
-    auto& definition = *definitions.at(name);
-    lock.unlock();
-    return definition.create(pipeline, request, response, manager);
+    return definition->create(pipeline, request, response, manager);
 }
 
 template Status PipelineFactory::create<::KFSRequest, ::KFSResponse>(std::unique_ptr<Pipeline>& pipeline, const std::string& name, const ::KFSRequest* request, ::KFSResponse* response, ModelManager& manager) const;
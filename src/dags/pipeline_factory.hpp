@@ -29,6 +29,7 @@
 #include "tensorflow_serving/apis/prediction_service.grpc.pb.h"
 #pragma GCC diagnostic pop
 #include "../kfs_frontend/kfs_grpc_inference_service.hpp"
+#include "../rcu.hpp"
 #include "nodeinfo.hpp"
 
 namespace ovms {
@@ -42,8 +43,29 @@ class Status;
 class PipelineFactory {
     std::map<std::string, std::unique_ptr<PipelineDefinition>> definitions;
     mutable std::shared_mutex definitionsMtx;
+    /**
+     * @brief Definitions lookup used by requests. Definitions are never removed so raw pointers stay valid.
+     */
+    RcuSnapshot<std::map<std::string, PipelineDefinition*>> definitionsSnapshot;
+    uint32_t publishingBatchesCount = 0;
+    bool isSnapshotOutdated = false;
+
+    void publishDefinitions();
 
 public:
+    /**
+     * @brief Definitions created while batch exists are published to requests once, when the last batch ends
+     */
+    class PublishingBatch {
+        PipelineFactory& factory;
+
+    public:
+        explicit PublishingBatch(PipelineFactory& factory);
+        ~PublishingBatch();
+        PublishingBatch(const PublishingBatch&) = delete;
+        PublishingBatch& operator=(const PublishingBatch&) = delete;
+    };
+
     Status createDefinition(const std::string& pipelineName,
         const std::vector<NodeInfo>& nodeInfos,
         const pipeline_connections_t& connections,
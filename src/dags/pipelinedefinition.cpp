@@ -63,6 +63,7 @@ PipelineDefinition::PipelineDefinition(const std::string& pipelineName,
     nodeInfos(nodeInfos),
     connections(connections),
     reporter(std::make_unique<ServableMetricReporter>(metricConfig, registry, pipelineName, VERSION)),
+    nodeReporter(std::make_unique<NodeMetricReporter>(metricConfig, registry, pipelineName, VERSION)),
     status(SCHEDULER_CLASS_NAME, this->pipelineName) {}
 
 Status PipelineDefinition::validate(ModelManager& manager) {
@@ -290,6 +291,13 @@ Status PipelineDefinition::create(std::unique_ptr<Pipeline>& pipeline,
             throw std::invalid_argument("unknown node kind");
         }
     }
+    if (this->nodeReporter->isEnabled()) {
+        for (const auto& info : nodeInfos) {
+            if (info.kind == NodeKind::DL || info.kind == NodeKind::CUSTOM) {
+                nodes.at(info.nodeName)->setMetrics(this->nodeReporter->getNodeMetrics(info.nodeName));
+            }
+        }
+    }
     for (const auto& kv : connections) {
         const auto& dependantNode = nodes.at(kv.first);
         for (const auto& pair : kv.second) {
@@ -43,6 +43,7 @@ class MetricConfig;
 class MetricRegistry;
 class ModelManager;
 class ServableMetricReporter;
+class NodeMetricReporter;
 class NodeValidator;
 class Pipeline;
 class PipelineDefinitionUnloadGuard;
@@ -88,6 +89,7 @@ private:
     static constexpr model_version_t VERSION = 1;
 
     std::unique_ptr<ServableMetricReporter> reporter;
+    std::unique_ptr<NodeMetricReporter> nodeReporter;
 
 protected:
     PipelineDefinitionStatus status;
@@ -15,6 +15,10 @@
 //*****************************************************************************
 #include "deserialization.hpp"
 
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+
 #include "capi_frontend/buffer.hpp"
 #include "logging.hpp"
 
@@ -60,22 +64,81 @@ ov::Tensor makeTensor(const InferenceTensor& requestInput,
     return ov::Tensor(precision, shape, const_cast<void*>(reinterpret_cast<const void*>(requestInput.getBuffer()->data())));
 }
 
-ov::Tensor makeTensor(const tensorflow::TensorProto& requestInput,
-    const std::shared_ptr<const TensorInfo>& tensorInfo) {
-    OVMS_PROFILE_FUNCTION();
+static ov::Shape getTensorProtoShape(const tensorflow::TensorProto& requestInput) {
     OV_LOGGER("ov::Shape()");
     ov::Shape shape;
     for (int i = 0; i < requestInput.tensor_shape().dim_size(); i++) {
         OV_LOGGER("ov::Shape::push_back({})", requestInput.tensor_shape().dim(i).size());
         shape.push_back(requestInput.tensor_shape().dim(i).size());
     }
+    return shape;
+}
+
+// Other precisions are deserialized from typed value fields, tensor_content is not used for them
+static bool isDeserializedFromTensorContent(ovms::Precision precision) {
+    switch (precision) {
+    case ovms::Precision::FP32:
+    case ovms::Precision::I32:
+    case ovms::Precision::FP64:
+    case ovms::Precision::I64:
+    case ovms::Precision::U8:
+    case ovms::Precision::I16:
+    case ovms::Precision::I8:
+        return true;
+    default:
+        return false;
+    }
+}
+
+Status validateTensorContent(const tensorflow::TensorProto& requestInput,
+    const std::shared_ptr<const TensorInfo>& tensorInfo) {
+    const std::string& content = requestInput.tensor_content();
+    if (content.empty() || !isDeserializedFromTensorContent(tensorInfo->getPrecision())) {
+        return StatusCode::OK;
+    }
+    if (requestInput.dtype() != getPrecisionAsDataType(tensorInfo->getPrecision())) {
+        std::stringstream ss;
+        ss << "Expected: " << tensorInfo->getPrecisionAsString()
+           << "; Actual: " << getDataTypeAsString(requestInput.dtype())
+           << "; input name: " << tensorInfo->getName();
+        SPDLOG_DEBUG("Invalid precision of tensor content - {}", ss.str());
+        return Status(StatusCode::INVALID_PRECISION, ss.str());
+    }
+    ov::element::Type precision = tensorInfo->getOvPrecision();
+    size_t expectedContentSize = (ov::shape_size(getTensorProtoShape(requestInput)) * precision.bitwidth() + 7) / 8;
+    if (content.size() != expectedContentSize) {
+        std::stringstream ss;
+        ss << "Expected: " << expectedContentSize << " bytes; Actual: " << content.size()
+           << " bytes; input name: " << tensorInfo->getName();
+        SPDLOG_DEBUG("Invalid content size of tensor - {}", ss.str());
+        return Status(StatusCode::INVALID_CONTENT_SIZE, ss.str());
+    }
+    return StatusCode::OK;
+}
+
+ov::Tensor makeTensor(const tensorflow::TensorProto& requestInput,
+    const std::shared_ptr<const TensorInfo>& tensorInfo) {
+    OVMS_PROFILE_FUNCTION();
+    ov::Shape shape = getTensorProtoShape(requestInput);
     ov::element::Type_t precision = tensorInfo->getOvPrecision();
-    if (!requestInput.tensor_content().size()) {
+    const std::string& content = requestInput.tensor_content();
+    if (!content.size()) {
         OV_LOGGER("ov::Tensor({}, shape)", toString(ovms::ovElementTypeToOvmsPrecision(precision)));
         return ov::Tensor(precision, shape);
     }
-    OV_LOGGER("ov::Tensor({}, shape, data)", toString(ovms::ovElementTypeToOvmsPrecision(precision)));
-    return ov::Tensor(precision, shape, const_cast<void*>(reinterpret_cast<const void*>(requestInput.tensor_content().data())));
+    if (!validateTensorContent(requestInput, tensorInfo).ok()) {
+        OV_LOGGER("ov::Tensor()");
+        return ov::Tensor();
+    }
+    // Content matching precision and size is wrapped unless it is not aligned to the element size
+    if (reinterpret_cast<uintptr_t>(content.data()) % ov::element::Type(precision).size() == 0) {
+        OV_LOGGER("ov::Tensor({}, shape, data)", toString(ovms::ovElementTypeToOvmsPrecision(precision)));
+        return ov::Tensor(precision, shape, const_cast<void*>(reinterpret_cast<const void*>(content.data())));
+    }
+    OV_LOGGER("ov::Tensor({}, shape)", toString(ovms::ovElementTypeToOvmsPrecision(precision)));
+    ov::Tensor tensor(precision, shape);
+    std::memcpy(tensor.data(), content.data(), content.size());
+    return tensor;
 }
 
 ov::Tensor makeTensor(const ::KFSRequest::InferInputTensor& requestInput,
@@ -47,6 +47,13 @@ namespace ovms {
             return status; \
     }
 
+/**
+ * @brief Checks that tensor_content of TensorProto has precision and byte size expected by the tensor.
+ * Returns OK when tensor_content is empty or not used to deserialize tensor of given precision.
+ */
+Status validateTensorContent(const tensorflow::TensorProto& requestInput,
+    const std::shared_ptr<const TensorInfo>& tensorInfo);
+
 ov::Tensor makeTensor(const tensorflow::TensorProto& requestInput,
     const std::shared_ptr<const TensorInfo>& tensorInfo);
 
@@ -382,6 +389,7 @@ Status deserializePredictRequest(
                 }
             } else {
                 // Data Array Format
+                RETURN_IF_ERR(validateTensorContent(requestInput, tensorInfo));
                 tensor = deserializeTensorProto<TensorProtoDeserializator>(
                     requestInput, tensorInfo);
             }
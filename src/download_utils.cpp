@@ -0,0 +1,328 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "download_utils.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <unistd.h>
+
+#include "filesystem.hpp"
+#include "logging.hpp"
+#include "stringutils.hpp"
+
+namespace ovms {
+
+namespace fs = std::filesystem;
+
+static const size_t WRITE_STREAM_BUFFER_SIZE = 1024 * 1024;
+
+uint32_t getDownloadThreadsCount() {
+    const char* threadsEnv = std::getenv("OVMS_DOWNLOAD_THREADS");
+    if (threadsEnv == nullptr) {
+        return DEFAULT_DOWNLOAD_THREADS;
+    }
+    auto threads = stou32(threadsEnv);
+    if (!threads.has_value() || threads.value() == 0) {
+        SPDLOG_WARN("Invalid OVMS_DOWNLOAD_THREADS value: {}. Using default: {}", threadsEnv, DEFAULT_DOWNLOAD_THREADS);
+        return DEFAULT_DOWNLOAD_THREADS;
+    }
+    return threads.value();
+}
+
+StatusCode runDownloadTasks(std::vector<download_task_t>& tasks, uint32_t threadsCount) {
+    const size_t workersCount = std::min<size_t>(std::max<uint32_t>(threadsCount, 1), tasks.size());
+    std::atomic<size_t> nextTask{0};
+    std::atomic<bool> failed{false};
+    std::mutex errorMtx;
+    StatusCode firstError = StatusCode::OK;
+    auto worker = [&]() {
+        size_t i;
+        // Stop picking new tasks after first failure, model version cannot be loaded anyway
+        while (!failed && (i = nextTask++) < tasks.size()) {
+            StatusCode status;
+            try {
+                status = tasks[i]();
+            } catch (std::exception& e) {
+                SPDLOG_ERROR("Exception occurred during download: {}", e.what());
+                status = StatusCode::FILESYSTEM_ERROR;
+            }
+            if (status != StatusCode::OK) {
+                std::lock_guard<std::mutex> lock(errorMtx);
+                if (firstError == StatusCode::OK) {
+                    firstError = status;
+                }
+                failed = true;
+            }
+        }
+    };
+    if (workersCount <= 1) {
+        worker();
+        return firstError;
+    }
+    std::vector<std::thread> workers;
+    workers.reserve(workersCount);
+    for (size_t i = 0; i < workersCount; ++i) {
+        workers.emplace_back(worker);
+    }
+    for (auto& t : workers) {
+        t.join();
+    }
+    return firstError;
+}
+
+std::vector<byte_range_t> splitIntoDownloadRanges(uint64_t size, uint64_t partSize) {
+    std::vector<byte_range_t> ranges;
+    if (size == 0) {
+        return ranges;
+    }
+    if (size < RANGED_DOWNLOAD_MIN_FILE_SIZE || partSize == 0) {
+        ranges.emplace_back(0, size - 1);
+        return ranges;
+    }
+    for (uint64_t begin = 0; begin < size; begin += partSize) {
+        ranges.emplace_back(begin, std::min(begin + partSize, size) - 1);
+    }
+    return ranges;
+}
+
+StatusCode createFileOfSize(const std::string& path, uint64_t size) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        SPDLOG_ERROR("Failed to create file: {}", path);
+        return StatusCode::FILESYSTEM_ERROR;
+    }
+    file.close();
+    std::error_code ec;
+    fs::resize_file(path, size, ec);
+    if (ec) {
+        SPDLOG_ERROR("Failed to resize file: {} to {} bytes: {}", path, size, ec.message());
+        return StatusCode::FILESYSTEM_ERROR;
+    }
+    return StatusCode::OK;
+}
+
+StatusCode writeFileRange(const std::string& path, uint64_t offset, const char* data, size_t size) {
+    std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+    if (!file) {
+        SPDLOG_ERROR("Failed to open file: {}", path);
+        return StatusCode::FILESYSTEM_ERROR;
+    }
+    file.seekp(offset);
+    file.write(data, size);
+    file.close();
+    if (!file) {
+        SPDLOG_ERROR("Failed to write {} bytes at offset {} to file: {}", size, offset, path);
+        return StatusCode::FILESYSTEM_ERROR;
+    }
+    return StatusCode::OK;
+}
+
+StatusCode writeStreamToFile(std::istream& input, const std::string& path, uint64_t expectedSize, StatusCode incompleteReadStatus) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        SPDLOG_ERROR("Failed to create file: {}", path);
+        return StatusCode::FILESYSTEM_ERROR;
+    }
+    std::vector<char> buffer(WRITE_STREAM_BUFFER_SIZE);
+    uint64_t written = 0;
+    while (input.read(buffer.data(), buffer.size()) || input.gcount() > 0) {
+        file.write(buffer.data(), input.gcount());
+        if (!file) {
+            SPDLOG_ERROR("Failed to write {} bytes to file: {}", input.gcount(), path);
+            return StatusCode::FILESYSTEM_ERROR;
+        }
+        written += input.gcount();
+    }
+    file.close();
+    if (!file) {
+        SPDLOG_ERROR("Failed to write file: {}", path);
+        return StatusCode::FILESYSTEM_ERROR;
+    }
+    if (input.bad() || written != expectedSize) {
+        SPDLOG_ERROR("Received {} bytes of {} expected for file: {}", written, expectedSize, path);
+        return incompleteReadStatus;
+    }
+    return StatusCode::OK;
+}
+
+StatusCode checkDownloadedFileSize(const std::string& path, uint64_t expectedSize) {
+    std::error_code ec;
+    const uint64_t size = fs::file_size(path, ec);
+    if (ec) {
+        SPDLOG_ERROR("Failed to get size of downloaded file: {}; {}", path, ec.message());
+        return StatusCode::FILESYSTEM_ERROR;
+    }
+    if (size != expectedSize) {
+        SPDLOG_ERROR("Downloaded file: {} has {} bytes while object has {} bytes", path, size, expectedSize);
+        return StatusCode::FILESYSTEM_ERROR;
+    }
+    return StatusCode::OK;
+}
+
+DownloadCache::DownloadCache(const std::string& directory, uint64_t maxSize) :
+    directory(directory),
+    maxSize(maxSize) {
+    if (directory.empty()) {
+        return;
+    }
+    std::error_code ec;
+    fs::create_directories(directory, ec);
+    if (ec) {
+        SPDLOG_WARN("Failed to create download cache directory: {}; {}", directory, ec.message());
+    }
+}
+
+static uint64_t getDownloadCacheSize() {
+    const char* sizeEnv = std::getenv("OVMS_DOWNLOAD_CACHE_SIZE_MB");
+    if (sizeEnv == nullptr) {
+        return uint64_t(DEFAULT_DOWNLOAD_CACHE_SIZE_MB) * 1024 * 1024;
+    }
+    auto size = stou32(sizeEnv);
+    if (!size.has_value()) {
+        SPDLOG_WARN("Invalid OVMS_DOWNLOAD_CACHE_SIZE_MB value: {}. Using default: {}", sizeEnv, DEFAULT_DOWNLOAD_CACHE_SIZE_MB);
+        return uint64_t(DEFAULT_DOWNLOAD_CACHE_SIZE_MB) * 1024 * 1024;
+    }
+    return uint64_t(size.value()) * 1024 * 1024;
+}
+
+DownloadCache& DownloadCache::instance() {
+    static DownloadCache instance(std::getenv("OVMS_DOWNLOAD_CACHE_DIR") != nullptr ? std::getenv("OVMS_DOWNLOAD_CACHE_DIR") : "", getDownloadCacheSize());
+    return instance;
+}
+
+std::string DownloadCache::createKey(const std::string& objectPath, const std::string& objectVersion) {
+    return objectPath + "\n" + objectVersion;
+}
+
+std::string DownloadCache::getEntryPath(const std::string& key) const {
+    std::string md5 = FileSystem::getStringMD5(key);
+    std::stringstream ss;
+    ss << std::hex << std::setfill('0');
+    for (unsigned char c : md5) {
+        ss << std::setw(2) << static_cast<int>(c);
+    }
+    return FileSystem::joinPath({directory, ss.str()});
+}
+
+// Hard link is preferred to avoid copying multi-GB files when cache and temporary directory share filesystem
+static bool linkOrCopyFile(const std::string& from, const std::string& to) {
+    std::error_code ec;
+    fs::create_hard_link(from, to, ec);
+    if (!ec) {
+        return true;
+    }
+    ec.clear();
+    fs::copy_file(from, to, fs::copy_options::overwrite_existing, ec);
+    return !ec;
+}
+
+bool DownloadCache::fetch(const std::string& key, const std::string& localFilePath) const {
+    if (!isEnabled()) {
+        return false;
+    }
+    const std::string entryPath = getEntryPath(key);
+    std::error_code ec;
+    if (!fs::exists(entryPath, ec)) {
+        return false;
+    }
+    if (!linkOrCopyFile(entryPath, localFilePath)) {
+        SPDLOG_WARN("Failed to use cached file: {} for: {}", entryPath, localFilePath);
+        return false;
+    }
+    // Modification time of entry is its last use, entries not used for the longest time are evicted first
+    fs::last_write_time(entryPath, fs::file_time_type::clock::now(), ec);
+    SPDLOG_DEBUG("Using cached file: {} for: {}", entryPath, localFilePath);
+    return true;
+}
+
+void DownloadCache::store(const std::string& key, const std::string& localFilePath) const {
+    if (!isEnabled()) {
+        return;
+    }
+    const std::string entryPath = getEntryPath(key);
+    // Entry is prepared under unique name and renamed so that concurrent readers never see partial files
+    std::stringstream tmpPath;
+    tmpPath << entryPath << ".tmp." << getpid() << "." << std::this_thread::get_id();
+    std::error_code ec;
+    if (!linkOrCopyFile(localFilePath, tmpPath.str())) {
+        SPDLOG_WARN("Failed to store file: {} in download cache", localFilePath);
+        fs::remove(tmpPath.str(), ec);
+        return;
+    }
+    fs::rename(tmpPath.str(), entryPath, ec);
+    if (ec) {
+        SPDLOG_WARN("Failed to store file: {} in download cache: {}", localFilePath, ec.message());
+        fs::remove(tmpPath.str(), ec);
+        return;
+    }
+    SPDLOG_DEBUG("Stored file: {} in download cache as: {}", localFilePath, entryPath);
+    evict(entryPath);
+}
+
+void DownloadCache::evict(const std::string& keptEntryPath) const {
+    struct Entry {
+        std::string path;
+        uint64_t size;
+        fs::file_time_type lastUsed;
+    };
+    std::lock_guard<std::mutex> lock(evictionMtx);
+    std::vector<Entry> entries;
+    uint64_t totalSize = 0;
+    std::error_code ec;
+    for (auto it = fs::directory_iterator(directory, ec); !ec && it != fs::directory_iterator(); it.increment(ec)) {
+        const std::string path = it->path().string();
+        // Skip entries being stored by other threads or processes
+        if (path.find(".tmp.") != std::string::npos || !it->is_regular_file(ec)) {
+            continue;
+        }
+        Entry entry{path, it->file_size(ec), it->last_write_time(ec)};
+        if (ec) {
+            ec.clear();
+            continue;
+        }
+        totalSize += entry.size;
+        entries.push_back(std::move(entry));
+    }
+    if (totalSize <= maxSize) {
+        return;
+    }
+    std::sort(entries.begin(), entries.end(), [](const Entry& lhs, const Entry& rhs) { return lhs.lastUsed < rhs.lastUsed; });
+    for (const auto& entry : entries) {
+        if (totalSize <= maxSize) {
+            break;
+        }
+        if (entry.path == keptEntryPath) {
+            continue;
+        }
+        // Files already placed in model directories are hard links or copies, so they are not affected
+        if (fs::remove(entry.path, ec)) {
+            totalSize -= entry.size;
+            SPDLOG_DEBUG("Evicted file: {} ({} bytes) from download cache", entry.path, entry.size);
+        }
+    }
+}
+}  // namespace ovms
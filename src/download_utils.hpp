@@ -0,0 +1,113 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "status.hpp"
+
+namespace ovms {
+
+const uint32_t DEFAULT_DOWNLOAD_THREADS = 8;
+// Files bigger than that are downloaded with multiple ranged requests
+const uint64_t RANGED_DOWNLOAD_MIN_FILE_SIZE = 64 * 1024 * 1024;
+const uint64_t RANGED_DOWNLOAD_PART_SIZE = 16 * 1024 * 1024;
+const uint32_t DEFAULT_DOWNLOAD_CACHE_SIZE_MB = 10 * 1024;
+
+using download_task_t = std::function<StatusCode()>;
+using byte_range_t = std::pair<uint64_t, uint64_t>;  // first byte, last byte (inclusive)
+
+/**
+ * @brief Number of concurrent downloads from cloud storage. Read from OVMS_DOWNLOAD_THREADS environment variable.
+ */
+uint32_t getDownloadThreadsCount();
+
+/**
+ * @brief Runs tasks using up to threadsCount threads.
+ *
+ * @return first error reported by tasks or StatusCode::OK
+ */
+StatusCode runDownloadTasks(std::vector<download_task_t>& tasks, uint32_t threadsCount = getDownloadThreadsCount());
+
+/**
+ * @brief Splits object of given size into byte ranges. Objects smaller than RANGED_DOWNLOAD_MIN_FILE_SIZE are not split.
+ */
+std::vector<byte_range_t> splitIntoDownloadRanges(uint64_t size, uint64_t partSize = RANGED_DOWNLOAD_PART_SIZE);
+
+/**
+ * @brief Creates file of given size so that ranges can be written into it independently.
+ */
+StatusCode createFileOfSize(const std::string& path, uint64_t size);
+
+/**
+ * @brief Writes data at given offset of existing file.
+ */
+StatusCode writeFileRange(const std::string& path, uint64_t offset, const char* data, size_t size);
+
+/**
+ * @brief Writes whole object body into file, fails when stream ends before or after expected size.
+ *
+ * @param incompleteReadStatus returned when object body is not read completely or its size does not match
+ */
+StatusCode writeStreamToFile(std::istream& input, const std::string& path, uint64_t expectedSize, StatusCode incompleteReadStatus);
+
+/**
+ * @brief Checks that downloaded file has object size, so that truncated files are not stored in the download cache.
+ */
+StatusCode checkDownloadedFileSize(const std::string& path, uint64_t expectedSize);
+
+/**
+ * @brief Persistent cache of downloaded model files.
+ * Entries are keyed by object location and its version identifier (ETag or generation), so changed objects are downloaded again.
+ * Directory is taken from OVMS_DOWNLOAD_CACHE_DIR environment variable, cache is disabled when it is not set.
+ * Least recently used entries are removed when total size exceeds OVMS_DOWNLOAD_CACHE_SIZE_MB.
+ */
+class DownloadCache {
+    const std::string directory;
+    const uint64_t maxSize;
+    mutable std::mutex evictionMtx;
+
+    std::string getEntryPath(const std::string& key) const;
+    void evict(const std::string& keptEntryPath) const;
+
+public:
+    DownloadCache(const std::string& directory, uint64_t maxSize = uint64_t(DEFAULT_DOWNLOAD_CACHE_SIZE_MB) * 1024 * 1024);
+
+    static DownloadCache& instance();
+
+    bool isEnabled() const { return !directory.empty(); }
+
+    static std::string createKey(const std::string& objectPath, const std::string& objectVersion);
+
+    /**
+     * @brief Places cached file under localFilePath
+     *
+     * @return false on cache miss
+     */
+    bool fetch(const std::string& key, const std::string& localFilePath) const;
+
+    /**
+     * @brief Stores downloaded file in cache, removing least recently used entries if cache size limit is exceeded
+     */
+    void store(const std::string& key, const std::string& localFilePath) const;
+};
+}  // namespace ovms
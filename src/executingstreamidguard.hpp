@@ -15,6 +15,8 @@
 //*****************************************************************************
 #pragma once
 
+#include "requestpriority.hpp"
+
 namespace ov {
 class InferRequest;
 }
@@ -26,7 +28,7 @@ class ModelMetricReporter;
 class OVInferRequestsQueue;
 
 struct ExecutingStreamIdGuard {
-    ExecutingStreamIdGuard(ovms::OVInferRequestsQueue& inferRequestsQueue, ModelMetricReporter& reporter);
+    ExecutingStreamIdGuard(ovms::OVInferRequestsQueue& inferRequestsQueue, ModelMetricReporter& reporter, RequestPriority priority = RequestPriority::MEDIUM);
     ~ExecutingStreamIdGuard();
 
     int getId();
@@ -15,7 +15,12 @@
 //*****************************************************************************
 #pragma once
 
+#include <chrono>
 #include <cstdint>
+#include <functional>
+#include <optional>
+
+#include "status.hpp"
 
 namespace ovms {
 
@@ -43,9 +48,38 @@ struct ExecutionContext {
     Interface interface;
     Method method;
 
+    /**
+     * @brief Point in time after which client does not wait for the response, not set when client did not specify deadline
+     */
+    std::optional<std::chrono::steady_clock::time_point> deadline;
+
+    /**
+     * @brief Returns true when client cancelled the request, empty when frontend cannot detect cancellation
+     */
+    std::function<bool()> cancellationCheck;
+
     ExecutionContext(Interface interface, Method method) :
         interface(interface),
         method(method) {}
+
+    /**
+     * @brief Checks if client still waits for the response, so that processing of abandoned request can stop early
+     *
+     * @return Status REQUEST_DEADLINE_EXCEEDED or REQUEST_CANCELLED when response will not be read
+     */
+    Status checkClientWaiting() const {
+        if (deadline.has_value() && std::chrono::steady_clock::now() >= deadline.value()) {
+            return StatusCode::REQUEST_DEADLINE_EXCEEDED;
+        }
+        if (cancellationCheck && cancellationCheck()) {
+            return StatusCode::REQUEST_CANCELLED;
+        }
+        return StatusCode::OK;
+    }
+
+    bool canBeAbandoned() const {
+        return deadline.has_value() || cancellationCheck;
+    }
 };
 
 }  // namespace ovms
@@ -0,0 +1,124 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "filesystemwatcher.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <vector>
+
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+#include "logging.hpp"
+
+namespace ovms {
+
+static const uint32_t WATCHED_EVENTS = IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_CLOSE_WRITE | IN_ATTRIB | IN_DELETE_SELF | IN_MOVE_SELF;
+
+FileSystemWatcher::FileSystemWatcher() {
+    inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotifyFd < 0) {
+        SPDLOG_LOGGER_WARN(modelmanager_logger, "Failed to initialize inotify: {}", std::strerror(errno));
+    }
+}
+
+FileSystemWatcher::~FileSystemWatcher() {
+    if (inotifyFd >= 0) {
+        close(inotifyFd);
+    }
+}
+
+bool FileSystemWatcher::setWatchedDirectories(const std::set<std::string>& directories) {
+    if (!isInitialized()) {
+        return false;
+    }
+    for (auto it = pathToWatchDescriptor.begin(); it != pathToWatchDescriptor.end();) {
+        if (directories.find(it->first) == directories.end()) {
+            SPDLOG_LOGGER_TRACE(modelmanager_logger, "Stopped watching directory: {}", it->first);
+            inotify_rm_watch(inotifyFd, it->second);
+            watchDescriptorToPath.erase(it->second);
+            it = pathToWatchDescriptor.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    bool allWatched = true;
+    for (const auto& directory : directories) {
+        if (pathToWatchDescriptor.find(directory) != pathToWatchDescriptor.end()) {
+            continue;
+        }
+        int wd = inotify_add_watch(inotifyFd, directory.c_str(), WATCHED_EVENTS | IN_ONLYDIR);
+        if (wd < 0) {
+            SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Cannot watch directory: {} for changes: {}", directory, std::strerror(errno));
+            allWatched = false;
+            continue;
+        }
+        SPDLOG_LOGGER_TRACE(modelmanager_logger, "Started watching directory: {}", directory);
+        pathToWatchDescriptor[directory] = wd;
+        watchDescriptorToPath[wd] = directory;
+    }
+    return allWatched;
+}
+
+bool FileSystemWatcher::waitForEvent(std::chrono::milliseconds timeout) {
+    struct pollfd pfd;
+    pfd.fd = inotifyFd;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+    int result = poll(&pfd, 1, static_cast<int>(timeout.count()));
+    return (result > 0) && (pfd.revents & POLLIN);
+}
+
+void FileSystemWatcher::drainEvents() {
+    alignas(struct inotify_event) char buffer[4096];
+    while (true) {
+        ssize_t length = read(inotifyFd, buffer, sizeof(buffer));
+        if (length <= 0) {
+            return;
+        }
+        for (char* ptr = buffer; ptr < buffer + length;) {
+            const struct inotify_event* event = reinterpret_cast<const struct inotify_event*>(ptr);
+            ptr += sizeof(struct inotify_event) + event->len;
+            if (event->mask & IN_Q_OVERFLOW) {
+                SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Filesystem events queue overflow");
+                continue;
+            }
+            auto it = watchDescriptorToPath.find(event->wd);
+            if (it == watchDescriptorToPath.end()) {
+                continue;
+            }
+            SPDLOG_LOGGER_TRACE(modelmanager_logger, "Filesystem event: {} in directory: {} file: {}", event->mask, it->second, event->len ? event->name : "");
+            // Watch is removed by the kernel when directory is deleted or its filesystem is unmounted
+            if (event->mask & IN_IGNORED) {
+                pathToWatchDescriptor.erase(it->second);
+                watchDescriptorToPath.erase(it);
+            }
+        }
+    }
+}
+
+bool FileSystemWatcher::waitForChanges(std::chrono::milliseconds timeout, std::chrono::milliseconds debounce) {
+    if (!isInitialized() || !waitForEvent(timeout)) {
+        return false;
+    }
+    const auto debounceDeadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(FILESYSTEM_EVENTS_MAX_DEBOUNCE_MS);
+    do {
+        drainEvents();
+    } while (std::chrono::steady_clock::now() < debounceDeadline && waitForEvent(debounce));
+    return true;
+}
+}  // namespace ovms
@@ -0,0 +1,67 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <set>
+#include <string>
+#include <unordered_map>
+
+namespace ovms {
+
+const uint32_t FILESYSTEM_EVENTS_DEBOUNCE_MS = 200;
+const uint32_t FILESYSTEM_EVENTS_MAX_DEBOUNCE_MS = 5000;
+const uint32_t FILESYSTEM_EVENTS_EXIT_CHECK_INTERVAL_MS = 100;
+
+/**
+ * @brief Watches local directories for changes using inotify.
+ * Directories are watched non-recursively.
+ */
+class FileSystemWatcher {
+    int inotifyFd = -1;
+    std::unordered_map<std::string, int> pathToWatchDescriptor;
+    std::unordered_map<int, std::string> watchDescriptorToPath;
+
+    bool waitForEvent(std::chrono::milliseconds timeout);
+    void drainEvents();
+
+public:
+    FileSystemWatcher();
+    ~FileSystemWatcher();
+    FileSystemWatcher(const FileSystemWatcher&) = delete;
+    FileSystemWatcher& operator=(const FileSystemWatcher&) = delete;
+
+    bool isInitialized() const { return inotifyFd >= 0; }
+
+    /**
+     * @brief Starts watching directories from the set and stops watching directories which are not in the set anymore
+     *
+     * @param directories
+     * @return false if any of directories could not be watched
+     */
+    bool setWatchedDirectories(const std::set<std::string>& directories);
+
+    /**
+     * @brief Waits up to timeout for a change in watched directories.
+     * After the first change waits until there are no new changes for debounce period (but no longer than FILESYSTEM_EVENTS_MAX_DEBOUNCE_MS)
+     * so that files being copied are picked up at once.
+     *
+     * @return true if any change occurred
+     */
+    bool waitForChanges(std::chrono::milliseconds timeout, std::chrono::milliseconds debounce = std::chrono::milliseconds(FILESYSTEM_EVENTS_DEBOUNCE_MS));
+};
+}  // namespace ovms
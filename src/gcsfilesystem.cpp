@@ -282,19 +282,26 @@ StatusCode GCSFileSystem::readTextFile(const std::string& path,
     return StatusCode::OK;
 }
 
-StatusCode GCSFileSystem::downloadFile(const std::string& remote_path,
+StatusCode GCSFileSystem::downloadFile(const std::string& remote_path, int64_t generation, uint64_t size,
     const std::string& local_path) {
     SPDLOG_LOGGER_TRACE(gcs_logger, "Saving file {} to {}", remote_path, local_path);
-    std::string contents;
-    auto read_status = this->readTextFile(remote_path, &contents);
-    if (read_status != StatusCode::OK) {
+    std::string bucket, object;
+    auto status = parsePath(remote_path, &bucket, &object);
+    if (status != StatusCode::OK) {
+        return status;
+    }
+    gcs::ObjectReadStream stream = client_.ReadObject(bucket, object, gcs::Generation(generation));
+    if (!stream) {
         SPDLOG_LOGGER_ERROR(gcs_logger, "Failed to get object at {}", remote_path);
-        return read_status;
+        return StatusCode::GCS_FAILED_GET_OBJECT;
     }
-    std::ofstream output_file(local_path.c_str(), std::ios::binary);
-    output_file << contents;
-    output_file.close();
-    return StatusCode::OK;
+    status = writeStreamToFile(stream, local_path, size, StatusCode::GCS_FAILED_GET_OBJECT);
+    stream.Close();
+    if (!stream.status().ok()) {
+        SPDLOG_LOGGER_ERROR(gcs_logger, "Failed to get object at {} generation {}: {}", remote_path, generation, stream.status().message());
+        return StatusCode::GCS_FAILED_GET_OBJECT;
+    }
+    return status;
 }
 
 StatusCode GCSFileSystem::downloadModelVersions(const std::string& path,
@@ -372,6 +379,7 @@ StatusCode GCSFileSystem::downloadFileFolder(const std::string& path, const std:
         }
     }
 
+    std::vector<std::pair<std::string, std::string>> filesToDownload;
     for (auto&& f : files) {
         if (std::any_of(acceptedFiles.begin(), acceptedFiles.end(), [&f](const std::string& x) {
                 return f.size() > 0 && endsWith(f, x);
@@ -380,14 +388,111 @@ StatusCode GCSFileSystem::downloadFileFolder(const std::string& path, const std:
             std::string local_file_path = FileSystem::joinPath({local_path, f});
             SPDLOG_LOGGER_TRACE(gcs_logger, "Processing file {} from {} -> {}", f, remote_file_path,
                 local_file_path);
-            auto download_status =
-                this->downloadFile(remote_file_path, local_file_path);
-            if (download_status != StatusCode::OK) {
-                SPDLOG_LOGGER_ERROR(gcs_logger, "Unable to save file from {} to {}", remote_file_path,
-                    local_file_path);
-                return download_status;
+            filesToDownload.emplace_back(remote_file_path, local_file_path);
+        }
+    }
+    return downloadFiles(filesToDownload);
+}
+
+StatusCode GCSFileSystem::downloadObjectRange(const std::string& bucket, const std::string& object, int64_t generation,
+    const std::string& local_path, const byte_range_t& range) {
+    // gcs::ReadRange end is exclusive
+    gcs::ObjectReadStream stream = client_.ReadObject(bucket, object, gcs::Generation(generation),
+        gcs::ReadRange(range.first, range.second + 1));
+    if (!stream) {
+        SPDLOG_LOGGER_ERROR(gcs_logger, "Downloading range: {}-{} of {}/{} has failed", range.first, range.second, bucket, object);
+        return StatusCode::GCS_FAILED_GET_OBJECT;
+    }
+    std::vector<char> buffer(range.second - range.first + 1);
+    stream.read(buffer.data(), buffer.size());
+    if (static_cast<size_t>(stream.gcount()) != buffer.size()) {
+        SPDLOG_LOGGER_ERROR(gcs_logger, "Received incomplete range: {}-{} of {}/{}", range.first, range.second, bucket, object);
+        return StatusCode::GCS_FAILED_GET_OBJECT;
+    }
+    return writeFileRange(local_path, range.first, buffer.data(), buffer.size());
+}
+
+StatusCode GCSFileSystem::downloadFiles(const std::vector<std::pair<std::string, std::string>>& filesToDownload) {
+    struct FileDownload {
+        std::string remotePath;
+        std::string localPath;
+        std::string bucket;
+        std::string object;
+        std::string cacheKey;
+        int64_t generation = 0;
+        uint64_t size = 0;
+        bool cached = false;
+    };
+    const DownloadCache& cache = DownloadCache::instance();
+    std::vector<FileDownload> downloads(filesToDownload.size());
+    std::vector<download_task_t> tasks;
+    // Object size and generation are required to split download into ranges and to look up the cache
+    for (size_t i = 0; i < filesToDownload.size(); ++i) {
+        auto& download = downloads[i];
+        download.remotePath = filesToDownload[i].first;
+        download.localPath = filesToDownload[i].second;
+        auto status = parsePath(download.remotePath, &download.bucket, &download.object);
+        if (status != StatusCode::OK) {
+            return status;
+        }
+        tasks.emplace_back([this, &download, &cache]() {
+            google::cloud::StatusOr<gcs::ObjectMetadata> object_metadata =
+                client_.GetObjectMetadata(download.bucket, download.object);
+            if (!object_metadata) {
+                SPDLOG_LOGGER_ERROR(gcs_logger, "Unable to get object metadata: {}", download.remotePath);
+                return StatusCode::GCS_FAILED_GET_OBJECT;
             }
+            download.size = object_metadata->size();
+            download.generation = object_metadata->generation();
+            download.cacheKey = DownloadCache::createKey(download.remotePath, std::to_string(download.generation));
+            download.cached = cache.fetch(download.cacheKey, download.localPath);
+            return StatusCode::OK;
+        });
+    }
+    auto status = runDownloadTasks(tasks);
+    if (status != StatusCode::OK) {
+        return status;
+    }
+
+    tasks.clear();
+    for (auto& download : downloads) {
+        if (download.cached) {
+            continue;
+        }
+        auto ranges = splitIntoDownloadRanges(download.size);
+        if (ranges.size() <= 1) {
+            tasks.emplace_back([this, &download]() {
+                auto download_status = this->downloadFile(download.remotePath, download.generation, download.size, download.localPath);
+                if (download_status != StatusCode::OK) {
+                    SPDLOG_LOGGER_ERROR(gcs_logger, "Unable to save file from {} to {}", download.remotePath, download.localPath);
+                }
+                return download_status;
+            });
+            continue;
+        }
+        SPDLOG_LOGGER_DEBUG(gcs_logger, "Downloading {} ({} bytes) in {} parts", download.remotePath, download.size, ranges.size());
+        status = createFileOfSize(download.localPath, download.size);
+        if (status != StatusCode::OK) {
+            return status;
+        }
+        for (const auto& range : ranges) {
+            tasks.emplace_back([this, &download, range]() { return downloadObjectRange(download.bucket, download.object, download.generation, download.localPath, range); });
+        }
+    }
+    status = runDownloadTasks(tasks);
+    if (status != StatusCode::OK) {
+        return status;
+    }
+
+    for (const auto& download : downloads) {
+        if (download.cached) {
+            continue;
+        }
+        status = checkDownloadedFileSize(download.localPath, download.size);
+        if (status != StatusCode::OK) {
+            return status;
         }
+        cache.store(download.cacheKey, download.localPath);
     }
     return StatusCode::OK;
 }
@@ -17,10 +17,12 @@
 
 #include <regex>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "google/cloud/storage/client.h"
 
+#include "download_utils.hpp"
 #include "filesystem.hpp"
 #include "status.hpp"
 
@@ -145,14 +147,27 @@ private:
 
     /**
     *
-    * @brief
+    * @brief Downloads given object generation, fails when object was replaced since its metadata was read
     *
     * @param remote_path
+    * @param generation
+    * @param size object size from metadata, download fails when it does not match
     * @param local_path
     */
-    StatusCode downloadFile(const std::string& remote_path,
+    StatusCode downloadFile(const std::string& remote_path, int64_t generation, uint64_t size,
         const std::string& local_path);
 
+    /**
+    * @brief Download objects concurrently. Big objects are downloaded with multiple ranged reads.
+    * Unchanged objects are taken from download cache if enabled.
+    *
+    * @param filesToDownload pairs of remote object path and local file path
+    */
+    StatusCode downloadFiles(const std::vector<std::pair<std::string, std::string>>& filesToDownload);
+
+    StatusCode downloadObjectRange(const std::string& bucket, const std::string& object, int64_t generation,
+        const std::string& local_path, const byte_range_t& range);
+
     /**
     * @brief
     *
@@ -16,9 +16,11 @@
 
 #include "grpc_utils.hpp"
 
+#include <chrono>
 #include <string>
 #include <unordered_map>
 
+#include "execution_context.hpp"
 #include "status.hpp"
 
 namespace ovms {
@@ -45,6 +47,7 @@ const grpc::Status grpc(const Status& status) {
         // can occur when using bs/shape: auto & config reload
         {StatusCode::RESHAPE_ERROR, grpc::StatusCode::FAILED_PRECONDITION},
         {StatusCode::CANNOT_COMPILE_MODEL_INTO_TARGET_DEVICE, grpc::StatusCode::FAILED_PRECONDITION},
+        {StatusCode::MODEL_MEMORY_LIMIT_EXCEEDED, grpc::StatusCode::FAILED_PRECONDITION},
         {StatusCode::SEQUENCE_TERMINATED, grpc::StatusCode::FAILED_PRECONDITION},
         {StatusCode::MEDIAPIPE_DESERIALIZATION_ERROR, grpc::StatusCode::FAILED_PRECONDITION},
         {StatusCode::MEDIAPIPE_GRAPH_START_ERROR, grpc::StatusCode::FAILED_PRECONDITION},
@@ -85,6 +88,7 @@ const grpc::Status grpc(const Status& status) {
         {StatusCode::INVALID_DEVICE_ID, grpc::StatusCode::INVALID_ARGUMENT},
         {StatusCode::INVALID_STRING_INPUT, grpc::StatusCode::INVALID_ARGUMENT},
         {StatusCode::INVALID_INPUT_FORMAT, grpc::StatusCode::INVALID_ARGUMENT},
+        {StatusCode::INVALID_PRIORITY, grpc::StatusCode::INVALID_ARGUMENT},
         {StatusCode::INVALID_PRECISION, grpc::StatusCode::INVALID_ARGUMENT},
         {StatusCode::INVALID_VALUE_COUNT, grpc::StatusCode::INVALID_ARGUMENT},
         {StatusCode::INVALID_CONTENT_SIZE, grpc::StatusCode::INVALID_ARGUMENT},
@@ -99,6 +103,13 @@ const grpc::Status grpc(const Status& status) {
         {StatusCode::PIPELINE_DEMULTIPLEXER_NO_RESULTS, grpc::StatusCode::ABORTED},
         // ALREADY_EXISTS
         {StatusCode::SEQUENCE_ALREADY_EXISTS, grpc::StatusCode::ALREADY_EXISTS},
+        // RESOURCE_EXHAUSTED
+        {StatusCode::INFER_QUEUE_OVERLOADED, grpc::StatusCode::RESOURCE_EXHAUSTED},
+        // DEADLINE_EXCEEDED
+        {StatusCode::REQUEST_DEADLINE_EXCEEDED, grpc::StatusCode::DEADLINE_EXCEEDED},
+        // CANCELLED
+        {StatusCode::REQUEST_CANCELLED, grpc::StatusCode::CANCELLED},
+        {StatusCode::STREAM_CLOSED_BEFORE_FIRST_REQUEST, grpc::StatusCode::CANCELLED},
         // UNAVAILABLE
         {StatusCode::MAX_SEQUENCE_NUMBER_REACHED, grpc::StatusCode::UNAVAILABLE},
         {StatusCode::MODEL_VERSION_NOT_LOADED_YET, grpc::StatusCode::UNAVAILABLE},
@@ -113,4 +124,16 @@ const grpc::Status grpc(const Status& status) {
         return grpc::Status(grpc::StatusCode::UNKNOWN, "Unknown error");
     }
 }
+
+void propagateDeadlineAndCancellation(const ::grpc::ServerContext* serverContext, ExecutionContext& executionContext) {
+    if (serverContext == nullptr) {
+        return;
+    }
+    const auto deadline = serverContext->deadline();
+    if (deadline != std::chrono::system_clock::time_point::max()) {
+        executionContext.deadline = std::chrono::steady_clock::now() +
+                                    std::chrono::duration_cast<std::chrono::steady_clock::duration>(deadline - std::chrono::system_clock::now());
+    }
+    executionContext.cancellationCheck = [serverContext]() { return serverContext->IsCancelled(); };
+}
 }  // namespace ovms
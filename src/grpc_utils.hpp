@@ -17,7 +17,13 @@
 #include <grpcpp/server_context.h>
 
 namespace ovms {
+struct ExecutionContext;
 class Status;
 
 const grpc::Status grpc(const Status& status);
+
+/**
+ * @brief Propagates deadline and cancellation of gRPC call into execution context of the request
+ */
+void propagateDeadlineAndCancellation(const ::grpc::ServerContext* serverContext, ExecutionContext& executionContext);
 }  // namespace ovms
@@ -46,6 +46,7 @@
 #include "modelinstanceunloadguard.hpp"
 #include "modelmanager.hpp"
 #include "prediction_service_utils.hpp"
+#include "profiler.hpp"
 #include "rest_parser.hpp"
 #include "rest_utils.hpp"
 #include "servablemanagermodule.hpp"
@@ -77,7 +78,7 @@ const std::string HttpRestApiHandler::predictionRegexExp =
 const std::string HttpRestApiHandler::modelstatusRegexExp =
     R"((.?)\/v1\/models(?:\/([^\/:]+))?(?:(?:\/versions\/(\d+))|(?:\/labels\/(\w+)))?(?:\/(metadata))?)";
 const std::string HttpRestApiHandler::configReloadRegexExp = R"((.?)\/v1\/config\/reload)";
-const std::string HttpRestApiHandler::configStatusRegexExp = R"((.?)\/v1\/config)";
+const std::string HttpRestApiHandler::configStatusRegexExp = R"((.?)\/v1\/config(\?memory=(true|false))?)";
 
 const std::string HttpRestApiHandler::kfs_modelreadyRegexExp =
     R"(/v2/models/([^/]+)(?:/versions/([0-9]+))?(?:/(ready)))";
@@ -93,6 +94,7 @@ const std::string HttpRestApiHandler::kfs_servermetadataRegexExp =
     R"(/v2)";
 
 const std::string HttpRestApiHandler::metricsRegexExp = R"((.?)\/metrics(\?(.*))?)";
+const std::string HttpRestApiHandler::traceRegexExp = R"((.?)\/v1\/trace(\?seconds=(.*))?)";
 
 HttpRestApiHandler::HttpRestApiHandler(ovms::Server& ovmsServer, int timeout_in_ms) :
     predictionRegex(predictionRegexExp),
@@ -106,6 +108,7 @@ HttpRestApiHandler::HttpRestApiHandler(ovms::Server& ovmsServer, int timeout_in_
     kfs_serverliveRegex(kfs_serverliveRegexExp),
     kfs_servermetadataRegex(kfs_servermetadataRegexExp),
     metricsRegex(metricsRegexExp),
+    traceRegex(traceRegexExp),
     timeout_in_ms(timeout_in_ms),
     ovmsServer(ovmsServer),
 
@@ -160,7 +163,7 @@ void HttpRestApiHandler::registerAll() {
         return processConfigReloadRequest(response, this->modelManager);
     });
     registerHandler(ConfigStatus, [this](const HttpRequestComponents& request_components, std::string& response, const std::string& request_body, HttpResponseComponents& response_components) -> Status {
-        return processConfigStatusRequest(response, this->modelManager);
+        return processConfigStatusRequest(response, this->modelManager, request_components.config_status_memory);
     });
     registerHandler(KFS_GetModelReady, [this](const HttpRequestComponents& request_components, std::string& response, const std::string& request_body, HttpResponseComponents& response_components) -> Status {
         return processModelReadyKFSRequest(request_components, response, request_body);
@@ -183,6 +186,9 @@ void HttpRestApiHandler::registerAll() {
     registerHandler(Metrics, [this](const HttpRequestComponents& request_components, std::string& response, const std::string& request_body, HttpResponseComponents& response_components) -> Status {
         return processMetrics(request_components, response, request_body);
     });
+    registerHandler(Trace, [this](const HttpRequestComponents& request_components, std::string& response, const std::string& request_body, HttpResponseComponents& response_components) -> Status {
+        return processTrace(request_components, response, request_body);
+    });
 }
 
 Status HttpRestApiHandler::processServerReadyKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body) {
@@ -381,6 +387,7 @@ Status HttpRestApiHandler::processInferKFSRequest(const HttpRequestComponents& r
     using std::chrono::microseconds;
     auto status = prepareGrpcRequest(modelName, request_components.model_version, request_body, grpc_request, request_components.inferenceHeaderContentLength);
     ExecutionContext executionContext{ExecutionContext::Interface::REST, ExecutionContext::Method::ModelInfer};
+    executionContext.deadline = request_components.deadline;
     if (!status.ok()) {
         auto pstatus = this->getReporter(request_components, reporter);
         if (pstatus.ok()) {
@@ -438,11 +445,31 @@ Status HttpRestApiHandler::processMetrics(const HttpRequestComponents& request_c
     }
 
     auto metricModule = dynamic_cast<const MetricModule*>(module);
-    response = metricModule->getRegistry().collect();
+    response = metricModule->getRegistry().collect(request_components.metric_names);
 
     return StatusCode::OK;
 }
 
+Status HttpRestApiHandler::processTrace(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body) {
+    auto& tracer = Tracer::instance();
+    if (request_components.http_method == "GET") {
+        response = tracer.dump(request_components.trace_seconds.value_or(Tracer::DEFAULT_DUMP_SECONDS));
+        return StatusCode::OK;
+    }
+    rapidjson::Document doc;
+    if (doc.Parse(request_body.c_str()).HasParseError() || !doc.IsObject()) {
+        return StatusCode::REST_BODY_IS_NOT_AN_OBJECT;
+    }
+    auto it = doc.FindMember("sampling_rate");
+    if (it == doc.MemberEnd() || !it->value.IsUint()) {
+        SPDLOG_DEBUG("Trace request body has to contain non negative integer sampling_rate");
+        return StatusCode::REST_COULD_NOT_PARSE_PARAMETERS;
+    }
+    tracer.setSamplingRate(it->value.GetUint());
+    response = "{\"sampling_rate\": " + std::to_string(tracer.getSamplingRate()) + "}";
+    return StatusCode::OK;
+}
+
 Status HttpRestApiHandler::processModelReadyKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body) {
     ::KFSGetModelStatusRequest grpc_request;
     ::KFSGetModelStatusResponse grpc_response;
@@ -526,6 +553,34 @@ static Status parseInferenceHeaderContentLength(HttpRequestComponents& requestCo
     return StatusCode::OK;
 }
 
+static Status parseRequestTimeout(HttpRequestComponents& requestComponents,
+    const std::vector<std::pair<std::string, std::string>>& headers) {
+    for (auto& header : headers) {
+        if (header.first == "Request-Timeout-Ms") {
+            auto timeout = stou32(header.second);
+            if (!timeout.has_value() || timeout.value() == 0) {
+                return StatusCode::REST_REQUEST_TIMEOUT_INVALID;
+            }
+            requestComponents.deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout.value());
+        }
+    }
+    return StatusCode::OK;
+}
+
+static void parseMetricNames(const std::string& params, std::set<std::string>& metricNames) {
+    for (const auto& param : tokenize(params, '&')) {
+        auto separator = param.find('=');
+        if (separator != std::string::npos) {
+            std::string key = param.substr(0, separator);
+            if (key == "name[]" || key == "name%5B%5D" || key == "name%5b%5d") {
+                metricNames.insert(param.substr(separator + 1));
+                continue;
+            }
+        }
+        SPDLOG_DEBUG("Discarded following url parameter: {}", param);
+    }
+}
+
 Status HttpRestApiHandler::parseRequestComponents(HttpRequestComponents& requestComponents,
     const std::string_view http_method,
     const std::string& request_path,
@@ -569,6 +624,9 @@ Status HttpRestApiHandler::parseRequestComponents(HttpRequestComponents& request
                 return status;
 
             status = parseInferenceHeaderContentLength(requestComponents, headers);
+            if (!status.ok())
+                return status;
+            status = parseRequestTimeout(requestComponents, headers);
             if (!status.ok())
                 return status;
             return StatusCode::OK;
@@ -577,6 +635,10 @@ Status HttpRestApiHandler::parseRequestComponents(HttpRequestComponents& request
             requestComponents.type = ConfigReload;
             return StatusCode::OK;
         }
+        if (std::regex_match(request_path, sm, traceRegex)) {
+            requestComponents.type = Trace;
+            return StatusCode::OK;
+        }
         return (std::regex_match(request_path, sm, modelstatusRegex) ||
                    std::regex_match(request_path, sm, kfs_serverliveRegex) ||
                    std::regex_match(request_path, sm, configStatusRegex) ||
@@ -611,6 +673,7 @@ Status HttpRestApiHandler::parseRequestComponents(HttpRequestComponents& request
         }
         if (std::regex_match(request_path, sm, configStatusRegex)) {
             requestComponents.type = ConfigStatus;
+            requestComponents.config_status_memory = (sm[3] == "true");
             return StatusCode::OK;
         }
         if (std::regex_match(request_path, sm, kfs_serverliveRegex)) {
@@ -647,12 +710,22 @@ Status HttpRestApiHandler::parseRequestComponents(HttpRequestComponents& request
             return StatusCode::REST_UNSUPPORTED_METHOD;
         if (std::regex_match(request_path, sm, metricsRegex)) {
             std::string params = sm[3];
-            if (!params.empty()) {
-                SPDLOG_DEBUG("Discarded following url parameters: {}", params);
-            }
+            parseMetricNames(params, requestComponents.metric_names);
             requestComponents.type = Metrics;
             return StatusCode::OK;
         }
+        if (std::regex_match(request_path, sm, traceRegex)) {
+            std::string seconds = sm[3];
+            if (!seconds.empty()) {
+                requestComponents.trace_seconds = stou32(seconds);
+                if (!requestComponents.trace_seconds.has_value()) {
+                    SPDLOG_DEBUG("Couldn't parse trace seconds: {}", seconds);
+                    return StatusCode::REST_INVALID_URL;
+                }
+            }
+            requestComponents.type = Trace;
+            return StatusCode::OK;
+        }
         return (std::regex_match(request_path, sm, predictionRegex) ||
                    std::regex_match(request_path, sm, kfs_inferRegex, std::regex_constants::match_any) ||
                    std::regex_match(request_path, sm, configReloadRegex))
@@ -696,6 +769,8 @@ Status HttpRestApiHandler::processPredictRequest(
     const std::string& request,
     std::string* response) {
     // model_version_label currently is not in use
+    TraceRequestGuard traceRequestGuard;
+    OVMS_PROFILE_FUNCTION();
 
     Timer<TIMER_END> timer;
     timer.start(TOTAL);
@@ -979,7 +1054,7 @@ Status HttpRestApiHandler::processConfigReloadRequest(std::string& response, Mod
     return StatusCode::OK_RELOADED;
 }
 
-Status HttpRestApiHandler::processConfigStatusRequest(std::string& response, ModelManager& manager) {
+Status HttpRestApiHandler::processConfigStatusRequest(std::string& response, ModelManager& manager, bool includeMemory) {
     SPDLOG_DEBUG("Processing config status request started.");
     Status status;
 
@@ -990,7 +1065,16 @@ Status HttpRestApiHandler::processConfigStatusRequest(std::string& response, Mod
         return status;
     }
 
-    status = GetModelStatusImpl::serializeModelsStatuses2Json(modelsStatuses, response);
+    models_memory_usage_t modelsMemoryUsage;
+    if (includeMemory) {
+        status = GetModelStatusImpl::getAllModelsMemoryUsage(modelsMemoryUsage, manager);
+        if (!status.ok()) {
+            response = createErrorJsonWithMessage("Retrieving models memory usage failed.");
+            return status;
+        }
+    }
+
+    status = GetModelStatusImpl::serializeModelsStatuses2Json(modelsStatuses, response, includeMemory ? &modelsMemoryUsage : nullptr);
     if (!status.ok()) {
         response = createErrorJsonWithMessage("Serializing model statuses to json failed.");
         return status;
@@ -15,9 +15,11 @@
 //*****************************************************************************
 #pragma once
 
+#include <chrono>
 #include <functional>
 #include <map>
 #include <regex>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -48,7 +50,8 @@ enum RequestType { Predict,
     KFS_GetServerReady,
     KFS_GetServerLive,
     KFS_GetServerMetadata,
-    Metrics };
+    Metrics,
+    Trace };
 
 struct HttpRequestComponents {
     RequestType type;
@@ -59,6 +62,10 @@ struct HttpRequestComponents {
     std::string processing_method;
     std::string model_subresource;
     std::optional<int> inferenceHeaderContentLength;
+    std::optional<std::chrono::steady_clock::time_point> deadline;
+    std::optional<uint32_t> trace_seconds;
+    bool config_status_memory = false;
+    std::set<std::string> metric_names;
 };
 
 struct HttpResponseComponents {
@@ -77,6 +84,7 @@ public:
     static const std::string kfs_inferRegexExp;
 
     static const std::string metricsRegexExp;
+    static const std::string traceRegexExp;
 
     static const std::string kfs_serverreadyRegexExp;
     static const std::string kfs_serverliveRegexExp;
@@ -193,12 +201,33 @@ public:
 
     void convertShapeType(rapidjson::Value& scope, rapidjson::Document& doc);
 
-    Status processConfigStatusRequest(std::string& response, ModelManager& manager);
+    Status processConfigStatusRequest(std::string& response, ModelManager& manager, bool includeMemory = false);
     Status processModelMetadataKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body);
     Status processModelReadyKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body);
     Status processInferKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body, std::optional<int>& inferenceHeaderContentLength);
+    /**
+     * @brief Process metrics request. Families can be selected with name[]=<family> url parameters.
+     *
+     * @param request_components
+     * @param response
+     * @param request_body
+     *
+     * @return StatusCode
+     */
     Status processMetrics(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body);
 
+    /**
+     * @brief Process request tracer endpoint. GET returns traces of sampled requests from the last seconds
+     * in Chrome trace format, POST sets request sampling rate.
+     *
+     * @param request_components request components
+     * @param response
+     * @param request_body POST body with sampling rate: {"sampling_rate": N}
+     *
+     * @return StatusCode
+     */
+    Status processTrace(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body);
+
     Status processServerReadyKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body);
     Status processServerLiveKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body);
     Status processServerMetadataKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body);
@@ -218,6 +247,7 @@ private:
     const std::regex kfs_servermetadataRegex;
 
     const std::regex metricsRegex;
+    const std::regex traceRegex;
 
     std::map<RequestType, std::function<Status(const HttpRequestComponents&, std::string&, const std::string&, HttpResponseComponents&)>> handlers;
     int timeout_in_ms;
@@ -40,7 +40,7 @@ namespace ovms {
 
 namespace net_http = tensorflow::serving::net_http;
 
-static const net_http::HTTPStatusCode http(const ovms::Status& status) {
+const net_http::HTTPStatusCode http(const ovms::Status& status) {
     const std::unordered_map<const StatusCode, net_http::HTTPStatusCode> httpStatusMap = {
         {StatusCode::OK, net_http::HTTPStatusCode::OK},
         {StatusCode::OK_RELOADED, net_http::HTTPStatusCode::CREATED},
@@ -70,6 +70,7 @@ static const net_http::HTTPStatusCode http(const ovms::Status& status) {
         {StatusCode::REST_UNSUPPORTED_PRECISION, net_http::HTTPStatusCode::BAD_REQUEST},
         {StatusCode::REST_SERIALIZE_TENSOR_CONTENT_INVALID_SIZE, net_http::HTTPStatusCode::ERROR},
         {StatusCode::REST_BINARY_BUFFER_EXCEEDED, net_http::HTTPStatusCode::BAD_REQUEST},
+        {StatusCode::REST_REQUEST_TIMEOUT_INVALID, net_http::HTTPStatusCode::BAD_REQUEST},
 
         {StatusCode::PATH_INVALID, net_http::HTTPStatusCode::BAD_REQUEST},
         {StatusCode::FILE_INVALID, net_http::HTTPStatusCode::ERROR},
@@ -95,6 +96,7 @@ static const net_http::HTTPStatusCode http(const ovms::Status& status) {
         {StatusCode::INVALID_SIGNATURE_DEF, net_http::HTTPStatusCode::BAD_REQUEST},
         {StatusCode::PIPELINE_DEMULTIPLEXER_NO_RESULTS, net_http::HTTPStatusCode::NO_CONTENT},
         {StatusCode::CANNOT_COMPILE_MODEL_INTO_TARGET_DEVICE, net_http::HTTPStatusCode::PRECOND_FAILED},
+        {StatusCode::MODEL_MEMORY_LIMIT_EXCEEDED, net_http::HTTPStatusCode::PRECOND_FAILED},
 
         // Sequence management
         {StatusCode::SEQUENCE_MISSING, net_http::HTTPStatusCode::NOT_FOUND},
@@ -118,6 +120,7 @@ static const net_http::HTTPStatusCode http(const ovms::Status& status) {
         {StatusCode::INVALID_DEVICE_ID, net_http::HTTPStatusCode::BAD_REQUEST},
         {StatusCode::INVALID_STRING_INPUT, net_http::HTTPStatusCode::BAD_REQUEST},
         {StatusCode::INVALID_INPUT_FORMAT, net_http::HTTPStatusCode::BAD_REQUEST},
+        {StatusCode::INVALID_PRIORITY, net_http::HTTPStatusCode::BAD_REQUEST},
         {StatusCode::INVALID_PRECISION, net_http::HTTPStatusCode::BAD_REQUEST},
         {StatusCode::INVALID_VALUE_COUNT, net_http::HTTPStatusCode::BAD_REQUEST},
         {StatusCode::INVALID_CONTENT_SIZE, net_http::HTTPStatusCode::BAD_REQUEST},
@@ -132,6 +135,9 @@ static const net_http::HTTPStatusCode http(const ovms::Status& status) {
 
         // Inference
         {StatusCode::OV_INTERNAL_INFERENCE_ERROR, net_http::HTTPStatusCode::ERROR},
+        {StatusCode::INFER_QUEUE_OVERLOADED, net_http::HTTPStatusCode::SERVICE_UNAV},
+        {StatusCode::REQUEST_DEADLINE_EXCEEDED, net_http::HTTPStatusCode::GATEWAY_TO},
+        {StatusCode::REQUEST_CANCELLED, net_http::HTTPStatusCode::REQUEST_TO},
 
         // Serialization
 
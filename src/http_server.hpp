@@ -20,14 +20,18 @@
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wall"
+#include "tensorflow_serving/util/net_http/public/response_code_enum.h"
 #include "tensorflow_serving/util/net_http/server/public/httpserver_interface.h"
 #pragma GCC diagnostic pop
 
 namespace ovms {
 class Server;
+class Status;
 
 using http_server = tensorflow::serving::net_http::HTTPServerInterface;
 
+const tensorflow::serving::net_http::HTTPStatusCode http(const ovms::Status& status);
+
 /**
  * @brief Creates a and starts Http Server
  * 
@@ -15,13 +15,19 @@
 //*****************************************************************************
 #include "kfs_grpc_inference_service.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
+#include "../bounded_executor.hpp"
 #include "../dags/pipeline.hpp"
 #include "../dags/pipelinedefinition.hpp"
 #include "../dags/pipelinedefinitionstatus.hpp"
@@ -282,12 +288,14 @@ Status KFSInferenceServiceImpl::ModelMetadataImpl(::grpc::ServerContext* context
 }
 
 Status KFSInferenceServiceImpl::ModelInferImpl(::grpc::ServerContext* context, const KFSRequest* request, KFSResponse* response, ExecutionContext executionContext, ServableMetricReporter*& reporterOut) {
+    TraceRequestGuard traceRequestGuard;
     OVMS_PROFILE_FUNCTION();
     std::shared_ptr<ovms::ModelInstance> modelInstance;
     std::unique_ptr<ovms::Pipeline> pipelinePtr;
 
     std::unique_ptr<ModelInstanceUnloadGuard> modelInstanceUnloadGuard;
     SPDLOG_DEBUG("ModelInfer requested name: {}, version: {}", request->model_name(), request->model_version());
+    propagateDeadlineAndCancellation(context, executionContext);
     auto status = getModelInstance(request, modelInstance, modelInstanceUnloadGuard);
     if (status == StatusCode::MODEL_NAME_MISSING) {
         SPDLOG_DEBUG("Requested model: {} does not exist. Searching for pipeline with that name...", request->model_name());
@@ -319,7 +327,7 @@ Status KFSInferenceServiceImpl::ModelInferImpl(::grpc::ServerContext* context, c
         status = pipelinePtr->execute(executionContext);
     } else if (modelInstance) {
         reporterOut = &modelInstance->getMetricReporter();
-        status = modelInstance->infer(request, response, modelInstanceUnloadGuard);
+        status = modelInstance->infer(request, response, modelInstanceUnloadGuard, &executionContext);
     }
     INCREMENT_IF_ENABLED(reporterOut->getInferRequestMetric(executionContext, status.ok()));
     if (!status.ok()) {
@@ -329,24 +337,136 @@ Status KFSInferenceServiceImpl::ModelInferImpl(::grpc::ServerContext* context, c
     return StatusCode::OK;
 }
 
+// Upper bound of requests in flight for single stream, regardless of configured nireq
+const uint32_t MAX_STREAM_IN_FLIGHT_REQUESTS = 128;
+
+Status KFSInferenceServiceImpl::getStreamMaxInFlightRequests(const KFSRequest& request, uint32_t& maxInFlightRequests) {
+    std::shared_ptr<ovms::ModelInstance> modelInstance;
+    std::unique_ptr<ModelInstanceUnloadGuard> modelInstanceUnloadGuard;
+    auto status = getModelInstance(&request, modelInstance, modelInstanceUnloadGuard);
+    if (status.ok()) {
+        // there is no gain in having more requests in flight than infer requests available
+        maxInFlightRequests = static_cast<uint32_t>(modelInstance->getInferRequestsQueue().size());
+    } else if (status == StatusCode::MODEL_NAME_MISSING) {
+        if (!this->modelManager.getPipelineFactory().definitionExists(request.model_name())) {
+            return StatusCode::PIPELINE_DEFINITION_NAME_MISSING;
+        }
+        // pipeline nodes may use several models, each with its own nireq
+        maxInFlightRequests = std::thread::hardware_concurrency();
+    } else {
+        return status;
+    }
+    maxInFlightRequests = std::clamp(maxInFlightRequests, 1u, MAX_STREAM_IN_FLIGHT_REQUESTS);
+    return StatusCode::OK;
+}
+
+BoundedExecutor& KFSInferenceServiceImpl::getStreamExecutor() {
+    std::call_once(streamExecutorFlag, [this]() {
+        const size_t threadsCount = std::max(1u, std::thread::hardware_concurrency());
+        SPDLOG_DEBUG("Starting {} threads serving KServe streams", threadsCount);
+        this->streamExecutor = std::make_unique<BoundedExecutor>(threadsCount, threadsCount);
+    });
+    return *this->streamExecutor;
+}
+
+static bool streamSynchronizedWrite(::grpc::ServerReaderWriterInterface<::inference::ModelStreamInferResponse, KFSRequest>& stream,
+    std::mutex& mtx, ::inference::ModelStreamInferResponse& resp) {
+    const std::lock_guard<std::mutex> lock(mtx);
+    return stream.Write(resp);
+}
+
+Status KFSInferenceServiceImpl::inferStream(::grpc::ServerContext* context, const KFSRequest& firstRequest, uint32_t maxInFlightRequests, ::grpc::ServerReaderWriterInterface<::inference::ModelStreamInferResponse, KFSRequest>& stream) {
+    SPDLOG_DEBUG("Start streaming KServe request servable: {} execution with up to: {} requests in flight", firstRequest.model_name(), maxInFlightRequests);
+    // Stream thread only reads requests, which are deserialized, inferred and serialized by executor shared by all streams.
+    // Reading is paused while maxInFlightRequests are processed, and when executor queue is full.
+    // gRPC allows one concurrent Write per stream, hence writer mutex.
+    BoundedExecutor& executor = getStreamExecutor();
+    std::mutex streamWriterMutex;
+    std::atomic<bool> streamFinished{false};
+    std::mutex inFlightMutex;
+    std::condition_variable inFlightCv;
+    uint32_t inFlightRequests = 0;
+    auto process = [this, context, &stream, &streamWriterMutex, &streamFinished](const KFSRequest& request) {
+        Timer<TIMER_END> timer;
+        timer.start(TOTAL);
+        ::inference::ModelStreamInferResponse resp;
+        ServableMetricReporter* reporter = nullptr;
+        Status status;
+        try {
+            status = this->ModelInferImpl(context, &request, resp.mutable_infer_response(), ExecutionContext{ExecutionContext::Interface::GRPC, ExecutionContext::Method::ModelInfer}, reporter);
+        } catch (const std::exception& e) {
+            SPDLOG_ERROR("Caught exception in streaming InferenceServiceImpl for servable: {} exception: {}", request.model_name(), e.what());
+            status = Status(StatusCode::UNKNOWN_ERROR, e.what());
+        } catch (...) {
+            SPDLOG_ERROR("Caught unknown exception in streaming InferenceServiceImpl for servable: {}", request.model_name());
+            status = Status(StatusCode::UNKNOWN_ERROR);
+        }
+        timer.stop(TOTAL);
+        if (!status.ok()) {
+            resp.Clear();
+            *resp.mutable_error_message() = status.string();
+        } else if (reporter) {
+            OBSERVE_IF_ENABLED(reporter->requestTimeGrpc, timer.elapsed<std::chrono::microseconds>(TOTAL));
+        }
+        if (!streamSynchronizedWrite(stream, streamWriterMutex, resp)) {
+            SPDLOG_DEBUG("Writing response to disconnected client for servable: {}", request.model_name());
+            streamFinished = true;
+        }
+    };
+    auto submit = [&executor, &process, &inFlightMutex, &inFlightCv, &inFlightRequests, maxInFlightRequests](std::shared_ptr<const KFSRequest> request) {
+        {
+            std::unique_lock<std::mutex> lock(inFlightMutex);
+            inFlightCv.wait(lock, [&]() { return inFlightRequests < maxInFlightRequests; });
+            ++inFlightRequests;
+        }
+        executor.submit([&process, &inFlightMutex, &inFlightCv, &inFlightRequests, request]() {
+            process(*request);
+            // Notified under lock since stream thread destroys condition variable as soon as the last request is done
+            std::lock_guard<std::mutex> lock(inFlightMutex);
+            --inFlightRequests;
+            inFlightCv.notify_all();
+        });
+    };
+    submit(std::make_shared<const KFSRequest>(firstRequest));
+    auto request = std::make_shared<KFSRequest>();
+    while (!streamFinished && stream.Read(request.get())) {
+        submit(std::move(request));
+        request = std::make_shared<KFSRequest>();
+    }
+    std::unique_lock<std::mutex> lock(inFlightMutex);
+    inFlightCv.wait(lock, [&inFlightRequests]() { return inFlightRequests == 0; });
+    SPDLOG_DEBUG("Finished streaming KServe request servable: {} execution", firstRequest.model_name());
+    return StatusCode::OK;
+}
+
 Status KFSInferenceServiceImpl::ModelStreamInferImpl(::grpc::ServerContext* context, ::grpc::ServerReaderWriterInterface<::inference::ModelStreamInferResponse, ::inference::ModelInferRequest>* stream) {
     OVMS_PROFILE_FUNCTION();
-#if (MEDIAPIPE_DISABLE == 0)
     ::inference::ModelInferRequest firstRequest;
     if (!stream->Read(&firstRequest)) {
-        Status status = StatusCode::MEDIAPIPE_UNINITIALIZED_STREAM_CLOSURE;
+        Status status = StatusCode::STREAM_CLOSED_BEFORE_FIRST_REQUEST;
         SPDLOG_DEBUG(status.string());
         return status;
     }
+    uint32_t maxInFlightRequests = 1;
+    auto status = getStreamMaxInFlightRequests(firstRequest, maxInFlightRequests);
+    if (status.ok()) {
+        return inferStream(context, firstRequest, maxInFlightRequests, *stream);
+    }
+    if (status != StatusCode::PIPELINE_DEFINITION_NAME_MISSING) {
+        SPDLOG_DEBUG("Getting modelInstance or pipeline for streaming failed. {}", status.string());
+        return status;
+    }
+#if (MEDIAPIPE_DISABLE == 0)
+    SPDLOG_DEBUG("Requested DAG: {} does not exist. Searching for mediapipe graph with that name...", firstRequest.model_name());
     std::shared_ptr<MediapipeGraphExecutor> executor;
-    auto status = this->modelManager.createPipeline(executor, firstRequest.model_name(), &firstRequest, nullptr /* response not present in streaming api */);
+    status = this->modelManager.createPipeline(executor, firstRequest.model_name(), &firstRequest, nullptr /* response not present in streaming api */);
     if (!status.ok()) {
         return status;
     }
     return executor->inferStream(firstRequest, *stream);
 #else
-    SPDLOG_DEBUG("Mediapipe support was disabled during build process...");
-    return StatusCode::NOT_IMPLEMENTED;
+    SPDLOG_DEBUG("Requested DAG: {} does not exist. Mediapipe support was disabled during build process...", firstRequest.model_name());
+    return status;
 #endif
 }
 
@@ -427,6 +547,8 @@ KFSInferenceServiceImpl::KFSInferenceServiceImpl(const Server& server) :
     }
 }
 
+KFSInferenceServiceImpl::~KFSInferenceServiceImpl() = default;
+
 Status KFSInferenceServiceImpl::buildResponse(
     PipelineDefinition& pipelineDefinition,
     KFSModelMetadataResponse* response) {
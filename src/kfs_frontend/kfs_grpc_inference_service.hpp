@@ -16,6 +16,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 
@@ -41,6 +42,7 @@ using KFSInputTensorIteratorType = google::protobuf::internal::RepeatedPtrIterat
 using KFSOutputTensorIteratorType = google::protobuf::internal::RepeatedPtrIterator<const ::inference::ModelInferResponse_InferOutputTensor>;
 
 namespace ovms {
+class BoundedExecutor;
 class ExecutionContext;
 class MediapipeGraphDefinition;
 class Model;
@@ -58,6 +60,9 @@ class KFSInferenceServiceImpl : public GRPCInferenceService::Service {
 protected:
     const Server& ovmsServer;
     ModelManager& modelManager;
+    // Shared by all streams targeting models and DAG pipelines, created with the first such stream
+    std::once_flag streamExecutorFlag;
+    std::unique_ptr<BoundedExecutor> streamExecutor;
 
 public:
     Status ModelReadyImpl(::grpc::ServerContext* context, const KFSGetModelStatusRequest* request, KFSGetModelStatusResponse* response, ExecutionContext executionContext);
@@ -66,6 +71,7 @@ public:
     Status ModelInferImpl(::grpc::ServerContext* context, const KFSRequest* request, KFSResponse* response, ExecutionContext executionContext, ServableMetricReporter*& reporterOut);
     Status ModelStreamInferImpl(::grpc::ServerContext* context, ::grpc::ServerReaderWriterInterface<::inference::ModelStreamInferResponse, ::inference::ModelInferRequest>* stream);
     KFSInferenceServiceImpl(const Server& server);
+    ~KFSInferenceServiceImpl();
     ::grpc::Status ServerLive(::grpc::ServerContext* context, const ::inference::ServerLiveRequest* request, ::inference::ServerLiveResponse* response) override;
     ::grpc::Status ServerReady(::grpc::ServerContext* context, const ::inference::ServerReadyRequest* request, ::inference::ServerReadyResponse* response) override;
     ::grpc::Status ModelReady(::grpc::ServerContext* context, const KFSGetModelStatusRequest* request, KFSGetModelStatusResponse* response) override;
@@ -89,6 +95,9 @@ protected:
     Status getPipeline(const KFSRequest* request,
         KFSResponse* response,
         std::unique_ptr<ovms::Pipeline>& pipelinePtr);
+    Status getStreamMaxInFlightRequests(const KFSRequest& request, uint32_t& maxInFlightRequests);
+    BoundedExecutor& getStreamExecutor();
+    Status inferStream(::grpc::ServerContext* context, const KFSRequest& firstRequest, uint32_t maxInFlightRequests, ::grpc::ServerReaderWriterInterface<::inference::ModelStreamInferResponse, ::inference::ModelInferRequest>& stream);
 };
 
 }  // namespace ovms
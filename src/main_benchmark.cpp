@@ -14,29 +14,47 @@
 // limitations under the License.
 //*****************************************************************************
 #include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cstring>
+#include <fstream>
 #include <future>
 #include <iomanip>
 #include <iostream>
+#include <memory>
 #include <numeric>
 #include <optional>
 #include <random>
 #include <sstream>
+#include <string>
 #include <thread>
 #include <vector>
 
 #include <cxxopts.hpp>
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
 #include <signal.h>
 #include <stdio.h>
 #include <sysexits.h>
 
+#include "benchmark/benchmark_results.hpp"
+#include "benchmark/benchmark_scenario.hpp"
+#include "benchmark/latency_histogram.hpp"
 #include "capi_frontend/capi_utils.hpp"
 #include "ovms.h"  // NOLINT
 #include "stringutils.hpp"
 
 namespace {
 
-using signed_shape_t = std::vector<int64_t>;
+using ovms::benchmark::ArrivalMode;
+using ovms::benchmark::BenchmarkInput;
+using ovms::benchmark::BenchmarkScenario;
+using ovms::benchmark::BenchmarkStream;
+using ovms::benchmark::LatencyHistogram;
+using ovms::benchmark::WorkloadMode;
+using ovms::benchmark::writeHistogram;
+using clock_type = std::chrono::steady_clock;
+
 class BenchmarkCLIParser {
     std::unique_ptr<cxxopts::Options> options;
 
@@ -45,7 +63,6 @@ public:
 
     BenchmarkCLIParser() = default;
     void parse(int argc, char** argv);
-    void prepare(OVMS_ServerSettings*, OVMS_ModelsSettings*);
 };
 
 void BenchmarkCLIParser::parse(int argc, char** argv) {
@@ -70,12 +87,25 @@ void BenchmarkCLIParser::parse(int argc, char** argv) {
                 cxxopts::value<std::string>()->default_value("ERROR"),
                 "LOG_LEVEL")
             ("config_path",
-                "Config file path for OVMS to read",
+                "Config file path for OVMS to read. Overrides config_path of the scenario",
                 cxxopts::value<std::string>()->default_value("/ovms/src/test/c_api/config_benchmark.json"),
                 "CONFIG_PATH")
-// benchmark options
+            // scenario options
+            ("scenario",
+                "Path to JSON scenario file describing load sent to one or more servables. When set, single servable options are ignored",
+                cxxopts::value<std::string>(),
+                "SCENARIO")
+            ("output",
+                "Path to file in which JSON results are saved",
+                cxxopts::value<std::string>(),
+                "OUTPUT")
+            ("label",
+                "Label stored in JSON results, for example commit id",
+                cxxopts::value<std::string>()->default_value(""),
+                "LABEL")
+            // benchmark options
             ("niter",
-                "number of inferences to conduct",
+                "number of inferences to conduct in closed loop",
                 cxxopts::value<uint32_t>()->default_value("1000"),
                 "NITER")
             ("nireq",
@@ -86,6 +116,22 @@ void BenchmarkCLIParser::parse(int argc, char** argv) {
                 "maximum workload threads per ireq",
                 cxxopts::value<uint32_t>()->default_value("2"),
                 "THREADS_PER_IREQ")
+            ("arrival",
+                "Requests arrival. Possible values: CLOSED, CONSTANT, POISSON",
+                cxxopts::value<std::string>()->default_value("CLOSED"),
+                "ARRIVAL")
+            ("rate",
+                "Requests per second. Required for CONSTANT and POISSON arrival",
+                cxxopts::value<double>()->default_value("0"),
+                "RATE")
+            ("duration",
+                "Measured workload duration in seconds. Required for CONSTANT and POISSON arrival, in closed loop replaces niter",
+                cxxopts::value<double>()->default_value("0"),
+                "DURATION")
+            ("warmup",
+                "Warmup duration in seconds, requests sent during warmup are not measured",
+                cxxopts::value<double>()->default_value("0"),
+                "WARMUP")
             // inference data
             ("servable_name",
                 "Model name to sent request to",
@@ -100,7 +146,7 @@ void BenchmarkCLIParser::parse(int argc, char** argv) {
                 cxxopts::value<std::string>(),
                 "INPUTS_NAMES")
             ("shape",
-                "Semicolon separated list of inputs names followed by their shapes in brackers. For example: \"inputA[1,3,224,224],inputB[1,10]\"",
+                "Semicolon separated list of inputs names followed by their shapes in brackets. For example: \"inputA[1,3,224,224];inputB[1,10]\"",
                 cxxopts::value<std::string>(),
                 "SHAPE")
             ("mode",
@@ -111,6 +157,7 @@ void BenchmarkCLIParser::parse(int argc, char** argv) {
                 "Random values generator seed.",
                 cxxopts::value<uint64_t>(),
                 "SEED");
+        // clang-format on
 
         result = std::make_unique<cxxopts::ParseResult>(options->parse(argc, argv));
 
@@ -124,35 +171,6 @@ void BenchmarkCLIParser::parse(int argc, char** argv) {
     }
 }
 
-signed_shape_t parseShapes(const std::string& cliInputShapes) {
-    auto inputShapes = ovms::tokenize(cliInputShapes, ';');
-    if (inputShapes.size() != 1) {
-        std::cout << __LINE__ << std::endl;
-        throw std::invalid_argument("Invalid shape argument");
-    }
-    std::string firstShape = inputShapes[0];
-    size_t leftBracket = firstShape.find("[");
-    size_t rightBracket = firstShape.find("]");
-    if ((leftBracket == std::string::npos) ||
-        (rightBracket == std::string::npos) ||
-        (leftBracket > rightBracket)) {
-        std::cout << __LINE__ << std::endl;
-        throw std::invalid_argument("Invalid shape argument");
-    }
-    std::string shapeString = firstShape.substr(leftBracket + 1, rightBracket - leftBracket - 1);
-    auto dimsString = ovms::tokenize(shapeString, ',');
-    signed_shape_t shape;
-    std::transform(dimsString.begin(), dimsString.end(), std::back_inserter(shape),
-                                   [](const std::string& s) -> signed_shape_t::value_type {
-        auto dimOpt = ovms::stoi64(s);
-        if (!dimOpt.has_value() || dimOpt.value() <= 0) {
-            std::cout << __LINE__ << " " << s << std::endl;
-            throw std::invalid_argument("Invalid shape argument");
-        }
-                                   return dimOpt.value(); });
-    return shape;
-}
-
 volatile sig_atomic_t shutdown_request = 0;
 
 static void onInterrupt(int status) {
@@ -187,164 +205,286 @@ static void installSignalHandlers() {
     sigaction(SIGILL, &sigIllHandler, NULL);
 }
 
-OVMS_InferenceRequest* prepareRequest(OVMS_Server* server, const std::string& servableName, int64_t servableVersion, OVMS_DataType datatype, const signed_shape_t& shape, const std::string& inputName, const void* data) {
+BenchmarkScenario createScenarioFromCLI(const cxxopts::ParseResult& result) {
+    BenchmarkScenario scenario;
+    BenchmarkStream stream;
+    if (!result.count("servable_name") || !result.count("shape")) {
+        throw std::invalid_argument("servable_name and shape are required when scenario is not used");
+    }
+    stream.servableName = result["servable_name"].as<std::string>();
+    stream.servableVersion = result["servable_version"].as<int64_t>();
+    if (stream.servableVersion < 0) {
+        throw std::invalid_argument("servableVersion cannot be negative");
+    }
+    stream.inputs = ovms::benchmark::parseInputs(result["shape"].as<std::string>());
+    if (result.count("inputs_names")) {
+        for (const auto& name : ovms::tokenize(result["inputs_names"].as<std::string>(), ',')) {
+            if (std::none_of(stream.inputs.begin(), stream.inputs.end(), [&name](const BenchmarkInput& input) { return input.name == name; })) {
+                throw std::invalid_argument("Missing shape of input: " + name);
+            }
+        }
+    }
+    stream.arrival = ovms::benchmark::parseArrivalMode(result["arrival"].as<std::string>());
+    stream.mode = ovms::benchmark::parseWorkloadMode(result["mode"].as<std::string>());
+    stream.rate = result["rate"].as<double>();
+    scenario.durationSeconds = result["duration"].as<double>();
+    scenario.warmupSeconds = result["warmup"].as<double>();
+    size_t nireq = result["nireq"].as<uint32_t>();
+    size_t threadsPerIreq = result["threads_per_ireq"].as<uint32_t>();
+    if (scenario.durationSeconds <= 0) {
+        stream.niter = result["niter"].as<uint32_t>();
+        stream.concurrency = std::max<size_t>(1, std::min<size_t>(nireq * threadsPerIreq, stream.niter));
+    } else {
+        stream.concurrency = std::max<size_t>(1, nireq * threadsPerIreq);
+    }
+    if (stream.arrival != ArrivalMode::CLOSED && (stream.rate <= 0 || scenario.durationSeconds <= 0)) {
+        throw std::invalid_argument("Open loop arrival requires rate and duration");
+    }
+    scenario.streams.push_back(std::move(stream));
+    return scenario;
+}
+
+/**
+ * Input buffers of a stream. RESET_BUFFER and RESET_REQUEST modes cycle through randomized variants.
+ */
+struct InputsData {
+    static constexpr size_t VARIANTS = 16;
+    // [variant][input]
+    std::vector<std::vector<std::vector<char>>> buffers;
+
+    InputsData(const BenchmarkStream& stream, size_t variants, uint64_t seed) {
+        std::default_random_engine generator(seed);
+        std::uniform_real_distribution<float> distribution(0.0, 1.0);
+        buffers.resize(variants);
+        for (auto& variant : buffers) {
+            for (const auto& input : stream.inputs) {
+                auto elementsCount = std::accumulate(input.shape.begin(), input.shape.end(), int64_t{1}, std::multiplies<int64_t>());
+                std::vector<char> buffer(ovms::DataTypeToByteSize(input.datatype) * elementsCount, 0);
+                if (input.datatype == OVMS_DATATYPE_FP32) {
+                    float value = (variants > 1) ? distribution(generator) : 1.0f;
+                    float* data = reinterpret_cast<float*>(buffer.data());
+                    std::fill(data, data + elementsCount, value);
+                }
+                variant.push_back(std::move(buffer));
+            }
+        }
+    }
+};
+
+OVMS_InferenceRequest* prepareRequest(OVMS_Server* server, const BenchmarkStream& stream, const std::vector<std::vector<char>>& data) {
     OVMS_InferenceRequest* request{nullptr};
-    OVMS_InferenceRequestNew(&request, server, servableName.c_str(), servableVersion);
-    OVMS_InferenceRequestAddInput(request, inputName.c_str(), datatype, shape.data(), shape.size());
-    auto elementsCount = std::accumulate(shape.begin(), shape.end(), 1, std::multiplies<signed_shape_t::value_type>());
-    OVMS_InferenceRequestInputSetData(request, inputName.c_str(), data, ovms::DataTypeToByteSize(datatype) * elementsCount, OVMS_BUFFERTYPE_CPU, 0);
+    OVMS_InferenceRequestNew(&request, server, stream.servableName.c_str(), stream.servableVersion);
+    for (size_t i = 0; i < stream.inputs.size(); ++i) {
+        const auto& input = stream.inputs[i];
+        OVMS_InferenceRequestAddInput(request, input.name.c_str(), input.datatype, input.shape.data(), input.shape.size());
+        OVMS_InferenceRequestInputSetData(request, input.name.c_str(), data[i].data(), data[i].size(), OVMS_BUFFERTYPE_CPU, 0);
+    }
     return request;
 }
 
-void triggerInferenceInALoopInferenceOnly(
-    std::future<void>& startSignal,
-    std::promise<void>& readySignal,
-    const size_t niterPerThread,
-    size_t& wholeThreadTimeUs,
-    double& averageWholeLatency,
-    double& averagePureLatency,
-    OVMS_Server* server,
-    const std::string& servableName, int64_t servableVersion, OVMS_DataType datatype, const signed_shape_t& shape, const std::string& inputName,
-    std::optional<uint64_t> seed) {
-    OVMS_InferenceResponse* response{nullptr};
-    std::vector<uint64_t> latenciesWhole(niterPerThread);
-    std::vector<uint64_t> latenciesPure(niterPerThread);
-    auto elementsCount = std::accumulate(shape.begin(), shape.end(), 1, std::multiplies<signed_shape_t::value_type>());
-    std::vector<float> data(elementsCount, 1.0);
-    OVMS_InferenceRequest* request = prepareRequest(server, servableName, servableVersion, datatype, shape, inputName, (const void*)data.data());
-    readySignal.set_value();
-    startSignal.get();
-    auto workloadStart = std::chrono::high_resolution_clock::now();
-    size_t iter = niterPerThread;
-    while (iter-- > 0) {
-        auto iterationWholeStart = std::chrono::high_resolution_clock::now();
-        auto iterationPureStart = std::chrono::high_resolution_clock::now();
-        OVMS_Inference(server, request, &response);
-        auto iterationPureEnd = std::chrono::high_resolution_clock::now();
-        OVMS_InferenceResponseDelete(response);
-        auto iterationWholeEnd = std::chrono::high_resolution_clock::now();
-        latenciesWhole[iter] = std::chrono::duration_cast<std::chrono::microseconds>(iterationWholeEnd - iterationWholeStart).count();
-        latenciesPure[iter] = std::chrono::duration_cast<std::chrono::microseconds>(iterationPureEnd - iterationPureStart).count();
+void resetRequestData(OVMS_InferenceRequest* request, const BenchmarkStream& stream, const std::vector<std::vector<char>>& data) {
+    for (size_t i = 0; i < stream.inputs.size(); ++i) {
+        const auto& input = stream.inputs[i];
+        OVMS_InferenceRequestInputRemoveData(request, input.name.c_str());
+        OVMS_InferenceRequestInputSetData(request, input.name.c_str(), data[i].data(), data[i].size(), OVMS_BUFFERTYPE_CPU, 0);
     }
-    auto workloadEnd = std::chrono::high_resolution_clock::now();
-    wholeThreadTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(workloadEnd - workloadStart).count();
-    averageWholeLatency = std::accumulate(latenciesWhole.begin(), latenciesWhole.end(), 0) / (double(niterPerThread) * 1'000);
-    averagePureLatency = std::accumulate(latenciesPure.begin(), latenciesPure.end(), 0) / (double(niterPerThread) * 1'000);
-    OVMS_InferenceRequestDelete(request);
 }
 
-void prepareData(std::vector<std::vector<float>>& preparedData, const size_t& numberOfVectors, const size_t& vectorElementCount, std::optional<uint64_t> seed){
-    std::uniform_real_distribution<float> distribution(0.0, 1.0);
-    std::default_random_engine generator;
-    uint64_t seedValue;
-    if (seed.has_value()) {
-        seedValue = seed.value();
-    } else {
-        std::random_device rd;
-        seedValue = rd();
+struct StreamResult {
+    LatencyHistogram latency;      // from intended send time, includes waiting for busy workers
+    LatencyHistogram serviceTime;  // OVMS_Inference call only
+    uint64_t errors = 0;
+
+    void merge(const StreamResult& other) {
+        latency.merge(other.latency);
+        serviceTime.merge(other.serviceTime);
+        errors += other.errors;
     }
-    std::cout << "Seed used to generate random values: " << seedValue << std::endl;
-    generator = std::default_random_engine(seedValue);
-    for (size_t i = 0; i < numberOfVectors; i ++) {
-        float random = distribution(generator);
-        std::vector<float> data(vectorElementCount, random);
-        preparedData.push_back(data);
+};
+
+/**
+ * State shared by workers of a stream. Open loop workers take the next scheduled arrival,
+ * closed loop workers take the next iteration.
+ */
+struct StreamContext {
+    const BenchmarkStream& stream;
+    const InputsData& data;
+    std::vector<uint64_t> schedule;
+    std::atomic<uint64_t> next{0};
+    std::vector<StreamResult> workerResults;
+
+    StreamContext(const BenchmarkStream& stream, const InputsData& data, std::vector<uint64_t> schedule) :
+        stream(stream),
+        data(data),
+        schedule(std::move(schedule)),
+        workerResults(stream.concurrency) {}
+};
+
+void runWorker(OVMS_Server* server, StreamContext& context, StreamResult& result, std::shared_future<clock_type::time_point> startSignal, std::promise<void>& readySignal, double warmupSeconds, double durationSeconds) {
+    const auto& stream = context.stream;
+    const auto& variants = context.data.buffers;
+    OVMS_InferenceRequest* request = (stream.mode != WorkloadMode::RESET_REQUEST) ? prepareRequest(server, stream, variants[0]) : nullptr;
+    readySignal.set_value();
+    const auto workloadStart = startSignal.get();
+    const auto measureStart = workloadStart + std::chrono::microseconds(static_cast<uint64_t>(warmupSeconds * 1'000'000));
+    const auto workloadEnd = measureStart + std::chrono::microseconds(static_cast<uint64_t>(durationSeconds * 1'000'000));
+    while (!shutdown_request) {
+        clock_type::time_point intendedStart;
+        uint64_t iteration = context.next.fetch_add(1);
+        if (stream.arrival == ArrivalMode::CLOSED) {
+            intendedStart = clock_type::now();
+            if (stream.niter > 0 ? iteration >= stream.niter : intendedStart >= workloadEnd) {
+                break;
+            }
+        } else {
+            if (iteration >= context.schedule.size()) {
+                break;
+            }
+            intendedStart = workloadStart + std::chrono::microseconds(context.schedule[iteration]);
+            std::this_thread::sleep_until(intendedStart);
+        }
+        const auto& data = variants[iteration % variants.size()];
+        if (stream.mode == WorkloadMode::RESET_BUFFER) {
+            resetRequestData(request, stream, data);
+        } else if (stream.mode == WorkloadMode::RESET_REQUEST) {
+            request = prepareRequest(server, stream, data);
+        }
+        OVMS_InferenceResponse* response{nullptr};
+        const auto sendStart = clock_type::now();
+        OVMS_Status* status = OVMS_Inference(server, request, &response);
+        const auto sendEnd = clock_type::now();
+        const bool isMeasured = intendedStart >= measureStart;
+        if (status != nullptr) {
+            OVMS_StatusDelete(status);
+            if (isMeasured) {
+                result.errors++;
+            }
+        } else {
+            OVMS_InferenceResponseDelete(response);
+        }
+        if (stream.mode == WorkloadMode::RESET_REQUEST) {
+            OVMS_InferenceRequestDelete(request);
+            request = nullptr;
+        }
+        if (!isMeasured) {
+            continue;
+        }
+        result.latency.record(std::chrono::duration_cast<std::chrono::microseconds>(sendEnd - intendedStart).count());
+        result.serviceTime.record(std::chrono::duration_cast<std::chrono::microseconds>(sendEnd - sendStart).count());
+    }
+    if (request != nullptr) {
+        OVMS_InferenceRequestDelete(request);
     }
 }
 
-void triggerInferenceInALoopResetBuffer(
-    std::future<void>& startSignal,
-    std::promise<void>& readySignal,
-    const size_t niterPerThread,
-    size_t& wholeThreadTimeUs,
-    double& averageWholeLatency,
-    double& averagePureLatency,
-    OVMS_Server* server,
-    const std::string& servableName, int64_t servableVersion, OVMS_DataType datatype, const signed_shape_t& shape, const std::string& inputName,
-    std::optional<uint64_t> seed) {
+bool checkStream(OVMS_Server* server, const BenchmarkStream& stream, const InputsData& data) {
+    OVMS_InferenceRequest* request = prepareRequest(server, stream, data.buffers[0]);
     OVMS_InferenceResponse* response{nullptr};
-    std::vector<uint64_t> latenciesWhole(niterPerThread);
-    std::vector<uint64_t> latenciesPure(niterPerThread);
-    std::vector<std::vector<float>> preparedData;
-    auto elementsCount = std::accumulate(shape.begin(), shape.end(), 1, std::multiplies<signed_shape_t::value_type>());
-    prepareData(preparedData, niterPerThread, elementsCount, seed);
-    std::vector<float> data(elementsCount, 1.0);
-    OVMS_InferenceRequest* request = prepareRequest(server, servableName, servableVersion, datatype, shape, inputName, (const void*)data.data());
-    readySignal.set_value();
-    startSignal.get();
-    auto workloadStart = std::chrono::high_resolution_clock::now();
-    size_t iter = 0;
-    while (iter < niterPerThread) {
-        auto iterationWholeStart = std::chrono::high_resolution_clock::now();
-        OVMS_InferenceRequestInputRemoveData(request, inputName.c_str());
-        OVMS_InferenceRequestInputSetData(request, inputName.c_str(), (const void*)preparedData[iter].data(), elementsCount * sizeof(float), OVMS_BUFFERTYPE_CPU, 0);
-        auto iterationPureStart = std::chrono::high_resolution_clock::now();
-        OVMS_Inference(server, request, &response);
-        auto iterationPureEnd = std::chrono::high_resolution_clock::now();
-        OVMS_InferenceResponseDelete(response);
-        auto iterationWholeEnd = std::chrono::high_resolution_clock::now();
-        latenciesWhole[iter] = std::chrono::duration_cast<std::chrono::microseconds>(iterationWholeEnd - iterationWholeStart).count();
-        latenciesPure[iter] = std::chrono::duration_cast<std::chrono::microseconds>(iterationPureEnd - iterationPureStart).count();
-        iter++;
-    }
-    auto workloadEnd = std::chrono::high_resolution_clock::now();
-    wholeThreadTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(workloadEnd - workloadStart).count();
-    averageWholeLatency = std::accumulate(latenciesWhole.begin(), latenciesWhole.end(), 0) / (double(niterPerThread) * 1'000);
-    averagePureLatency = std::accumulate(latenciesPure.begin(), latenciesPure.end(), 0) / (double(niterPerThread) * 1'000);
+    OVMS_Status* res = OVMS_Inference(server, request, &response);
     OVMS_InferenceRequestDelete(request);
+    if (res != nullptr) {
+        uint32_t code = 0;
+        const char* details = nullptr;
+        OVMS_StatusCode(res, &code);
+        OVMS_StatusDetails(res, &details);
+        std::cerr << "Error occured during inference of servable: " << stream.servableName << ". Code:" << code
+                  << ", details:" << details << std::endl;
+        OVMS_StatusDelete(res);
+        return false;
+    }
+    OVMS_InferenceResponseDelete(response);
+    return true;
 }
 
-void triggerInferenceInALoopResetRequest(
-    std::future<void>& startSignal,
-    std::promise<void>& readySignal,
-    const size_t niterPerThread,
-    size_t& wholeThreadTimeUs,
-    double& averageWholeLatency,
-    double& averagePureLatency,
-    OVMS_Server* server,
-    const std::string& servableName, int64_t servableVersion, OVMS_DataType datatype, const signed_shape_t& shape, const std::string& inputName,
-    std::optional<uint64_t> seed) {
-    OVMS_InferenceResponse* response{nullptr};
-    auto elementsCount = std::accumulate(shape.begin(), shape.end(), 1, std::multiplies<signed_shape_t::value_type>());
-    std::vector<uint64_t> latenciesWhole(niterPerThread);
-    std::vector<uint64_t> latenciesPure(niterPerThread);
-    std::vector<std::vector<float>> preparedData;
-    prepareData(preparedData, niterPerThread, elementsCount, seed);
-    readySignal.set_value();
-    startSignal.get();
-    auto workloadStart = std::chrono::high_resolution_clock::now();
-    size_t iter = 0;
-    while (iter < niterPerThread) {
-        OVMS_InferenceRequest* request = prepareRequest(server, servableName, servableVersion, datatype, shape, inputName, (const void*)preparedData[iter].data());
-        auto iterationWholeStart = std::chrono::high_resolution_clock::now();
-        auto iterationPureStart = std::chrono::high_resolution_clock::now();
-        OVMS_Inference(server, request, &response);
-        auto iterationPureEnd = std::chrono::high_resolution_clock::now();
-        OVMS_InferenceResponseDelete(response);
-        OVMS_InferenceRequestDelete(request);
-        auto iterationWholeEnd = std::chrono::high_resolution_clock::now();
-        latenciesWhole[iter] = std::chrono::duration_cast<std::chrono::microseconds>(iterationWholeEnd - iterationWholeStart).count();
-        latenciesPure[iter] = std::chrono::duration_cast<std::chrono::microseconds>(iterationPureEnd - iterationPureStart).count();
-        iter++;
+std::string resultsToJson(const BenchmarkScenario& scenario, const std::string& label, const std::vector<StreamResult>& results, double measuredSeconds) {
+    rapidjson::StringBuffer buffer;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    writer.Key("scenario");
+    writer.String(scenario.name.c_str());
+    writer.Key("label");
+    writer.String(label.c_str());
+    writer.Key("measured_seconds");
+    writer.Double(measuredSeconds);
+    writer.Key("streams");
+    writer.StartArray();
+    for (size_t i = 0; i < scenario.streams.size(); ++i) {
+        const auto& stream = scenario.streams[i];
+        const auto& result = results[i];
+        writer.StartObject();
+        writer.Key("servable_name");
+        writer.String(stream.servableName.c_str());
+        writer.Key("servable_version");
+        writer.Int64(stream.servableVersion);
+        writer.Key("arrival");
+        writer.String(toString(stream.arrival));
+        writer.Key("mode");
+        writer.String(toString(stream.mode));
+        writer.Key("rate");
+        writer.Double(stream.rate);
+        writer.Key("concurrency");
+        writer.Uint(stream.concurrency);
+        writer.Key("requests");
+        writer.Uint64(result.serviceTime.getCount());
+        writer.Key("errors");
+        writer.Uint64(result.errors);
+        writer.Key("throughput");
+        writer.Double(measuredSeconds > 0 ? result.serviceTime.getCount() / measuredSeconds : 0);
+        writeHistogram(writer, "latency_us", result.latency);
+        writeHistogram(writer, "service_time_us", result.serviceTime);
+        writer.EndObject();
     }
-    auto workloadEnd = std::chrono::high_resolution_clock::now();
-    wholeThreadTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(workloadEnd - workloadStart).count();
-    averageWholeLatency = std::accumulate(latenciesWhole.begin(), latenciesWhole.end(), 0) / (double(niterPerThread) * 1'000);
-    averagePureLatency = std::accumulate(latenciesPure.begin(), latenciesPure.end(), 0) / (double(niterPerThread) * 1'000);
+    writer.EndArray();
+    writer.EndObject();
+    return buffer.GetString();
 }
 
-}  // namespace
+void printResults(const BenchmarkScenario& scenario, const std::vector<StreamResult>& results, double measuredSeconds) {
+    std::cout << std::fixed << std::setprecision(3);
+    for (size_t i = 0; i < scenario.streams.size(); ++i) {
+        const auto& stream = scenario.streams[i];
+        const auto& result = results[i];
+        std::cout << "Servable: " << stream.servableName << "; arrival: " << toString(stream.arrival) << "; mode: " << toString(stream.mode) << std::endl;
+        std::cout << "FPS: " << result.serviceTime.getCount() / measuredSeconds << "; errors: " << result.errors << std::endl;
+        std::cout << "Average latency whole prediction path:" << result.latency.getMean() / 1'000 << "ms" << std::endl;
+        std::cout << "Average latency pure C-API inference:" << result.serviceTime.getMean() / 1'000 << "ms" << std::endl;
+        std::cout << "Latency percentiles p50/p90/p99/p99.9: "
+                  << result.latency.getValueAtPercentile(50) / 1'000.0 << "/"
+                  << result.latency.getValueAtPercentile(90) / 1'000.0 << "/"
+                  << result.latency.getValueAtPercentile(99) / 1'000.0 << "/"
+                  << result.latency.getValueAtPercentile(99.9) / 1'000.0 << "ms" << std::endl;
+    }
+}
 
-enum Mode {
-    INFERENCE_ONLY,
-    RESET_BUFFER,
-    RESET_REQUEST
-};
+}  // namespace
 
 int main(int argc, char** argv) {
     installSignalHandlers();
     BenchmarkCLIParser cliparser;
     cliparser.parse(argc, argv);
+    const auto& cli = *cliparser.result;
+
+    BenchmarkScenario scenario;
+    try {
+        scenario = cli.count("scenario") ? ovms::benchmark::loadScenario(cli["scenario"].as<std::string>()) : createScenarioFromCLI(cli);
+    } catch (const std::exception& e) {
+        std::cerr << "Invalid benchmark configuration: " << e.what() << std::endl;
+        return EX_USAGE;
+    }
+    if (cli.count("config_path") || scenario.configPath.empty()) {
+        scenario.configPath = cli["config_path"].as<std::string>();
+    }
+    if (cli.count("seed")) {
+        scenario.seed = cli["seed"].as<uint64_t>();
+    }
+    uint64_t seed;
+    if (scenario.seed.has_value()) {
+        seed = scenario.seed.value();
+    } else {
+        std::random_device rd;
+        seed = rd();
+    }
+    std::cout << "Seed used to generate random values: " << seed << std::endl;
 
     OVMS_ServerSettings* serverSettings = 0;
     OVMS_ModelsSettings* modelsSettings = 0;
@@ -354,12 +494,12 @@ int main(int argc, char** argv) {
     OVMS_ModelsSettingsNew(&modelsSettings);
     OVMS_ServerNew(&srv);
 
-    uint32_t grpcPort = cliparser.result->operator[]("port").as<uint32_t>();
-    uint32_t restPort = cliparser.result->operator[]("rest_port").as<uint32_t>();
+    uint32_t grpcPort = cli["port"].as<uint32_t>();
+    uint32_t restPort = cli["rest_port"].as<uint32_t>();
     OVMS_ServerSettingsSetGrpcPort(serverSettings, grpcPort);
     OVMS_ServerSettingsSetRestPort(serverSettings, restPort);
 
-    std::string cliLogLevel(cliparser.result->operator[]("log_level").as<std::string>());
+    std::string cliLogLevel(cli["log_level"].as<std::string>());
     OVMS_LogLevel_enum logLevel;
     if (cliLogLevel == "TRACE") {
         logLevel = OVMS_LOG_TRACE;
@@ -372,25 +512,11 @@ int main(int argc, char** argv) {
     } else if (cliLogLevel == "ERROR") {
         logLevel = OVMS_LOG_ERROR;
     } else {
-        std::cout << __LINE__ << std::endl;
+        std::cerr << "Invalid log level: " << cliLogLevel << std::endl;
         return EX_USAGE;
     }
     OVMS_ServerSettingsSetLogLevel(serverSettings, logLevel);
-    OVMS_ModelsSettingsSetConfigPath(modelsSettings, cliparser.result->operator[]("config_path").as<std::string>().c_str());
-
-    std::string modeParam = cliparser.result->operator[]("mode").as<std::string>();
-    Mode mode;
-    if (modeParam == "INFERENCE_ONLY") {
-        mode = Mode::INFERENCE_ONLY;
-    }else if (modeParam == "RESET_BUFFER") {
-        mode = Mode::RESET_BUFFER;
-    }else if (modeParam == "RESET_REQUEST") {
-        mode = Mode::RESET_REQUEST;
-    }else {
-        std::cerr << "Invalid mode requested: " <<  modeParam << std::endl;
-        return 1;
-    }
-    std::cout << "Mode requested: " <<  modeParam << std::endl;
+    OVMS_ModelsSettingsSetConfigPath(modelsSettings, scenario.configPath.c_str());
 
     OVMS_Status* res = OVMS_ServerStartFromConfigurationFile(srv, serverSettings, modelsSettings);
 
@@ -410,164 +536,65 @@ int main(int argc, char** argv) {
     std::cout << "Server ready for inference" << std::endl;
 
     ///////////////////////
-    // model parameters
+    // prepare data and check requests
     ///////////////////////
-    std::string servableName(cliparser.result->operator[]("servable_name").as<std::string>());
-    int64_t servableVersion(cliparser.result->operator[]("servable_version").as<int64_t>());
-    if (servableVersion < 0) {
-        std::cerr << "servableVersion cannot be negative" << std::endl;
-        return EX_USAGE;
-    }
-    // input names handling
-    std::string cliInputsNames(cliparser.result->operator[]("inputs_names").as<std::string>());
-    auto inputsNames = ovms::tokenize(cliInputsNames, ',');
-    if (inputsNames.size() != 1) {
-        std::cout << __LINE__ << std::endl;
-        return EX_USAGE;
-    }
-    std::string inputName = inputsNames[0];
-    // datatype handling
-    OVMS_DataType datatype = OVMS_DATATYPE_FP32;
-    // shape handling
-    signed_shape_t shape;
-    try {
-        shape = parseShapes(cliparser.result->operator[]("shape").as<std::string>());
-    }
-    catch(...){
-        std::cerr << "Invalid shape parameter.";
-        exit(EX_CONFIG);
+    std::vector<std::unique_ptr<InputsData>> inputsData;
+    std::vector<std::unique_ptr<StreamContext>> contexts;
+    for (size_t i = 0; i < scenario.streams.size(); ++i) {
+        const auto& stream = scenario.streams[i];
+        size_t variants = (stream.mode == WorkloadMode::INFERENCE_ONLY) ? 1 : InputsData::VARIANTS;
+        inputsData.emplace_back(std::make_unique<InputsData>(stream, variants, seed + i));
+        if (!checkStream(srv, stream, *inputsData.back())) {
+            OVMS_ServerDelete(srv);
+            OVMS_ModelsSettingsDelete(modelsSettings);
+            OVMS_ServerSettingsDelete(serverSettings);
+            return EX_CONFIG;
+        }
+        auto schedule = ovms::benchmark::createArrivalSchedule(stream.arrival, stream.rate, scenario.warmupSeconds + scenario.durationSeconds, seed + i);
+        contexts.emplace_back(std::make_unique<StreamContext>(stream, *inputsData.back(), std::move(schedule)));
     }
-    ///////////////////////
-    // benchmark parameters
-    ///////////////////////
-    size_t nireq = cliparser.result->operator[]("nireq").as<uint32_t>();
-    size_t niter = cliparser.result->operator[]("niter").as<uint32_t>();
-    size_t threadsPerIreq = cliparser.result->operator[]("threads_per_ireq").as<uint32_t>();
-    size_t threadCount = std::min(nireq * threadsPerIreq, niter);
-    size_t niterPerThread = niter / threadCount;
 
-    auto elementsCount = std::accumulate(shape.begin(), shape.end(), 1, std::multiplies<signed_shape_t::value_type>());
-    std::vector<float> data(elementsCount, 0.1);
-
-    ///////////////////////
-    // prepare time measuring
-    ///////////////////////
-    std::vector<double> wholeTimes;
-    wholeTimes.resize(threadCount);
-    std::vector<double> pureTimes;
-    pureTimes.resize(threadCount);
-
-    ///////////////////////
-    // prepare requests
     ///////////////////////
-    OVMS_InferenceRequest* request = prepareRequest(srv, servableName, servableVersion, datatype, shape, inputName, (const void*)data.data());
-    ///////////////////////
-    // check request
+    // setup workload machinery
     ///////////////////////
-    OVMS_InferenceResponse* response;
-    res = OVMS_Inference(srv, request, &response);
-    if (res != nullptr) {
-        uint32_t code = 0;
-        const char* details = 0;
-        OVMS_StatusCode(res, &code);
-        OVMS_StatusDetails(res, &details);
-        std::cerr << "Error occured during inference. Code:" << code
-                  << ", details:" << details << std::endl;
-        OVMS_StatusDelete(res);
-        OVMS_InferenceRequestDelete(request);
-        OVMS_ServerDelete(srv);
-        OVMS_ModelsSettingsDelete(modelsSettings);
-        OVMS_ServerSettingsDelete(serverSettings);
-        exit(EX_CONFIG);
-    }
-    OVMS_InferenceResponseDelete(response);
-    std::optional<uint64_t> seed;
-    if (cliparser.result->count("seed")) {
-        seed = cliparser.result->operator[]("seed").as<uint64_t>();
+    std::promise<clock_type::time_point> startSignal;
+    std::shared_future<clock_type::time_point> futureStartSignal = startSignal.get_future().share();
+    std::vector<std::unique_ptr<std::promise<void>>> readySignals;
+    std::vector<std::thread> workerThreads;
+    for (auto& context : contexts) {
+        for (auto& workerResult : context->workerResults) {
+            readySignals.emplace_back(std::make_unique<std::promise<void>>());
+            workerThreads.emplace_back(runWorker, srv, std::ref(*context), std::ref(workerResult), futureStartSignal, std::ref(*readySignals.back()), scenario.warmupSeconds, scenario.durationSeconds);
+        }
     }
+    // allow all threads to initialize
+    std::for_each(readySignals.begin(), readySignals.end(), [](auto& readySignal) { readySignal->get_future().get(); });
 
     ///////////////////////
-    // setup workload machinery
+    // start workload
     ///////////////////////
-    std::vector<std::unique_ptr<std::thread>> workerThreads;
-    std::vector<std::promise<void>> startSignals(threadCount);
-    std::vector<std::promise<void>> readySignals(threadCount);
-    std::vector<std::future<void>> futureStartSignals;
-    std::vector<std::future<void>> futureReadySignals;
-    std::vector<size_t> wholeThreadsTimesUs(threadCount, 0);
-    std::transform(startSignals.begin(),
-        startSignals.end(),
-        std::back_inserter(futureStartSignals),
-        [](auto& p) { return p.get_future(); });
-    std::transform(readySignals.begin(),
-        readySignals.end(),
-        std::back_inserter(futureReadySignals),
-        [](auto& p) { return p.get_future(); });
+    std::cout << "Benchmark starting workload: " << scenario.name << std::endl;
+    auto workloadStart = clock_type::now();
+    startSignal.set_value(workloadStart);
+    std::for_each(workerThreads.begin(), workerThreads.end(), [](auto& t) { t.join(); });
+    auto workloadEnd = clock_type::now();
+    double measuredSeconds = std::chrono::duration_cast<std::chrono::microseconds>(workloadEnd - workloadStart).count() / 1'000'000.0 - scenario.warmupSeconds;
 
     ///////////////////////
-    // prepare threads
+    // report results
     ///////////////////////
-    void (*triggerInferenceInALoop)(std::future<void>&, std::promise<void>&, const size_t, size_t&, double&, double&, OVMS_Server*, const std::string&, int64_t, OVMS_DataType, const signed_shape_t&, const std::string&, std::optional<uint64_t>);
-    if (mode == Mode::INFERENCE_ONLY) {
-        triggerInferenceInALoop = triggerInferenceInALoopInferenceOnly;
-    } else if (mode == Mode::RESET_BUFFER){
-        triggerInferenceInALoop = triggerInferenceInALoopResetBuffer;
-    } else if (mode == Mode::RESET_REQUEST) {
-        triggerInferenceInALoop = triggerInferenceInALoopResetRequest;
+    std::vector<StreamResult> results(contexts.size());
+    for (size_t i = 0; i < contexts.size(); ++i) {
+        for (const auto& workerResult : contexts[i]->workerResults) {
+            results[i].merge(workerResult);
+        }
     }
-    for (size_t i = 0; i < threadCount; ++i) {
-        workerThreads.emplace_back(std::make_unique<std::thread>(
-            [&futureStartSignals,
-            &readySignals,
-            &niterPerThread,
-            &wholeThreadsTimesUs,
-            &wholeTimes,
-            &pureTimes,
-            &srv,
-            &servableName,
-            &servableVersion,
-            &datatype,
-            &shape,
-            &inputName,
-            &triggerInferenceInALoop,
-            &seed,
-            i]() {
-                triggerInferenceInALoop(
-                    futureStartSignals[i],
-                    readySignals[i],
-                    niterPerThread,
-                    wholeThreadsTimesUs[i],
-                    wholeTimes[i],
-                    pureTimes[i],
-                    srv,
-                    servableName, servableVersion, datatype, shape, inputName,
-                    seed);
-            }));
+    printResults(scenario, results, measuredSeconds);
+    if (cli.count("output")) {
+        std::ofstream output(cli["output"].as<std::string>());
+        output << resultsToJson(scenario, cli["label"].as<std::string>(), results, measuredSeconds) << std::endl;
+        std::cout << "Results saved to: " << cli["output"].as<std::string>() << std::endl;
     }
-
-    // allow all threads to initialize
-    std::for_each(futureReadySignals.begin(), futureReadySignals.end(), [](auto& readySignal) { readySignal.get(); });
-    ///////////////////////
-    // start workload
-    ///////////////////////
-    std::cout << "Benchmark starting workload" << std::endl;
-    auto workloadStart = std::chrono::high_resolution_clock::now();
-    std::for_each(startSignals.begin(), startSignals.end(), [](auto& startSignal) { startSignal.set_value(); });
-    ///////////////////////
-    // end workload
-    ///////////////////////
-    std::for_each(workerThreads.begin(), workerThreads.end(), [](auto& t) { t->join(); });
-    auto workloadEnd = std::chrono::high_resolution_clock::now();
-    auto wholeTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(workloadEnd - workloadStart).count();
-    std::cout << "FPS: " << double(niter) / wholeTimeUs * 1'000'000 << std::endl;
-    auto totalUs = std::accumulate(wholeThreadsTimesUs.begin(), wholeThreadsTimesUs.end(), 0);
-    std::cout << "Average per thread FPS: " << double(niter) * threadCount/totalUs * 1'000'000 << std::endl;
-    OVMS_InferenceRequestDelete(request);
-    double totalWhole = std::accumulate(wholeTimes.begin(), wholeTimes.end(), double(0)) / threadCount;
-    double totalPure = std::accumulate(pureTimes.begin(), pureTimes.end(), double(0)) / threadCount;
-    std::cout << std::fixed << std::setprecision(3);
-    std::cout << "Average latency whole prediction path:" << totalWhole << "ms" << std::endl;
-    std::cout << "Average latency pure C-API inference:" << totalPure << "ms" << std::endl;
     // OVMS cleanup
     OVMS_ServerDelete(srv);
     OVMS_ModelsSettingsDelete(modelsSettings);
@@ -575,4 +602,3 @@ int main(int argc, char** argv) {
     std::cout << "main() exit" << std::endl;
     return 0;
 }
-// adjustable nireq, adjustable shape, model name
@@ -13,7 +13,11 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //*****************************************************************************
+#include <memory>
+#include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "../python/ovms_py_tensor.hpp"
 #include "../python/pythonnoderesources.hpp"
@@ -78,8 +82,12 @@ class PythonExecutorCalculator : public CalculatorBase {
         }
     }
 
-    void pushOutputs(CalculatorContext* cc, py::list pyOutputs, mediapipe::Timestamp& timestamp, bool pushLoopback) {
-        py::gil_scoped_acquire acquire;
+    // Outputs are collected while holding the GIL and pushed into the graph after it is released,
+    // so that the GIL is not held during packet propagation. Python code of all nodes is still executed one at a time,
+    // unless the node is configured with worker_processes.
+    using OutputPackets = std::vector<std::pair<std::string, std::unique_ptr<PyObjectWrapper<py::object>>>>;
+
+    void collectOutputs(CalculatorContext* cc, py::list pyOutputs, OutputPackets& outputs) {
         for (py::handle pyOutputHandle : pyOutputs) {
             py::object pyOutput = pyOutputHandle.cast<py::object>();
             nodeResources->pythonBackend->validateOvmsPyTensor(pyOutput);
@@ -92,10 +100,15 @@ class PythonExecutorCalculator : public CalculatorBase {
 
             std::string outputTag = it->second;
             if (cc->Outputs().HasTag(outputTag)) {
-                std::unique_ptr<PyObjectWrapper<py::object>> outputPtr = std::make_unique<PyObjectWrapper<py::object>>(pyOutput);
-                cc->Outputs().Tag(outputTag).Add(outputPtr.release(), timestamp);
+                outputs.emplace_back(outputTag, std::make_unique<PyObjectWrapper<py::object>>(pyOutput));
             }
         }
+    }
+
+    void pushOutputs(CalculatorContext* cc, OutputPackets& outputs, mediapipe::Timestamp& timestamp, bool pushLoopback) {
+        for (auto& [outputTag, outputPtr] : outputs) {
+            cc->Outputs().Tag(outputTag).Add(outputPtr.release(), timestamp);
+        }
         if (pushLoopback) {
             timestamp++;
             cc->Outputs().Tag("LOOPBACK").Add(std::make_unique<bool>(true).release(), timestamp);
@@ -120,9 +133,10 @@ class PythonExecutorCalculator : public CalculatorBase {
         return pyIteratorPtr->getObject() == py::iterator::sentinel();
     }
 
-    void generate(CalculatorContext* cc, mediapipe::Timestamp& timestamp) {
+    void generate(CalculatorContext* cc, OutputPackets& outputs, bool& pushLoopback) {
         py::list pyOutputs = py::cast<py::list>(*pyIteratorPtr->getObject());
-        pushOutputs(cc, pyOutputs, timestamp, true);
+        collectOutputs(cc, pyOutputs, outputs);
+        pushLoopback = true;
         ++(pyIteratorPtr->getObject());  // increment iterator
     }
 
@@ -134,14 +148,14 @@ class PythonExecutorCalculator : public CalculatorBase {
         pyIteratorPtr.reset();
     }
 
-    void handleExecutionResult(CalculatorContext* cc, py::object executionResult) {
+    void handleExecutionResult(CalculatorContext* cc, py::object executionResult, OutputPackets& outputs, bool& pushLoopback) {
         if (py::isinstance<py::list>(executionResult)) {
-            pushOutputs(cc, executionResult, outputTimestamp, false);
+            collectOutputs(cc, executionResult, outputs);
         } else if (py::isinstance<py::iterator>(executionResult)) {
             if (!hasLoopback)
                 throw BadPythonNodeConfigurationError("Execute yielded, but LOOPBACK is not defined in the node");
             initializeGenerator(executionResult);
-            generate(cc, outputTimestamp);
+            generate(cc, outputs, pushLoopback);
         } else {
             throw UnexpectedPythonObjectError(executionResult, "list or generator");
         }
@@ -187,50 +201,60 @@ public:
 
     absl::Status Process(CalculatorContext* cc) final {
         LOG(INFO) << "PythonExecutorCalculator [Node: " << cc->NodeName() << "] Process start";
-        py::gil_scoped_acquire acquire;
-        try {
-            if (generatorInitialized()) {
-                if (receivedNewData(cc)) {
-                    LOG(INFO) << "PythonExecutorCalculator [Node: " << cc->NodeName() << "] Node is already processing data. Create new stream for another request.";
-                    return absl::Status(absl::StatusCode::kResourceExhausted, "Node is already processing data. Create new stream for another request.");
-                }
-                if (!generatorFinished()) {
-                    generate(cc, outputTimestamp);
+        OutputPackets outputs;
+        bool pushLoopback = false;
+        {
+            py::gil_scoped_acquire acquire;
+            try {
+                if (generatorInitialized()) {
+                    if (receivedNewData(cc)) {
+                        LOG(INFO) << "PythonExecutorCalculator [Node: " << cc->NodeName() << "] Node is already processing data. Create new stream for another request.";
+                        return absl::Status(absl::StatusCode::kResourceExhausted, "Node is already processing data. Create new stream for another request.");
+                    }
+                    if (!generatorFinished()) {
+                        generate(cc, outputs, pushLoopback);
+                    } else {
+                        LOG(INFO) << "PythonExecutorCalculator [Node: " << cc->NodeName() << "] finished generating. Reseting the generator.";
+                        resetGenerator();
+                    }
                 } else {
-                    LOG(INFO) << "PythonExecutorCalculator [Node: " << cc->NodeName() << "] finished generating. Reseting the generator.";
-                    resetGenerator();
+                    // If execute yields, first request sets initial timestamp to input timestamp, then each cycle increments it.
+                    // If execute returns, input timestamp is also output timestamp.
+
+                    outputTimestamp = cc->InputTimestamp();
+
+                    std::vector<py::object> pyInputs;
+                    prepareInputs(cc, &pyInputs);
+                    py::object executeResult;
+                    if (nodeResources->batcher) {
+                        executeResult = nodeResources->batcher->execute(pyInputs);
+                    } else {
+                        executeResult = std::move(nodeResources->ovmsPythonModel->attr("execute")(pyInputs));
+                    }
+                    handleExecutionResult(cc, executeResult, outputs, pushLoopback);
                 }
-            } else {
-                // If execute yields, first request sets initial timestamp to input timestamp, then each cycle increments it.
-                // If execute returns, input timestamp is also output timestamp.
-
-                outputTimestamp = cc->InputTimestamp();
-
-                std::vector<py::object> pyInputs;
-                prepareInputs(cc, &pyInputs);
-                py::object executeResult = std::move(nodeResources->ovmsPythonModel->attr("execute")(pyInputs));
-                handleExecutionResult(cc, executeResult);
+            } catch (const UnexpectedOutputTensorError& e) {
+                LOG(INFO) << "Error occurred during node " << cc->NodeName() << " execution: " << e.what();
+                return absl::Status(absl::StatusCode::kInternal, "Python execute function returned unexpected output");
+            } catch (const UnexpectedPythonObjectError& e) {
+                // TODO: maybe some more descriptive information where to seek the issue.
+                LOG(INFO) << "Error occurred during node " << cc->NodeName() << " execution. Wrong object on execute input or output: " << e.what();
+                return absl::Status(absl::StatusCode::kInternal, "Python execute function received or returned bad value");
+            } catch (const BadPythonNodeConfigurationError& e) {
+                LOG(INFO) << "Error occurred during node " << cc->NodeName() << " execution: " << e.what();
+                return absl::Status(absl::StatusCode::kInternal, "Error occurred due to bad Python node configuration");
+            } catch (const pybind11::error_already_set& e) {
+                LOG(INFO) << "Error occurred during node " << cc->NodeName() << " execution: " << e.what();
+                return absl::Status(absl::StatusCode::kInternal, "Error occurred during Python code execution");
+            } catch (std::exception& e) {
+                LOG(INFO) << "Error occurred during node " << cc->NodeName() << " execution: " << e.what();
+                return absl::Status(absl::StatusCode::kUnknown, "Unexpected error occurred");
+            } catch (...) {
+                LOG(INFO) << "Unexpected error occurred during node " << cc->NodeName() << " execution";
+                return absl::Status(absl::StatusCode::kUnknown, "Unexpected error occurred");
             }
-        } catch (const UnexpectedOutputTensorError& e) {
-            LOG(INFO) << "Error occurred during node " << cc->NodeName() << " execution: " << e.what();
-            return absl::Status(absl::StatusCode::kInternal, "Python execute function returned unexpected output");
-        } catch (const UnexpectedPythonObjectError& e) {
-            // TODO: maybe some more descriptive information where to seek the issue.
-            LOG(INFO) << "Error occurred during node " << cc->NodeName() << " execution. Wrong object on execute input or output: " << e.what();
-            return absl::Status(absl::StatusCode::kInternal, "Python execute function received or returned bad value");
-        } catch (const BadPythonNodeConfigurationError& e) {
-            LOG(INFO) << "Error occurred during node " << cc->NodeName() << " execution: " << e.what();
-            return absl::Status(absl::StatusCode::kInternal, "Error occurred due to bad Python node configuration");
-        } catch (const pybind11::error_already_set& e) {
-            LOG(INFO) << "Error occurred during node " << cc->NodeName() << " execution: " << e.what();
-            return absl::Status(absl::StatusCode::kInternal, "Error occurred during Python code execution");
-        } catch (std::exception& e) {
-            LOG(INFO) << "Error occurred during node " << cc->NodeName() << " execution: " << e.what();
-            return absl::Status(absl::StatusCode::kUnknown, "Unexpected error occurred");
-        } catch (...) {
-            LOG(INFO) << "Unexpected error occurred during node " << cc->NodeName() << " execution";
-            return absl::Status(absl::StatusCode::kUnknown, "Unexpected error occurred");
         }
+        pushOutputs(cc, outputs, outputTimestamp, pushLoopback);
         LOG(INFO) << "PythonExecutorCalculator [Node: " << cc->NodeName() << "] Process end";
         return absl::OkStatus();
     }
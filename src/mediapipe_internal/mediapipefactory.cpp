@@ -69,28 +69,59 @@ Status MediapipeFactory::createDefinition(const std::string& pipelineName,
     }
     std::unique_lock lock(definitionsMtx);
     definitions.insert({pipelineName, std::move(graphDefinition)});
+    isSnapshotOutdated = true;
+    if (publishingBatchesCount == 0) {
+        publishDefinitions();
+    }
     return stat;
 }
 
+MediapipeFactory::PublishingBatch::PublishingBatch(MediapipeFactory& factory) :
+    factory(factory) {
+    std::unique_lock lock(factory.definitionsMtx);
+    ++factory.publishingBatchesCount;
+}
+
+MediapipeFactory::PublishingBatch::~PublishingBatch() {
+    std::unique_lock lock(factory.definitionsMtx);
+    if (--factory.publishingBatchesCount == 0 && factory.isSnapshotOutdated) {
+        factory.publishDefinitions();
+    }
+}
+
+// Needs to be called with definitionsMtx locked
+void MediapipeFactory::publishDefinitions() {
+    auto snapshot = std::make_unique<std::map<std::string, MediapipeGraphDefinition*>>();
+    for (auto& [name, definition] : definitions) {
+        snapshot->emplace(name, definition.get());
+    }
+    definitionsSnapshot.publish(std::move(snapshot));
+    isSnapshotOutdated = false;
+}
+
 bool MediapipeFactory::definitionExists(const std::string& name) const {
     std::shared_lock lock(definitionsMtx);
-    return this->definitions.find(name) != this->definitions.end();
+    return definitions.find(name) != definitions.end();
 }
 
 MediapipeGraphDefinition* MediapipeFactory::findDefinitionByName(const std::string& name) const {
-    std::shared_lock lock(definitionsMtx);
-    auto it = definitions.find(name);
-    if (it == std::end(definitions)) {
+    RcuReadGuard guard;
+    const auto& snapshot = definitionsSnapshot.read(guard);
+    auto it = snapshot.find(name);
+    if (it == std::end(snapshot)) {
         return nullptr;
     } else {
-        return it->second.get();
+        return it->second;
     }
 }
 
 Status MediapipeFactory::reloadDefinition(const std::string& name,
     const MediapipeGraphConfig& config,
     ModelManager& manager) {
-    auto mgd = findDefinitionByName(name);
+    std::shared_lock lock(definitionsMtx);
+    auto it = definitions.find(name);
+    MediapipeGraphDefinition* mgd = it != definitions.end() ? it->second.get() : nullptr;
+    lock.unlock();
     if (mgd == nullptr) {
         SPDLOG_LOGGER_ERROR(modelmanager_logger, "Requested to reload mediapipe graph definition but it does not exist: {}", name);
         return StatusCode::INTERNAL_ERROR;
@@ -104,13 +135,12 @@ Status MediapipeFactory::create(std::shared_ptr<MediapipeGraphExecutor>& pipelin
     const KFSRequest* request,
     KFSResponse* response,
     ModelManager& manager) const {
-    std::shared_lock lock(definitionsMtx);
-    if (!definitionExists(name)) {
+    auto definition = findDefinitionByName(name);
+    if (definition == nullptr) {
         SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Mediapipe with requested name: {} does not exist", name);
         return StatusCode::MEDIAPIPE_DEFINITION_NAME_MISSING;
     }
-    auto& definition = *definitions.at(name);
-    auto status = definition.create(pipeline, request, response);
+    auto status = definition->create(pipeline, request, response);
     return status;
 }
 
@@ -30,6 +30,7 @@
 #include "tensorflow_serving/apis/prediction_service.grpc.pb.h"
 #pragma GCC diagnostic pop
 #include "../kfs_frontend/kfs_grpc_inference_service.hpp"
+#include "../rcu.hpp"
 
 namespace ovms {
 
@@ -43,9 +44,30 @@ class PythonBackend;
 class MediapipeFactory {
     std::map<std::string, std::shared_ptr<MediapipeGraphDefinition>> definitions;
     mutable std::shared_mutex definitionsMtx;
+    /**
+     * @brief Definitions lookup used by requests. Definitions are never removed so raw pointers stay valid.
+     */
+    RcuSnapshot<std::map<std::string, MediapipeGraphDefinition*>> definitionsSnapshot;
+    uint32_t publishingBatchesCount = 0;
+    bool isSnapshotOutdated = false;
     PythonBackend* pythonBackend{nullptr};
 
+    void publishDefinitions();
+
 public:
+    /**
+     * @brief Definitions created while batch exists are published to requests once, when the last batch ends
+     */
+    class PublishingBatch {
+        MediapipeFactory& factory;
+
+    public:
+        explicit PublishingBatch(MediapipeFactory& factory);
+        ~PublishingBatch();
+        PublishingBatch(const PublishingBatch&) = delete;
+        PublishingBatch& operator=(const PublishingBatch&) = delete;
+    };
+
     MediapipeFactory() = delete;
     MediapipeFactory(PythonBackend* pythonBackend = nullptr);
     Status createDefinition(const std::string& pipelineName,
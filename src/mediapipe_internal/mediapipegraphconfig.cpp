@@ -64,6 +64,10 @@ bool MediapipeGraphConfig::isReloadRequired(const MediapipeGraphConfig& rhs) con
         SPDLOG_DEBUG("MediapipeGraphConfig {} reload required due to subconfigPath mismatch", this->graphName);
         return true;
     }
+    if (this->streamMaxInFlightRequests != rhs.streamMaxInFlightRequests) {
+        SPDLOG_DEBUG("MediapipeGraphConfig {} reload required due to stream_max_in_flight_requests mismatch", this->graphName);
+        return true;
+    }
     // Checking if graph pbtxt has been modified
     if (currentGraphPbTxtMD5 != "") {
         std::string newGraphPbTxtMD5 = FileSystem::getFileMD5(rhs.graphPath);
@@ -110,6 +114,9 @@ Status MediapipeGraphConfig::parseNode(const rapidjson::Value& v) {
             SPDLOG_DEBUG("No subconfig path was provided for graph: {} so default subconfig file: {} will be loaded.", getGraphName(), defaultSubconfigPath);
             this->setSubconfigPath(DEFAULT_SUBCONFIG_FILENAME);
         }
+        if (v.HasMember("stream_max_in_flight_requests")) {
+            this->setStreamMaxInFlightRequests(v["stream_max_in_flight_requests"].GetUint());
+        }
     } catch (std::logic_error& e) {
         SPDLOG_DEBUG("Relative path error: {}", e.what());
         return StatusCode::INTERNAL_ERROR;
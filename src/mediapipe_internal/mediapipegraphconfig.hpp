@@ -15,6 +15,7 @@
 //*****************************************************************************
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 #include <rapidjson/document.h>
@@ -23,6 +24,8 @@ namespace ovms {
 
 class Status;
 
+const uint32_t DEFAULT_STREAM_MAX_IN_FLIGHT_REQUESTS = 16;
+
 /**
      * @brief This class represents Mediapie Graph configuration
      */
@@ -58,6 +61,11 @@ private:
      */
     std::string currentGraphPbTxtMD5;
 
+    /**
+     * @brief Max number of requests read from single gRPC stream which are still processed by the graph
+     */
+    uint32_t streamMaxInFlightRequests;
+
 public:
     /**
          * @brief Construct a new Mediapie Graph configuration object
@@ -72,11 +80,13 @@ public:
         const std::string& basePath = "",
         const std::string& graphPath = "",
         const std::string& subconfigPath = "",
-        const std::string& currentGraphPbTxtMD5 = "") :
+        const std::string& currentGraphPbTxtMD5 = "",
+        uint32_t streamMaxInFlightRequests = DEFAULT_STREAM_MAX_IN_FLIGHT_REQUESTS) :
         graphName(graphName),
         basePath(basePath),
         graphPath(graphPath),
-        currentGraphPbTxtMD5(currentGraphPbTxtMD5) {
+        currentGraphPbTxtMD5(currentGraphPbTxtMD5),
+        streamMaxInFlightRequests(streamMaxInFlightRequests) {
     }
 
     void clear() {
@@ -175,6 +185,24 @@ public:
         return this->rootDirectoryPath;
     }
 
+    /**
+     * @brief Get max number of requests in flight per gRPC stream
+     *
+     * @return uint32_t
+     */
+    uint32_t getStreamMaxInFlightRequests() const {
+        return this->streamMaxInFlightRequests;
+    }
+
+    /**
+     * @brief Set max number of requests in flight per gRPC stream
+     *
+     * @param streamMaxInFlightRequests
+     */
+    void setStreamMaxInFlightRequests(uint32_t streamMaxInFlightRequests) {
+        this->streamMaxInFlightRequests = streamMaxInFlightRequests;
+    }
+
     void setCurrentGraphPbTxtMD5(const std::string& currentGraphPbTxtMD5) {
         this->currentGraphPbTxtMD5 = currentGraphPbTxtMD5;
     }
@@ -29,6 +29,7 @@
 #include "../filesystem.hpp"
 #include "../kfs_frontend/kfs_utils.hpp"
 #include "../metric.hpp"
+#include "../model_metric_reporter.hpp"
 #include "../modelmanager.hpp"
 #include "../ov_utils.hpp"
 #include "../serialization.hpp"
@@ -91,6 +92,10 @@ Status MediapipeGraphDefinition::validateForConfigLoadableness() {
         SPDLOG_LOGGER_ERROR(modelmanager_logger, "Trying to parse mediapipe graph definition: {} failed", this->getName(), this->chosenConfig);
         return StatusCode::MEDIAPIPE_GRAPH_CONFIG_FILE_INVALID;
     }
+    if (this->nodeReporter->isEnabled()) {
+        // Calculator execution time metrics are read from MediaPipe calculator profiles
+        this->config.mutable_profiler_config()->set_enable_profiler(true);
+    }
     return StatusCode::OK;
 }
 
@@ -176,7 +181,8 @@ MediapipeGraphDefinition::MediapipeGraphDefinition(const std::string name,
     PythonBackend* pythonBackend) :
     name(name),
     status(SCHEDULER_CLASS_NAME, this->name),
-    pythonBackend(pythonBackend) {
+    pythonBackend(pythonBackend),
+    nodeReporter(std::make_unique<NodeMetricReporter>(metricConfig, registry, name, VERSION)) {
     mgconfig = config;
     passKfsRequestFlag = false;
 }
@@ -244,7 +250,8 @@ Status MediapipeGraphDefinition::create(std::shared_ptr<MediapipeGraphExecutor>&
     SPDLOG_DEBUG("Creating Mediapipe graph executor: {}", getName());
 
     pipeline = std::make_shared<MediapipeGraphExecutor>(getName(), std::to_string(getVersion()),
-        this->config, this->inputTypes, this->outputTypes, this->inputNames, this->outputNames, this->pythonNodeResourcesMap, this->pythonBackend);
+        this->config, this->inputTypes, this->outputTypes, this->inputNames, this->outputNames, this->pythonNodeResourcesMap, this->pythonBackend,
+        this->mgconfig.getStreamMaxInFlightRequests(), this->nodeReporter.get());
     return status;
 }
 
@@ -47,6 +47,7 @@ class MetricConfig;
 class MetricRegistry;
 class ModelManager;
 class MediapipeGraphExecutor;
+class NodeMetricReporter;
 class PythonNodeResources;
 class Status;
 class PythonBackend;
@@ -160,6 +161,8 @@ private:
     std::atomic<uint64_t> requestsHandlesCounter = 0;
 
     PythonBackend* pythonBackend;
+
+    std::unique_ptr<NodeMetricReporter> nodeReporter;
 };
 
 class MediapipeGraphDefinitionUnloadGuard {
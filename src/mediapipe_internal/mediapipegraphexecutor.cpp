@@ -15,14 +15,21 @@
 //*****************************************************************************
 #include "mediapipegraphexecutor.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <functional>
 #include <iostream>
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <queue>
 #include <set>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -31,6 +38,7 @@
 #include "../execution_context.hpp"
 #include "../kfs_frontend/kfs_utils.hpp"
 #include "../metric.hpp"
+#include "../model_metric_reporter.hpp"
 #include "../modelmanager.hpp"
 #include "../predict_request_validation_utils.hpp"
 #include "../serialization.hpp"
@@ -43,6 +51,7 @@
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 #include "mediapipe/framework/calculator_graph.h"
+#include "mediapipe/framework/calculator_profile.pb.h"
 #include "mediapipe/framework/formats/image_frame.h"
 #include "mediapipe/framework/formats/image_frame_opencv.h"
 #pragma GCC diagnostic pop
@@ -50,6 +59,8 @@
 #pragma GCC diagnostic ignored "-Wall"
 #include "mediapipe/framework/formats/tensor.h"
 #include "mediapipe/framework/port/status.h"
+#include "tensorflow/core/framework/allocation_description.pb.h"
+#include "tensorflow/core/framework/tensor.h"
 #pragma GCC diagnostic pop
 #include "opencv2/opencv.hpp"
 
@@ -96,18 +107,18 @@ const Timestamp DEFAULT_STARTING_STREAM_TIMESTAMP = Timestamp(0);
         }                                                               \
     }
 
-#define OVMS_WRITE_ERROR_ON_FAIL_AND_CONTINUE(code, message)                 \
-    {                                                                        \
-        auto status = code;                                                  \
-        if (!status.ok()) {                                                  \
-            ::inference::ModelStreamInferResponse resp;                      \
-            std::stringstream ss;                                            \
-            ss << status.string() << "; " << message;                        \
-            *resp.mutable_error_message() = ss.str();                        \
-            if (!streamSynchronizedWrite(stream, streamWriterMutex, resp)) { \
-                SPDLOG_DEBUG("Writing error to disconnected client");        \
-            }                                                                \
-        }                                                                    \
+#define OVMS_WRITE_ERROR_ON_FAIL_AND_CONTINUE(code, message)         \
+    {                                                                \
+        auto status = code;                                          \
+        if (!status.ok()) {                                          \
+            ::inference::ModelStreamInferResponse resp;              \
+            std::stringstream ss;                                    \
+            ss << status.string() << "; " << message;                \
+            *resp.mutable_error_message() = ss.str();                \
+            if (!responseWriter.push(std::move(resp))) {             \
+                SPDLOG_DEBUG("Writing error to disconnected client"); \
+            }                                                        \
+        }                                                            \
     }
 
 static Status getRequestInput(google::protobuf::internal::RepeatedPtrIterator<const inference::ModelInferRequest_InferInputTensor>& itr, const std::string& requestedName, const KFSRequest& request) {
@@ -237,7 +248,15 @@ static Status deserializeTensor(const std::string& requestedName, const KFSReque
             rawShape.emplace_back(requestInputItr->shape()[i]);
         }
         mediapipe::Tensor::Shape tensorShape{rawShape};
+        // mediapipe::Tensor always owns its CPU buffer, wrapping request memory is not possible
         outTensor = std::make_unique<mediapipe::Tensor>(datatype, tensorShape);
+        if (static_cast<size_t>(outTensor->bytes()) != bufferLocation.size()) {
+            std::stringstream ss;
+            ss << "Mediapipe deserialization content size mismatch; allocated Mediapipe Tensor: " << outTensor->bytes() << " bytes vs KServe buffer: " << bufferLocation.size() << " bytes";
+            const std::string details = ss.str();
+            SPDLOG_DEBUG("[servable name: {} version: {}] {}", request.model_name(), request.model_version(), details);
+            return Status(StatusCode::INVALID_CONTENT_SIZE, details);
+        }
         void* data;
         SET_DATA_FROM_MP_TENSOR(outTensor, GetCpuWriteView);
         std::memcpy(data, bufferLocation.data(), bufferLocation.size());
@@ -246,6 +265,34 @@ static Status deserializeTensor(const std::string& requestedName, const KFSReque
     return StatusCode::OK;
 }
 
+// Exposes KServe request buffer to Tensorflow tensor without copying the data
+class KFSRequestTensorBuffer : public tensorflow::TensorBuffer {
+    const size_t bufferSize;
+
+public:
+    KFSRequestTensorBuffer(void* data, size_t size) :
+        tensorflow::TensorBuffer(data),
+        bufferSize(size) {}
+    size_t size() const override { return bufferSize; }
+    tensorflow::TensorBuffer* root_buffer() override { return this; }
+    void FillAllocationDescription(tensorflow::AllocationDescription* proto) const override {
+        proto->set_requested_bytes(static_cast<int64_t>(bufferSize));
+        proto->set_allocator_name("kfs_request");
+    }
+    bool OwnsMemory() const override { return false; }
+};
+
+static bool canWrapInTensorflowTensor(tensorflow::DataType datatype, const tensorflow::TensorShape& shape, const std::string& buffer) {
+    if (!tensorflow::DataTypeCanUseMemcpy(datatype) || buffer.empty()) {
+        return false;
+    }
+    // Eigen maps used by tensorflow::Tensor accessors assume aligned memory
+    if (reinterpret_cast<uintptr_t>(buffer.data()) % EIGEN_MAX_ALIGN_BYTES != 0) {
+        return false;
+    }
+    return static_cast<size_t>(shape.num_elements()) * tensorflow::DataTypeSize(datatype) == buffer.size();
+}
+
 static Status deserializeTensor(const std::string& requestedName, const KFSRequest& request, std::unique_ptr<tensorflow::Tensor>& outTensor, PythonBackend* pythonBackend) {
     using tensorflow::Tensor;
     using tensorflow::TensorShape;
@@ -285,6 +332,13 @@ static Status deserializeTensor(const std::string& requestedName, const KFSReque
             auto stringViewAbslMessage = abslStatus.message();
             return Status(StatusCode::UNKNOWN_ERROR, std::string{stringViewAbslMessage});
         }
+        if (canWrapInTensorflowTensor(datatype, tensorShape, bufferLocation)) {
+            // Request is kept alive by packet holder for the lifetime of the packet
+            auto* buffer = new KFSRequestTensorBuffer(const_cast<char*>(bufferLocation.data()), bufferLocation.size());
+            outTensor = std::make_unique<tensorflow::Tensor>(datatype, tensorShape, buffer);
+            buffer->Unref();
+            return StatusCode::OK;
+        }
         outTensor = std::make_unique<tensorflow::Tensor>(datatype, tensorShape);
         if (outTensor->TotalBytes() != bufferLocation.size()) {
             std::stringstream ss;
@@ -516,7 +570,9 @@ MediapipeGraphExecutor::MediapipeGraphExecutor(const std::string& name, const st
     stream_types_mapping_t outputTypes,
     std::vector<std::string> inputNames, std::vector<std::string> outputNames,
     const PythonNodeResourcesMap& pythonNodeResourcesMap,
-    PythonBackend* pythonBackend) :
+    PythonBackend* pythonBackend,
+    uint32_t streamMaxInFlightRequests,
+    NodeMetricReporter* nodeReporter) :
     name(name),
     version(version),
     config(config),
@@ -526,6 +582,8 @@ MediapipeGraphExecutor::MediapipeGraphExecutor(const std::string& name, const st
     outputNames(std::move(outputNames)),
     pythonNodeResourcesMap(pythonNodeResourcesMap),
     pythonBackend(pythonBackend),
+    streamMaxInFlightRequests(streamMaxInFlightRequests),
+    nodeReporter(nodeReporter),
     currentStreamTimestamp(DEFAULT_STARTING_STREAM_TIMESTAMP) {}
 
 namespace {
@@ -922,6 +980,7 @@ Status MediapipeGraphExecutor::infer(const KFSRequest* request, KFSResponse* res
         SPDLOG_DEBUG("Mediapipe failed to execute. Failed to receive all output packets");
         return Status(StatusCode::MEDIAPIPE_EXECUTION_ERROR, "Unknown error during mediapipe execution");
     }
+    observeCalculatorsExecutionTime(graph);
     SPDLOG_DEBUG("Received all output stream packets for graph: {}", request->model_name());
     response->set_model_name(request->model_name());
     response->set_id(request->id());
@@ -929,6 +988,25 @@ Status MediapipeGraphExecutor::infer(const KFSRequest* request, KFSResponse* res
     return StatusCode::OK;
 }
 
+void MediapipeGraphExecutor::observeCalculatorsExecutionTime(::mediapipe::CalculatorGraph& graph) const {
+    if (!this->nodeReporter || !this->nodeReporter->isEnabled()) {
+        return;
+    }
+    // Graph is created per unary request so calculator profiles hold runtime of this request only
+    std::vector<::mediapipe::CalculatorProfile> profiles;
+    auto absStatus = graph.profiler()->GetCalculatorProfiles(&profiles);
+    if (!absStatus.ok()) {
+        SPDLOG_DEBUG("Failed to get calculator profiles of mediapipe graph: {}; {}", this->name, absStatus.ToString());
+        return;
+    }
+    for (const auto& profile : profiles) {
+        NodeMetrics* metrics = this->nodeReporter->getNodeMetrics(profile.name());
+        if (metrics) {
+            OBSERVE_IF_ENABLED(metrics->executionTime, profile.process_runtime().total());
+        }
+    }
+}
+
 Status MediapipeGraphExecutor::deserializeTimestampIfAvailable(const KFSRequest& request, Timestamp& timestamp) {
     auto timestampParamIt = request.parameters().find(TIMESTAMP_PARAMETER_NAME);
     if (timestampParamIt != request.parameters().end()) {
@@ -981,15 +1059,143 @@ Status MediapipeGraphExecutor::validateSubsequentRequest(const ::inference::Mode
     return StatusCode::OK;
 }
 
-static bool streamSynchronizedWrite(::grpc::ServerReaderWriterInterface<::inference::ModelStreamInferResponse, KFSRequest>& stream,
-    std::mutex& mtx, ::inference::ModelStreamInferResponse& resp) {
-    const std::lock_guard<std::mutex> lock(mtx);
-    return stream.Write(resp);
-}
+namespace {
+// Writes responses to gRPC stream from dedicated thread so that
+// calculator threads (output stream observers) do not block on network
+// until maxPendingResponses are waiting for slow client.
+class StreamResponseWriter {
+    ::grpc::ServerReaderWriterInterface<::inference::ModelStreamInferResponse, KFSRequest>& stream;
+    const size_t maxPendingResponses;
+    std::mutex mtx;
+    std::condition_variable signal;
+    std::condition_variable spaceAvailable;
+    std::queue<::inference::ModelStreamInferResponse> responses;
+    bool finished = false;
+    std::atomic<bool> disconnected{false};
+    std::thread writerThread;
+
+    void writeLoop() {
+        std::unique_lock<std::mutex> lock(mtx);
+        while (true) {
+            signal.wait(lock, [this]() { return finished || !responses.empty(); });
+            if (responses.empty()) {
+                break;
+            }
+            ::inference::ModelStreamInferResponse resp = std::move(responses.front());
+            responses.pop();
+            lock.unlock();
+            if (!disconnected && !stream.Write(resp)) {
+                SPDLOG_DEBUG("Writing response to disconnected client");
+                disconnected = true;
+            }
+            lock.lock();
+            // Notified under lock so that producer cannot miss disconnection set above
+            spaceAvailable.notify_all();
+        }
+    }
+
+public:
+    StreamResponseWriter(::grpc::ServerReaderWriterInterface<::inference::ModelStreamInferResponse, KFSRequest>& stream, size_t maxPendingResponses) :
+        stream(stream),
+        maxPendingResponses(std::max<size_t>(maxPendingResponses, 1)),
+        writerThread([this]() { this->writeLoop(); }) {}
+    ~StreamResponseWriter() {
+        finish();
+    }
+
+    // Blocks while queue of pending responses is full. Packet of blocked observer keeps its request in flight,
+    // so reading from the stream is paused as well.
+    // Returns false if client already disconnected
+    bool push(::inference::ModelStreamInferResponse&& resp) {
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            spaceAvailable.wait(lock, [this]() { return disconnected || responses.size() < maxPendingResponses; });
+            if (disconnected) {
+                return false;
+            }
+            responses.push(std::move(resp));
+        }
+        signal.notify_one();
+        return true;
+    }
+
+    // Blocks until there is space for a response or stop predicate is satisfied, so that no more requests are read for slow client
+    template <typename Predicate>
+    bool waitForSpace(Predicate stop) {
+        static const auto STOP_CHECK_INTERVAL = std::chrono::milliseconds(100);
+        std::unique_lock<std::mutex> lock(mtx);
+        while (!spaceAvailable.wait_for(lock, STOP_CHECK_INTERVAL, [this]() { return disconnected || responses.size() < maxPendingResponses; })) {
+            if (stop()) {
+                return false;
+            }
+        }
+        return !disconnected;
+    }
+
+    bool isDisconnected() const {
+        return disconnected;
+    }
+
+    // Writes all pending responses and stops the writer thread
+    void finish() {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            finished = true;
+        }
+        signal.notify_one();
+        if (writerThread.joinable()) {
+            writerThread.join();
+        }
+    }
+};
+
+// Counts subsequent stream requests which are still referenced by packets inside the graph.
+// Request is released by custom packet holder once graph no longer needs its data.
+class InFlightRequestsWindow {
+    const uint32_t maxInFlightRequests;
+    uint32_t inFlightRequests = 0;
+    std::mutex mtx;
+    std::condition_variable signal;
+
+public:
+    InFlightRequestsWindow(uint32_t maxInFlightRequests) :
+        maxInFlightRequests(maxInFlightRequests) {}
+
+    // Blocks until there is a free slot in the window or stop predicate is satisfied
+    template <typename Predicate>
+    bool waitForSlot(Predicate stop) {
+        static const auto STOP_CHECK_INTERVAL = std::chrono::milliseconds(100);
+        std::unique_lock<std::mutex> lock(mtx);
+        while (!signal.wait_for(lock, STOP_CHECK_INTERVAL, [this]() { return inFlightRequests < maxInFlightRequests; })) {
+            if (stop()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::shared_ptr<KFSRequest> createRequest() {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            ++inFlightRequests;
+        }
+        return std::shared_ptr<KFSRequest>(new KFSRequest(), [this](KFSRequest* request) {
+            delete request;
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+                --inFlightRequests;
+            }
+            signal.notify_one();
+        });
+    }
+};
+}  // namespace
 
 Status MediapipeGraphExecutor::inferStream(const KFSRequest& firstRequest, ::grpc::ServerReaderWriterInterface<::inference::ModelStreamInferResponse, KFSRequest>& stream) {
-    SPDLOG_DEBUG("Start streaming KServe request mediapipe graph: {} execution", this->name);
-    std::mutex streamWriterMutex;
+    SPDLOG_DEBUG("Start streaming KServe request mediapipe graph: {} execution with max in flight requests: {}", this->name, this->streamMaxInFlightRequests);
+    // Window has to outlive the graph since packets release requests on destruction
+    InFlightRequestsWindow window(this->streamMaxInFlightRequests);
+    StreamResponseWriter responseWriter(stream, this->streamMaxInFlightRequests);
     try {
         // Init
         ::mediapipe::CalculatorGraph graph;
@@ -997,14 +1203,14 @@ Status MediapipeGraphExecutor::inferStream(const KFSRequest& firstRequest, ::grp
 
         // Installing observers
         for (const auto& outputName : this->outputNames) {
-            MP_RETURN_ON_FAIL(graph.ObserveOutputStream(outputName, [&stream, &streamWriterMutex, &outputName, this](const ::mediapipe::Packet& packet) -> absl::Status {
+            MP_RETURN_ON_FAIL(graph.ObserveOutputStream(outputName, [&responseWriter, &outputName, this](const ::mediapipe::Packet& packet) -> absl::Status {
                 try {
                     ::inference::ModelStreamInferResponse resp;
                     OVMS_RETURN_MP_ERROR_ON_FAIL(serializePacket(outputName, *resp.mutable_infer_response(), packet), "error in serialization");
                     *resp.mutable_infer_response()->mutable_model_name() = this->name;
                     *resp.mutable_infer_response()->mutable_model_version() = this->version;
                     resp.mutable_infer_response()->mutable_parameters()->operator[](MediapipeGraphExecutor::TIMESTAMP_PARAMETER_NAME).set_int64_param(packet.Timestamp().Value());
-                    if (!streamSynchronizedWrite(stream, streamWriterMutex, resp)) {
+                    if (!responseWriter.push(std::move(resp))) {
                         return absl::Status(absl::StatusCode::kCancelled, "client disconnected");
                     }
                     return absl::OkStatus();
@@ -1041,8 +1247,15 @@ Status MediapipeGraphExecutor::inferStream(const KFSRequest& firstRequest, ::grp
         // Here we create ModelInferRequest with shared ownership,
         // and move it down to custom packet holder to ensure
         // lifetime is extended to lifetime of deserialized Packets.
-        auto req = std::make_shared<::inference::ModelInferRequest>();
-        while (stream.Read(req.get())) {
+        // Reading is paused when window of requests still processed by the graph is full
+        // or when responses are not received by the client fast enough,
+        // which propagates backpressure to the client through gRPC flow control.
+        auto stopReading = [&graph, &responseWriter]() { return graph.HasError() || responseWriter.isDisconnected(); };
+        while (window.waitForSlot(stopReading) && responseWriter.waitForSpace(stopReading)) {
+            auto req = window.createRequest();
+            if (!stream.Read(req.get())) {
+                break;
+            }
             auto pstatus = this->validateSubsequentRequest(*req);
             if (pstatus.ok()) {
                 OVMS_WRITE_ERROR_ON_FAIL_AND_CONTINUE(this->partialDeserialize(req, graph), "partial deserialization of subsequent requests");
@@ -1053,7 +1266,6 @@ Status MediapipeGraphExecutor::inferStream(const KFSRequest& firstRequest, ::grp
                 SPDLOG_DEBUG("Graph {}: encountered an error, stopping the execution", this->name);
                 break;
             }
-            req = std::make_shared<::inference::ModelInferRequest>();
         }
 
         SPDLOG_DEBUG("Graph {}: Closing packet sources...", this->name);
@@ -1063,6 +1275,10 @@ Status MediapipeGraphExecutor::inferStream(const KFSRequest& firstRequest, ::grp
         SPDLOG_DEBUG("Graph {}: Closed all packet sources. Waiting untill done...", this->name);
         MP_RETURN_ON_FAIL(graph.WaitUntilDone(), "waiting until done", StatusCode::MEDIAPIPE_EXECUTION_ERROR);
         SPDLOG_DEBUG("Graph {}: Done execution", this->name);
+        responseWriter.finish();
+        if (responseWriter.isDisconnected()) {
+            return Status(StatusCode::MEDIAPIPE_EXECUTION_ERROR, "client disconnected");
+        }
         return StatusCode::OK;
     } catch (...) {
         return Status(StatusCode::UNKNOWN_ERROR, "Exception while processing MediaPipe graph");  // To be displayed in method level above
@@ -36,6 +36,7 @@ namespace ovms {
 class Status;
 class PythonNodeResources;
 class PythonBackend;
+class NodeMetricReporter;
 
 class MediapipeGraphExecutor {
     const std::string name;
@@ -49,11 +50,15 @@ class MediapipeGraphExecutor {
     PythonNodeResourcesMap pythonNodeResourcesMap;
     PythonBackend* pythonBackend;
 
+    const uint32_t streamMaxInFlightRequests;
+    NodeMetricReporter* nodeReporter;
+
     ::mediapipe::Timestamp currentStreamTimestamp;
 
     static Status deserializeTimestampIfAvailable(const KFSRequest& request, ::mediapipe::Timestamp& timestamp);
     Status partialDeserialize(std::shared_ptr<const ::inference::ModelInferRequest> request, ::mediapipe::CalculatorGraph& graph);
     Status validateSubsequentRequest(const ::inference::ModelInferRequest& request) const;
+    void observeCalculatorsExecutionTime(::mediapipe::CalculatorGraph& graph) const;
 
 protected:
     Status serializePacket(const std::string& name, ::inference::ModelInferResponse& response, const ::mediapipe::Packet& packet) const;
@@ -65,7 +70,9 @@ public:
         stream_types_mapping_t outputTypes,
         std::vector<std::string> inputNames, std::vector<std::string> outputNames,
         const PythonNodeResourcesMap& pythonNodeResourcesMap,
-        PythonBackend* pythonBackend);
+        PythonBackend* pythonBackend,
+        uint32_t streamMaxInFlightRequests = DEFAULT_STREAM_MAX_IN_FLIGHT_REQUESTS,
+        NodeMetricReporter* nodeReporter = nullptr);
     Status infer(const KFSRequest* request, KFSResponse* response, ExecutionContext executionContext, ServableMetricReporter*& reporterOut) const;
 
     Status inferStream(const ::inference::ModelInferRequest& firstRequest, ::grpc::ServerReaderWriterInterface<::inference::ModelStreamInferResponse, ::inference::ModelInferRequest>& stream);
@@ -15,21 +15,33 @@
 //*****************************************************************************
 #include "metric.hpp"
 
+#include <utility>
+
 #include <prometheus/counter.h>
 #include <prometheus/gauge.h>
 #include <prometheus/histogram.h>
 
+#include "metric_shards.hpp"
+
 namespace ovms {
 
 MetricCounter::MetricCounter(prometheus::Counter& counterImpl) :
-    counterImpl(counterImpl) {}
+    counterImpl(counterImpl),
+    shards(std::make_shared<CounterShards>(counterImpl)) {}
+
+MetricCounter::~MetricCounter() = default;
 
 void MetricCounter::increment(double value) {
-    this->counterImpl.Increment(value);
+    this->shards->increment(value);
 }
 
 MetricGauge::MetricGauge(prometheus::Gauge& gaugeImpl) :
-    gaugeImpl(gaugeImpl) {}
+    gaugeImpl(gaugeImpl),
+    valueProvider(std::make_shared<GaugeValueProvider>(gaugeImpl)) {}
+
+MetricGauge::~MetricGauge() {
+    this->valueProvider->setProvider(nullptr);
+}
 
 void MetricGauge::increment(double value) {
     this->gaugeImpl.Increment(value);
@@ -43,11 +55,18 @@ void MetricGauge::set(double value) {
     this->gaugeImpl.Set(value);
 }
 
+void MetricGauge::setValueProvider(std::function<double()> provider) {
+    this->valueProvider->setProvider(std::move(provider));
+}
+
 MetricHistogram::MetricHistogram(prometheus::Histogram& histogramImpl) :
-    histogramImpl(histogramImpl) {}
+    histogramImpl(histogramImpl),
+    shards(std::make_shared<HistogramShards>(histogramImpl)) {}
+
+MetricHistogram::~MetricHistogram() = default;
 
 void MetricHistogram::observe(double value) {
-    this->histogramImpl.Observe(value);
+    this->shards->observe(value);
 }
 
 }  // namespace ovms
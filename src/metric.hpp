@@ -15,6 +15,8 @@
 //*****************************************************************************
 #pragma once
 
+#include <functional>
+#include <memory>
 #include <string>
 
 namespace prometheus {
@@ -44,6 +46,9 @@ namespace ovms {
 
 template <typename T>
 class MetricFamily;
+class CounterShards;
+class GaugeValueProvider;
+class HistogramShards;
 
 class MetricCounter {
 private:
@@ -53,10 +58,13 @@ private:
     MetricCounter& operator=(const MetricCounter&) = delete;
 
 public:
+    ~MetricCounter();
+
     void increment(double value = 1.0f);
 
 private:
     prometheus::Counter& counterImpl;
+    std::shared_ptr<CounterShards> shards;
 
     friend class MetricFamily<MetricCounter>;
 };
@@ -67,13 +75,21 @@ public:
     MetricGauge(const MetricGauge&) = delete;
     MetricGauge(MetricCounter&&) = delete;
     MetricGauge& operator=(const MetricGauge&) = delete;
+    ~MetricGauge();
 
     void increment(double value = 1.0f);
     void decrement(double value = 1.0f);
     void set(double value = 1.0f);
 
+    /**
+     * @brief Gauge is set to the value returned by provider when metrics are collected.
+     * Provider has to be reset with nullptr before data it reads is destroyed.
+     */
+    void setValueProvider(std::function<double()> provider);
+
 private:
     prometheus::Gauge& gaugeImpl;
+    std::shared_ptr<GaugeValueProvider> valueProvider;
 
     friend class MetricFamily<MetricGauge>;
 };
@@ -84,11 +100,13 @@ public:
     MetricHistogram(const MetricHistogram&) = delete;
     MetricHistogram(MetricCounter&&) = delete;
     MetricHistogram& operator=(const MetricHistogram&) = delete;
+    ~MetricHistogram();
 
     void observe(double value);
 
 private:
     prometheus::Histogram& histogramImpl;
+    std::shared_ptr<HistogramShards> shards;
 
     friend class MetricFamily<MetricHistogram>;
 };
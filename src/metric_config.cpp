@@ -38,11 +38,25 @@ const std::string METRIC_NAME_STREAMS = "ovms_streams";
 const std::string METRIC_NAME_INFER_REQ_QUEUE_SIZE = "ovms_infer_req_queue_size";
 
 const std::string METRIC_NAME_INFER_REQ_ACTIVE = "ovms_infer_req_active";
+const std::string METRIC_NAME_INFER_REQ_WAITING = "ovms_infer_req_waiting";
+const std::string METRIC_NAME_INFER_REQ_OLDEST_WAIT_TIME = "ovms_infer_req_oldest_wait_time_us";
 
 const std::string METRIC_NAME_INFERENCE_TIME = "ovms_inference_time_us";
 const std::string METRIC_NAME_CURRENT_REQUESTS = "ovms_current_requests";
 const std::string METRIC_NAME_REQUEST_TIME = "ovms_request_time_us";
 const std::string METRIC_NAME_WAIT_FOR_INFER_REQ_TIME = "ovms_wait_for_infer_req_time_us";
+const std::string METRIC_NAME_WAIT_FOR_INFER_REQ_TIME_BY_PRIORITY = "ovms_wait_for_infer_req_time_by_priority_us";
+
+const std::string METRIC_NAME_COMPILATION_TIME = "ovms_compilation_time_us";
+const std::string METRIC_NAME_MODEL_CACHE_HIT = "ovms_model_cache_hit";
+const std::string METRIC_NAME_MODEL_CACHE_MISS = "ovms_model_cache_miss";
+const std::string METRIC_NAME_MODEL_MEMORY = "ovms_model_memory_bytes";
+
+const std::string METRIC_NAME_VALIDATION_TIME = "ovms_validation_time_us";
+const std::string METRIC_NAME_DESERIALIZATION_TIME = "ovms_deserialization_time_us";
+const std::string METRIC_NAME_SERIALIZATION_TIME = "ovms_serialization_time_us";
+const std::string METRIC_NAME_NODE_EXECUTION_TIME = "ovms_node_execution_time_us";
+const std::string METRIC_NAME_NODE_WAIT_FOR_INFER_REQ_TIME = "ovms_node_wait_for_infer_req_time_us";
 
 bool MetricConfig::validateEndpointPath(const std::string& endpoint) {
     std::regex valid_endpoint_regex("^/[a-zA-Z0-9]*$");
@@ -30,11 +30,25 @@ extern const std::string METRIC_NAME_STREAMS;
 extern const std::string METRIC_NAME_INFER_REQ_QUEUE_SIZE;
 
 extern const std::string METRIC_NAME_INFER_REQ_ACTIVE;
+extern const std::string METRIC_NAME_INFER_REQ_WAITING;
+extern const std::string METRIC_NAME_INFER_REQ_OLDEST_WAIT_TIME;
 
 extern const std::string METRIC_NAME_INFERENCE_TIME;
 extern const std::string METRIC_NAME_CURRENT_REQUESTS;
 extern const std::string METRIC_NAME_REQUEST_TIME;
 extern const std::string METRIC_NAME_WAIT_FOR_INFER_REQ_TIME;
+extern const std::string METRIC_NAME_WAIT_FOR_INFER_REQ_TIME_BY_PRIORITY;
+
+extern const std::string METRIC_NAME_COMPILATION_TIME;
+extern const std::string METRIC_NAME_MODEL_CACHE_HIT;
+extern const std::string METRIC_NAME_MODEL_CACHE_MISS;
+extern const std::string METRIC_NAME_MODEL_MEMORY;
+
+extern const std::string METRIC_NAME_VALIDATION_TIME;
+extern const std::string METRIC_NAME_DESERIALIZATION_TIME;
+extern const std::string METRIC_NAME_SERIALIZATION_TIME;
+extern const std::string METRIC_NAME_NODE_EXECUTION_TIME;
+extern const std::string METRIC_NAME_NODE_WAIT_FOR_INFER_REQ_TIME;
 
 class Status;
 /**
@@ -74,7 +88,19 @@ private:
 
     std::unordered_set<std::string> additionalMetricFamilies = {
         {METRIC_NAME_INFER_REQ_QUEUE_SIZE},
-        {METRIC_NAME_INFER_REQ_ACTIVE}};
+        {METRIC_NAME_INFER_REQ_ACTIVE},
+        {METRIC_NAME_INFER_REQ_WAITING},
+        {METRIC_NAME_INFER_REQ_OLDEST_WAIT_TIME},
+        {METRIC_NAME_COMPILATION_TIME},
+        {METRIC_NAME_MODEL_CACHE_HIT},
+        {METRIC_NAME_MODEL_CACHE_MISS},
+        {METRIC_NAME_MODEL_MEMORY},
+        {METRIC_NAME_WAIT_FOR_INFER_REQ_TIME_BY_PRIORITY},
+        {METRIC_NAME_VALIDATION_TIME},
+        {METRIC_NAME_DESERIALIZATION_TIME},
+        {METRIC_NAME_SERIALIZATION_TIME},
+        {METRIC_NAME_NODE_EXECUTION_TIME},
+        {METRIC_NAME_NODE_WAIT_FOR_INFER_REQ_TIME}};
 
     std::unordered_set<std::string> defaultMetricFamilies = {
         {METRIC_NAME_CURRENT_REQUESTS},
@@ -21,72 +21,89 @@
 #include <prometheus/registry.h>
 
 #include "metric.hpp"
+#include "metric_registry.hpp"
+#include "metric_shards.hpp"
 
 namespace ovms {
 
 template <>
-MetricFamily<MetricCounter>::MetricFamily(const std::string& name, const std::string& description, prometheus::Registry& registryImplRef) :
-    registryImplRef(registryImplRef),
+MetricFamily<MetricCounter>::MetricFamily(const std::string& name, const std::string& description, MetricRegistry& registry) :
+    registry(registry),
+    registryImplRef(registry.registryImpl),
     familyImplRef(&prometheus::BuildCounter()
                        .Name(name)
                        .Help(description)
                        .Register(this->registryImplRef)) {
+    this->registry.addFamily(name, static_cast<prometheus::Family<prometheus::Counter>*>(this->familyImplRef));
 }
 
 template <>
-MetricFamily<MetricGauge>::MetricFamily(const std::string& name, const std::string& description, prometheus::Registry& registryImplRef) :
-    registryImplRef(registryImplRef),
+MetricFamily<MetricGauge>::MetricFamily(const std::string& name, const std::string& description, MetricRegistry& registry) :
+    registry(registry),
+    registryImplRef(registry.registryImpl),
     familyImplRef(&prometheus::BuildGauge()
                        .Name(name)
                        .Help(description)
                        .Register(this->registryImplRef)) {
+    this->registry.addFamily(name, static_cast<prometheus::Family<prometheus::Gauge>*>(this->familyImplRef));
 }
 
 template <>
-MetricFamily<MetricHistogram>::MetricFamily(const std::string& name, const std::string& description, prometheus::Registry& registryImplRef) :
-    registryImplRef(registryImplRef),
+MetricFamily<MetricHistogram>::MetricFamily(const std::string& name, const std::string& description, MetricRegistry& registry) :
+    registry(registry),
+    registryImplRef(registry.registryImpl),
     familyImplRef(&prometheus::BuildHistogram()
                        .Name(name)
                        .Help(description)
                        .Register(this->registryImplRef)) {
+    this->registry.addFamily(name, static_cast<prometheus::Family<prometheus::Histogram>*>(this->familyImplRef));
 }
 
 template <>
 std::unique_ptr<MetricCounter> MetricFamily<MetricCounter>::addMetric(const MetricLabels& labels, const BucketBoundaries& bucketBoundaries) {
     auto familyImpl = static_cast<prometheus::Family<prometheus::Counter>*>(this->familyImplRef);
     prometheus::Counter& counterImpl = familyImpl->Add(labels);
-    return std::unique_ptr<MetricCounter>(new MetricCounter(counterImpl));
+    auto metric = std::unique_ptr<MetricCounter>(new MetricCounter(counterImpl));
+    this->registry.addShards(this->familyImplRef, metric->shards);
+    return metric;
 }
 
 template <>
 std::unique_ptr<MetricGauge> MetricFamily<MetricGauge>::addMetric(const MetricLabels& labels, const BucketBoundaries& bucketBoundaries) {
     auto familyImpl = static_cast<prometheus::Family<prometheus::Gauge>*>(this->familyImplRef);
     prometheus::Gauge& gaugeImpl = familyImpl->Add(labels);
-    return std::unique_ptr<MetricGauge>(new MetricGauge(gaugeImpl));
+    auto metric = std::unique_ptr<MetricGauge>(new MetricGauge(gaugeImpl));
+    this->registry.addShards(this->familyImplRef, metric->valueProvider);
+    return metric;
 }
 
 template <>
 std::unique_ptr<MetricHistogram> MetricFamily<MetricHistogram>::addMetric(const MetricLabels& labels, const BucketBoundaries& bucketBoundaries) {
     auto familyImpl = static_cast<prometheus::Family<prometheus::Histogram>*>(this->familyImplRef);
     prometheus::Histogram& histogramImpl = familyImpl->Add(labels, bucketBoundaries);
-    return std::unique_ptr<MetricHistogram>(new MetricHistogram(histogramImpl));
+    auto metric = std::unique_ptr<MetricHistogram>(new MetricHistogram(histogramImpl));
+    this->registry.addShards(this->familyImplRef, metric->shards);
+    return metric;
 }
 
 template <>
 void MetricFamily<MetricCounter>::remove(std::unique_ptr<MetricCounter>& metric) {
     auto family = static_cast<prometheus::Family<prometheus::Counter>*>(this->familyImplRef);
+    this->registry.removeShards(this->familyImplRef, metric->shards.get());
     family->Remove(&metric->counterImpl);
 }
 
 template <>
 void MetricFamily<MetricGauge>::remove(std::unique_ptr<MetricGauge>& metric) {
     auto family = static_cast<prometheus::Family<prometheus::Gauge>*>(this->familyImplRef);
+    this->registry.removeShards(this->familyImplRef, metric->valueProvider.get());
     family->Remove(&metric->gaugeImpl);
 }
 
 template <>
 void MetricFamily<MetricHistogram>::remove(std::unique_ptr<MetricHistogram>& metric) {
     auto family = static_cast<prometheus::Family<prometheus::Histogram>*>(this->familyImplRef);
+    this->registry.removeShards(this->familyImplRef, metric->shards.get());
     family->Remove(&metric->histogramImpl);
 }
 
@@ -34,7 +34,7 @@ class MetricRegistry;
 template <typename MetricType>
 class MetricFamily {
 private:
-    MetricFamily(const std::string& name, const std::string& description, prometheus::Registry& registryImplRef);
+    MetricFamily(const std::string& name, const std::string& description, MetricRegistry& registry);
     MetricFamily(const MetricFamily&) = delete;
     MetricFamily(MetricFamily&&) = delete;
     MetricFamily& operator=(const MetricFamily&) = delete;
@@ -47,6 +47,7 @@ public:
     void remove(std::unique_ptr<MetricType>& metric);
 
 private:
+    MetricRegistry& registry;
     prometheus::Registry& registryImplRef;
     void* familyImplRef;  // This is reference to prometheus::Family<T> where T is prometheus::Counter/Gauge/Histogram depending on MetricType.
 
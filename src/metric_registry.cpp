@@ -15,33 +15,103 @@
 //*****************************************************************************
 #include "metric_registry.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
 #include <prometheus/family.h>
 #include <prometheus/text_serializer.h>
 
 #include "metric.hpp"
 #include "metric_family.hpp"
+#include "metric_shards.hpp"
 
 namespace ovms {
 
 MetricRegistry::MetricRegistry() = default;
 
-std::string MetricRegistry::collect() const {
+void MetricRegistry::addShards(const void* familyImpl, std::shared_ptr<MetricShards> metricShards) {
+    std::lock_guard<std::mutex> lock(this->shardsMtx);
+    this->shards[familyImpl].push_back(std::move(metricShards));
+}
+
+void MetricRegistry::removeShards(const void* familyImpl, const MetricShards* metricShards) {
+    std::lock_guard<std::mutex> lock(this->shardsMtx);
+    auto it = this->shards.find(familyImpl);
+    if (it == this->shards.end()) {
+        return;
+    }
+    auto& familyShards = it->second;
+    familyShards.erase(std::remove_if(familyShards.begin(), familyShards.end(), [metricShards](const auto& shards) { return shards.get() == metricShards; }), familyShards.end());
+}
+
+void MetricRegistry::flushShards() const {
+    std::lock_guard<std::mutex> lock(this->shardsMtx);
+    for (auto& [familyImpl, familyShards] : this->shards) {
+        for (const auto& metricShards : familyShards) {
+            metricShards->flush();
+        }
+        // Drop shards of destroyed metrics, their values were just flushed
+        familyShards.erase(std::remove_if(familyShards.begin(), familyShards.end(), [](const auto& shards) { return shards.use_count() == 1; }), familyShards.end());
+    }
+}
+
+void MetricRegistry::addFamily(const std::string& name, prometheus::Collectable* familyImpl) {
+    std::lock_guard<std::mutex> lock(this->familiesMtx);
+    this->families[name] = familyImpl;
+}
+
+std::string MetricRegistry::collect(const std::set<std::string>& familiesFilter) const {
+    this->flushShards();
     prometheus::TextSerializer serializer;
-    return serializer.Serialize(this->registryImpl.Collect());
+    if (familiesFilter.empty()) {
+        return serializer.Serialize(this->registryImpl.Collect());
+    }
+    std::vector<prometheus::MetricFamily> collected;
+    {
+        std::lock_guard<std::mutex> lock(this->familiesMtx);
+        for (const auto& name : familiesFilter) {
+            auto it = this->families.find(name);
+            if (it == this->families.end()) {
+                continue;
+            }
+            auto familyCollected = it->second->Collect();
+            std::move(familyCollected.begin(), familyCollected.end(), std::back_inserter(collected));
+        }
+    }
+    return serializer.Serialize(collected);
 }
 
 template <>
 bool MetricRegistry::remove(std::shared_ptr<MetricFamily<MetricCounter>> family) {
+    {
+        std::lock_guard<std::mutex> lock(this->shardsMtx);
+        this->shards.erase(family->familyImplRef);
+    }
+    std::lock_guard<std::mutex> lock(this->familiesMtx);
+    this->families.erase(static_cast<prometheus::Family<prometheus::Counter>*>(family->familyImplRef)->GetName());
     return this->registryImpl.Remove(*static_cast<prometheus::Family<prometheus::Counter>*>(family->familyImplRef));
 }
 
 template <>
 bool MetricRegistry::remove(std::shared_ptr<MetricFamily<MetricGauge>> family) {
+    {
+        std::lock_guard<std::mutex> lock(this->shardsMtx);
+        this->shards.erase(family->familyImplRef);
+    }
+    std::lock_guard<std::mutex> lock(this->familiesMtx);
+    this->families.erase(static_cast<prometheus::Family<prometheus::Gauge>*>(family->familyImplRef)->GetName());
     return this->registryImpl.Remove(*static_cast<prometheus::Family<prometheus::Gauge>*>(family->familyImplRef));
 }
 
 template <>
 bool MetricRegistry::remove(std::shared_ptr<MetricFamily<MetricHistogram>> family) {
+    {
+        std::lock_guard<std::mutex> lock(this->shardsMtx);
+        this->shards.erase(family->familyImplRef);
+    }
+    std::lock_guard<std::mutex> lock(this->familiesMtx);
+    this->families.erase(static_cast<prometheus::Family<prometheus::Histogram>*>(family->familyImplRef)->GetName());
     return this->registryImpl.Remove(*static_cast<prometheus::Family<prometheus::Histogram>*>(family->familyImplRef));
 }
 
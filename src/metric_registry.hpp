@@ -16,7 +16,11 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
+#include <set>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <prometheus/registry.h>
 
@@ -24,6 +28,7 @@ namespace ovms {
 
 template <typename MetricType>
 class MetricFamily;
+class MetricShards;
 
 class MetricRegistry {
 public:
@@ -36,7 +41,7 @@ public:
     std::shared_ptr<MetricFamily<MetricType>> createFamily(const std::string& name, const std::string& description) {
         try {
             return std::shared_ptr<MetricFamily<MetricType>>(
-                new MetricFamily<MetricType>(name, description, this->registryImpl));
+                new MetricFamily<MetricType>(name, description, *this));
         } catch (std::invalid_argument&) {
             return nullptr;
         }
@@ -45,11 +50,30 @@ public:
     template <typename MetricType>
     bool remove(std::shared_ptr<MetricFamily<MetricType>> family);
 
-    // Returns all collected metrics in "Prometheus Text Exposition Format".
-    std::string collect() const;
+    // Returns collected metrics in "Prometheus Text Exposition Format".
+    // Only families named in familiesFilter are collected, all when it is empty.
+    // Values recorded in metric shards are aggregated first.
+    std::string collect(const std::set<std::string>& familiesFilter = {}) const;
 
 private:
+    void addShards(const void* familyImpl, std::shared_ptr<MetricShards> shards);
+    void removeShards(const void* familyImpl, const MetricShards* shards);
+    void flushShards() const;
+    void addFamily(const std::string& name, prometheus::Collectable* familyImpl);
+
     prometheus::Registry registryImpl;
+
+    // Families by name, so that filtered collection does not collect other families.
+    // Lock is held while filtered families are collected, so that they are not removed meanwhile.
+    mutable std::mutex familiesMtx;
+    std::unordered_map<std::string, prometheus::Collectable*> families;
+
+    // Shards are kept after metric is destroyed until their last values are flushed
+    mutable std::mutex shardsMtx;
+    mutable std::unordered_map<const void*, std::vector<std::shared_ptr<MetricShards>>> shards;
+
+    template <typename MetricType>
+    friend class MetricFamily;
 };
 
 }  // namespace ovms
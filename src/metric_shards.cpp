@@ -0,0 +1,117 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "metric_shards.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include <prometheus/counter.h>
+#include <prometheus/gauge.h>
+#include <prometheus/histogram.h>
+
+namespace ovms {
+
+static_assert((MetricShards::SHARDS_COUNT & (MetricShards::SHARDS_COUNT - 1)) == 0, "Metric shards count has to be power of 2");
+
+static void atomicAdd(std::atomic<double>& target, double value) {
+    double current = target.load(std::memory_order_relaxed);
+    while (!target.compare_exchange_weak(current, current + value, std::memory_order_relaxed)) {
+    }
+}
+
+size_t MetricShards::getShardIndex() {
+    // Threads get consecutive shards, so up to SHARDS_COUNT threads never share a cache line
+    static std::atomic<size_t> nextShard{0};
+    static thread_local const size_t shardIndex = nextShard.fetch_add(1, std::memory_order_relaxed) & (SHARDS_COUNT - 1);
+    return shardIndex;
+}
+
+CounterShards::CounterShards(prometheus::Counter& counterImpl) :
+    counterImpl(counterImpl),
+    shards(std::make_unique<Shard[]>(SHARDS_COUNT)) {}
+
+void CounterShards::increment(double value) {
+    if (value < 0) {
+        // Counter cannot decrease, same as prometheus::Counter
+        return;
+    }
+    atomicAdd(shards[getShardIndex()].value, value);
+}
+
+void CounterShards::flush() {
+    double total = 0;
+    for (size_t i = 0; i < SHARDS_COUNT; ++i) {
+        total += shards[i].value.exchange(0, std::memory_order_relaxed);
+    }
+    if (total > 0) {
+        counterImpl.Increment(total);
+    }
+}
+
+HistogramShards::HistogramShards(prometheus::Histogram& histogramImpl) :
+    histogramImpl(histogramImpl) {
+    // Boundaries are taken from prometheus metric, since family returns already existing metric when labels repeat
+    for (const auto& bucket : histogramImpl.Collect().histogram.bucket) {
+        bucketBoundaries.push_back(bucket.upper_bound);
+    }
+    if (!bucketBoundaries.empty()) {
+        bucketBoundaries.pop_back();  // +Inf
+    }
+    linesPerShard = (bucketBoundaries.size() + 1 + COUNTS_PER_LINE - 1) / COUNTS_PER_LINE;
+    counts = std::make_unique<CountsLine[]>(SHARDS_COUNT * linesPerShard);
+    sums = std::make_unique<SumShard[]>(SHARDS_COUNT);
+}
+
+void HistogramShards::observe(double value) {
+    const size_t shard = getShardIndex();
+    const size_t bucket = std::lower_bound(bucketBoundaries.begin(), bucketBoundaries.end(), value) - bucketBoundaries.begin();
+    counts[shard * linesPerShard + bucket / COUNTS_PER_LINE].counts[bucket % COUNTS_PER_LINE].fetch_add(1, std::memory_order_relaxed);
+    atomicAdd(sums[shard].sum, value);
+}
+
+void HistogramShards::flush() {
+    std::vector<double> bucketIncrements(bucketBoundaries.size() + 1, 0);
+    double sum = 0;
+    bool observed = false;
+    for (size_t shard = 0; shard < SHARDS_COUNT; ++shard) {
+        for (size_t bucket = 0; bucket < bucketIncrements.size(); ++bucket) {
+            const uint64_t count = counts[shard * linesPerShard + bucket / COUNTS_PER_LINE].counts[bucket % COUNTS_PER_LINE].exchange(0, std::memory_order_relaxed);
+            bucketIncrements[bucket] += count;
+            observed |= (count > 0);
+        }
+        sum += sums[shard].sum.exchange(0, std::memory_order_relaxed);
+    }
+    if (observed) {
+        histogramImpl.ObserveMultiple(bucketIncrements, sum);
+    }
+}
+
+GaugeValueProvider::GaugeValueProvider(prometheus::Gauge& gaugeImpl) :
+    gaugeImpl(gaugeImpl) {}
+
+void GaugeValueProvider::setProvider(std::function<double()> provider) {
+    std::lock_guard<std::mutex> lock(providerMtx);
+    this->provider = std::move(provider);
+}
+
+void GaugeValueProvider::flush() {
+    std::lock_guard<std::mutex> lock(providerMtx);
+    if (provider) {
+        gaugeImpl.Set(provider());
+    }
+}
+
+}  // namespace ovms
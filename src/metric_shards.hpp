@@ -0,0 +1,114 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace prometheus {
+class Counter;
+class Gauge;
+class Histogram;
+}  // namespace prometheus
+
+namespace ovms {
+
+/**
+ * @brief Metric state moved into prometheus metric only when registry is collected.
+ * Counters and histograms are recorded by request threads into per thread shards, each in a separate cache line,
+ * so request path does not take prometheus histogram lock nor update atomics shared with other threads.
+ */
+class MetricShards {
+public:
+    static constexpr size_t SHARDS_COUNT = 16;
+
+    virtual ~MetricShards() = default;
+
+    /**
+     * @brief Moves values accumulated in shards into prometheus metric
+     */
+    virtual void flush() = 0;
+
+protected:
+    static size_t getShardIndex();
+};
+
+class CounterShards : public MetricShards {
+public:
+    explicit CounterShards(prometheus::Counter& counterImpl);
+
+    void increment(double value);
+    void flush() override;
+
+private:
+    struct alignas(64) Shard {
+        std::atomic<double> value{0};
+    };
+
+    prometheus::Counter& counterImpl;
+    std::unique_ptr<Shard[]> shards;
+};
+
+class HistogramShards : public MetricShards {
+public:
+    explicit HistogramShards(prometheus::Histogram& histogramImpl);
+
+    void observe(double value);
+    void flush() override;
+
+private:
+    static constexpr size_t COUNTS_PER_LINE = 64 / sizeof(std::atomic<uint64_t>);
+
+    struct alignas(64) CountsLine {
+        std::atomic<uint64_t> counts[COUNTS_PER_LINE] = {};
+    };
+    struct alignas(64) SumShard {
+        std::atomic<double> sum{0};
+    };
+
+    prometheus::Histogram& histogramImpl;
+    std::vector<double> bucketBoundaries;
+    size_t linesPerShard;
+    std::unique_ptr<CountsLine[]> counts;
+    std::unique_ptr<SumShard[]> sums;
+};
+
+/**
+ * @brief Sets gauge to the value returned by provider when registry is collected,
+ * for gauges which change continuously, like waiting time
+ */
+class GaugeValueProvider : public MetricShards {
+public:
+    explicit GaugeValueProvider(prometheus::Gauge& gaugeImpl);
+
+    /**
+     * @brief Replaces provider, after the call previous provider is not used anymore
+     */
+    void setProvider(std::function<double()> provider);
+    void flush() override;
+
+private:
+    prometheus::Gauge& gaugeImpl;
+    std::mutex providerMtx;
+    std::function<double()> provider;
+};
+
+}  // namespace ovms
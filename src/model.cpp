@@ -94,6 +94,7 @@ void Model::updateDefaultVersion(int ignoredVersion) {
         }
     }
     defaultVersion = newDefaultVersion;
+    publishVersionsSnapshot();
     if (newDefaultVersion) {
         SPDLOG_INFO("Updated default version for model: {}, to: {}", getName(), newDefaultVersion);
     } else {
@@ -101,13 +102,21 @@ void Model::updateDefaultVersion(int ignoredVersion) {
     }
 }
 
+void Model::publishVersionsSnapshot() {
+    std::unique_lock lock(modelVersionsMtx);
+    auto snapshot = std::make_unique<VersionsSnapshot>();
+    snapshot->versions = modelVersions;
+    snapshot->defaultVersion = defaultVersion;
+    versionsSnapshot.publish(std::move(snapshot));
+}
+
 const std::shared_ptr<ModelInstance> Model::getDefaultModelInstance() const {
-    std::shared_lock lock(modelVersionsMtx);
-    auto defaultVersion = getDefaultVersion();
-    const auto modelInstanceIt = modelVersions.find(defaultVersion);
+    RcuReadGuard guard;
+    const auto& snapshot = versionsSnapshot.read(guard);
+    const auto modelInstanceIt = snapshot.versions.find(snapshot.defaultVersion);
 
-    if (modelVersions.end() == modelInstanceIt) {
-        SPDLOG_WARN("Default version: {} for model: {} not found", defaultVersion, getName());
+    if (snapshot.versions.end() == modelInstanceIt) {
+        SPDLOG_WARN("Default version: {} for model: {} not found", snapshot.defaultVersion, getName());
         return nullptr;
     }
     return modelInstanceIt->second;
@@ -131,6 +140,7 @@ Status Model::addVersion(const ModelConfig& config, ov::Core& ieCore, MetricRegi
     std::unique_lock lock(modelVersionsMtx);
     modelVersions.emplace(version, modelInstance);
     lock.unlock();
+    publishVersionsSnapshot();
     auto status = modelInstance->loadModel(config);
     if (!status.ok()) {
         return status;
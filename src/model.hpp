@@ -27,6 +27,7 @@
 #include "modelchangesubscription.hpp"
 #include "modelconfig.hpp"
 #include "modelversion.hpp"
+#include "rcu.hpp"
 
 namespace ov {
 class Core;
@@ -63,6 +64,15 @@ private:
       */
     void updateDefaultVersion(int ignoredVersion = 0);
 
+    /**
+     * @brief Versions lookup used by requests, read without taking modelVersionsMtx
+     */
+    struct VersionsSnapshot {
+        std::map<model_version_t, std::shared_ptr<ModelInstance>> versions;
+        model_version_t defaultVersion = 0;
+    };
+    RcuSnapshot<VersionsSnapshot> versionsSnapshot;
+
 protected:
     /**
          * @brief Model name
@@ -80,6 +90,11 @@ protected:
          */
     model_version_t defaultVersion = 0;
 
+    /**
+     * @brief Publishes current modelVersions and defaultVersion to request threads. Needs to be called after each change of those.
+     */
+    void publishVersionsSnapshot();
+
     /**
          * @brief Get default version
          *
@@ -173,9 +188,10 @@ public:
          * @return specific model version
          */
     const std::shared_ptr<ModelInstance> getModelInstanceByVersion(const model_version_t& version) const {
-        std::shared_lock lock(modelVersionsMtx);
-        auto it = modelVersions.find(version);
-        return it != modelVersions.end() ? it->second : nullptr;
+        RcuReadGuard guard;
+        const auto& versions = versionsSnapshot.read(guard).versions;
+        auto it = versions.find(version);
+        return it != versions.end() ? it->second : nullptr;
     }
 
     /**
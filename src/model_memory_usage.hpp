@@ -0,0 +1,54 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <string>
+
+#include "modelversion.hpp"
+
+namespace ovms {
+
+/**
+ * @brief Host memory in bytes owned by a single model version
+ */
+struct ModelMemoryUsage {
+    // Constants of ov::Model, without shared weights
+    size_t weights = 0;
+    // Constants backed by custom loader weights buffer shared with other model versions with identical weights.
+    // Every sharing version reports the same buffer, so it is excluded from total and exact
+    size_t sharedWeights = 0;
+    // Growth of process resident memory during compilation, estimate since other allocations may happen meanwhile
+    size_t compiledModel = 0;
+    // Input and output tensors of infer requests queue
+    size_t inferRequests = 0;
+    // Memory state tensors of sequences kept by stateful model
+    size_t sequenceState = 0;
+
+    size_t total() const {
+        return weights + compiledModel + inferRequests + sequenceState;
+    }
+
+    // Sizes computed from model and tensors, without compiled model estimate which depends on concurrent allocations
+    size_t exact() const {
+        return weights + inferRequests + sequenceState;
+    }
+};
+
+using models_memory_usage_t = std::map<std::string, std::map<model_version_t, ModelMemoryUsage>>;
+
+}  // namespace ovms
@@ -17,6 +17,8 @@
 
 #include <cmath>
 #include <exception>
+#include <mutex>
+#include <utility>
 
 #include "execution_context.hpp"
 #include "logging.hpp"
@@ -36,6 +38,24 @@ constexpr double BUCKET_MULTIPLIER = 10;
         throw std::logic_error(MESSAGE);                   \
     }
 
+static std::vector<double> createBuckets() {
+    std::vector<double> buckets;
+    for (int i = 0; i < NUMBER_OF_BUCKETS; i++) {
+        buckets.emplace_back(floor(BUCKET_MULTIPLIER * pow(BUCKET_POWER_BASE, i)));
+    }
+    return buckets;
+}
+
+// Model compilation takes from fraction of second to minutes, request latency buckets are too dense for it
+static std::vector<double> createCompilationTimeBuckets() {
+    static const double COMPILATION_TIME_BUCKETS_SECONDS[] = {0.1, 0.25, 0.5, 1, 2.5, 5, 10, 25, 50, 100, 250, 500, 1000};
+    std::vector<double> buckets;
+    for (double seconds : COMPILATION_TIME_BUCKETS_SECONDS) {
+        buckets.emplace_back(seconds * 1000 * 1000);
+    }
+    return buckets;
+}
+
 ServableMetricReporter::~ServableMetricReporter() = default;
 
 ServableMetricReporter::ServableMetricReporter(const MetricConfig* metricConfig, MetricRegistry* registry, const std::string& modelName, model_version_t modelVersion) :
@@ -48,9 +68,7 @@ ServableMetricReporter::ServableMetricReporter(const MetricConfig* metricConfig,
         return;
     }
 
-    for (int i = 0; i < NUMBER_OF_BUCKETS; i++) {
-        this->buckets.emplace_back(floor(BUCKET_MULTIPLIER * pow(BUCKET_POWER_BASE, i)));
-    }
+    this->buckets = createBuckets();
 
     std::string familyName = METRIC_NAME_REQUESTS_SUCCESS;
     auto family = registry->createFamily<MetricCounter>(familyName,
@@ -282,6 +300,53 @@ ModelMetricReporter::ModelMetricReporter(const MetricConfig* metricConfig, Metri
         THROW_IF_NULL(this->waitForInferReqTime, "cannot create metric");
     }
 
+    familyName = METRIC_NAME_VALIDATION_TIME;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricHistogram>(familyName,
+            "Time of validating inference request against model inputs.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->validationTime = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}},
+            this->buckets);
+        THROW_IF_NULL(this->validationTime, "cannot create metric");
+    }
+
+    familyName = METRIC_NAME_DESERIALIZATION_TIME;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricHistogram>(familyName,
+            "Time of deserializing request inputs into the inference request.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->deserializationTime = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}},
+            this->buckets);
+        THROW_IF_NULL(this->deserializationTime, "cannot create metric");
+    }
+
+    familyName = METRIC_NAME_SERIALIZATION_TIME;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricHistogram>(familyName,
+            "Time of serializing inference outputs into the response.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->serializationTime = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}},
+            this->buckets);
+        THROW_IF_NULL(this->serializationTime, "cannot create metric");
+    }
+
+    familyName = METRIC_NAME_WAIT_FOR_INFER_REQ_TIME_BY_PRIORITY;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricHistogram>(familyName,
+            "Request waiting time in the scheduling queue per request priority class.");
+        THROW_IF_NULL(family, "cannot create family");
+        for (auto priority : {RequestPriority::LOW, RequestPriority::MEDIUM, RequestPriority::HIGH}) {
+            auto& metric = this->getWaitForInferReqTimeMetric(priority);
+            metric = family->addMetric(
+                {{"name", modelName}, {"version", std::to_string(modelVersion)}, {"priority", toString(priority)}},
+                this->buckets);
+            THROW_IF_NULL(metric, "cannot create metric");
+        }
+    }
+
     familyName = METRIC_NAME_STREAMS;
     if (metricConfig->isFamilyEnabled(familyName)) {
         auto family = registry->createFamily<MetricGauge>(familyName,
@@ -312,6 +377,26 @@ ModelMetricReporter::ModelMetricReporter(const MetricConfig* metricConfig, Metri
         THROW_IF_NULL(this->inferReqActive, "cannot create metric");
     }
 
+    familyName = METRIC_NAME_INFER_REQ_WAITING;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricGauge>(familyName,
+            "Number of requests waiting for inference request from the processing queue.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->inferReqWaiting = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}});
+        THROW_IF_NULL(this->inferReqWaiting, "cannot create metric");
+    }
+
+    familyName = METRIC_NAME_INFER_REQ_OLDEST_WAIT_TIME;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricGauge>(familyName,
+            "Time for which the longest waiting request waits for inference request from the processing queue.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->inferReqOldestWaitTime = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}});
+        THROW_IF_NULL(this->inferReqOldestWaitTime, "cannot create metric");
+    }
+
     familyName = METRIC_NAME_CURRENT_REQUESTS;
     if (metricConfig->isFamilyEnabled(familyName)) {
         auto family = registry->createFamily<MetricGauge>(familyName,
@@ -321,6 +406,112 @@ ModelMetricReporter::ModelMetricReporter(const MetricConfig* metricConfig, Metri
             {{"name", modelName}, {"version", std::to_string(modelVersion)}});
         THROW_IF_NULL(this->currentRequests, "cannot create metric");
     }
+
+    familyName = METRIC_NAME_COMPILATION_TIME;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricHistogram>(familyName,
+            "Time of compiling the model for the target device, including import from the model cache.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->compilationTime = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}},
+            createCompilationTimeBuckets());
+        THROW_IF_NULL(this->compilationTime, "cannot create metric");
+    }
+
+    familyName = METRIC_NAME_MODEL_CACHE_HIT;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricCounter>(familyName,
+            "Number of model compilations served from the model cache.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->modelCacheHit = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}});
+        THROW_IF_NULL(this->modelCacheHit, "cannot create metric");
+    }
+
+    familyName = METRIC_NAME_MODEL_CACHE_MISS;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricCounter>(familyName,
+            "Number of model compilations with model cache enabled that were not found in the cache.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->modelCacheMiss = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}});
+        THROW_IF_NULL(this->modelCacheMiss, "cannot create metric");
+    }
+
+    familyName = METRIC_NAME_MODEL_MEMORY;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricGauge>(familyName,
+            "Host memory used by the model version.");
+        THROW_IF_NULL(family, "cannot create family");
+        for (auto [metric, type] : {std::make_pair(&this->memoryWeights, "weights"),
+                 std::make_pair(&this->memorySharedWeights, "shared_weights"),
+                 std::make_pair(&this->memoryCompiledModel, "compiled_model_estimate"),
+                 std::make_pair(&this->memoryInferRequests, "infer_requests"),
+                 std::make_pair(&this->memorySequenceState, "sequence_state")}) {
+            *metric = family->addMetric(
+                {{"name", modelName}, {"version", std::to_string(modelVersion)}, {"type", type}});
+            THROW_IF_NULL(*metric, "cannot create metric");
+        }
+    }
+}
+
+NodeMetricReporter::NodeMetricReporter(const MetricConfig* metricConfig, MetricRegistry* registry, const std::string& servableName, model_version_t servableVersion) :
+    servableName(servableName),
+    servableVersion(servableVersion) {
+    if (!registry) {
+        return;
+    }
+
+    if (!metricConfig || !metricConfig->metricsEnabled) {
+        return;
+    }
+
+    this->buckets = createBuckets();
+
+    std::string familyName = METRIC_NAME_NODE_EXECUTION_TIME;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        this->executionTimeFamily = registry->createFamily<MetricHistogram>(familyName,
+            "Execution time of a DAG node or a MediaPipe calculator.");
+        THROW_IF_NULL(this->executionTimeFamily, "cannot create family");
+    }
+
+    familyName = METRIC_NAME_NODE_WAIT_FOR_INFER_REQ_TIME;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        this->waitForInferReqTimeFamily = registry->createFamily<MetricHistogram>(familyName,
+            "Waiting time of a DAG node for an inference request of its model.");
+        THROW_IF_NULL(this->waitForInferReqTimeFamily, "cannot create family");
+    }
+}
+
+NodeMetricReporter::~NodeMetricReporter() = default;
+
+NodeMetrics* NodeMetricReporter::getNodeMetrics(const std::string& nodeName) {
+    if (!isEnabled()) {
+        return nullptr;
+    }
+    {
+        std::shared_lock lock(this->mtx);
+        auto it = this->nodesMetrics.find(nodeName);
+        if (it != this->nodesMetrics.end()) {
+            return it->second.get();
+        }
+    }
+    std::unique_lock lock(this->mtx);
+    auto it = this->nodesMetrics.find(nodeName);
+    if (it != this->nodesMetrics.end()) {
+        return it->second.get();
+    }
+    auto metrics = std::make_unique<NodeMetrics>();
+    const MetricLabels labels{{"name", this->servableName}, {"version", std::to_string(this->servableVersion)}, {"node", nodeName}};
+    if (this->executionTimeFamily) {
+        metrics->executionTime = this->executionTimeFamily->addMetric(labels, this->buckets);
+        THROW_IF_NULL(metrics->executionTime, "cannot create metric");
+    }
+    if (this->waitForInferReqTimeFamily) {
+        metrics->waitForInferReqTime = this->waitForInferReqTimeFamily->addMetric(labels, this->buckets);
+        THROW_IF_NULL(metrics->waitForInferReqTime, "cannot create metric");
+    }
+    return this->nodesMetrics.emplace(nodeName, std::move(metrics)).first->second.get();
 }
 
 }  // namespace ovms
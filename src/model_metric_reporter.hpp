@@ -15,18 +15,24 @@
 //*****************************************************************************
 #pragma once
 
+#include <array>
 #include <memory>
+#include <shared_mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "execution_context.hpp"
 #include "metric.hpp"
 #include "modelversion.hpp"
+#include "requestpriority.hpp"
 
 namespace ovms {
 
 class MetricRegistry;
 class MetricConfig;
+template <typename T>
+class MetricFamily;
 
 class ServableMetricReporter {
     MetricRegistry* registry;
@@ -142,13 +148,69 @@ class ModelMetricReporter : public ServableMetricReporter {
 public:
     std::unique_ptr<MetricHistogram> inferenceTime;
     std::unique_ptr<MetricHistogram> waitForInferReqTime;
+    std::unique_ptr<MetricHistogram> validationTime;
+    std::unique_ptr<MetricHistogram> deserializationTime;
+    std::unique_ptr<MetricHistogram> serializationTime;
+    std::array<std::unique_ptr<MetricHistogram>, REQUEST_PRIORITY_CLASSES> waitForInferReqTimeByPriority;
 
     std::unique_ptr<MetricGauge> streams;
     std::unique_ptr<MetricGauge> inferReqQueueSize;
     std::unique_ptr<MetricGauge> inferReqActive;
+    std::unique_ptr<MetricGauge> inferReqWaiting;
+    std::unique_ptr<MetricGauge> inferReqOldestWaitTime;
     std::unique_ptr<MetricGauge> currentRequests;
 
+    std::unique_ptr<MetricHistogram> compilationTime;
+    std::unique_ptr<MetricCounter> modelCacheHit;
+    std::unique_ptr<MetricCounter> modelCacheMiss;
+
+    std::unique_ptr<MetricGauge> memoryWeights;
+    std::unique_ptr<MetricGauge> memorySharedWeights;
+    std::unique_ptr<MetricGauge> memoryCompiledModel;
+    std::unique_ptr<MetricGauge> memoryInferRequests;
+    std::unique_ptr<MetricGauge> memorySequenceState;
+
     ModelMetricReporter(const MetricConfig* metricConfig, MetricRegistry* registry, const std::string& modelName, model_version_t modelVersion);
+
+    inline std::unique_ptr<MetricHistogram>& getWaitForInferReqTimeMetric(RequestPriority priority) {
+        return this->waitForInferReqTimeByPriority[static_cast<size_t>(priority)];
+    }
+};
+
+/**
+ * @brief Metrics of a single DAG node or MediaPipe calculator. Histograms are null when their family is disabled.
+ */
+struct NodeMetrics {
+    std::unique_ptr<MetricHistogram> executionTime;
+    std::unique_ptr<MetricHistogram> waitForInferReqTime;
+};
+
+/**
+ * @brief Creates per node metrics of a DAG or a MediaPipe graph on first use, since node names are known only after the servable is loaded
+ */
+class NodeMetricReporter {
+    std::shared_ptr<MetricFamily<MetricHistogram>> executionTimeFamily;
+    std::shared_ptr<MetricFamily<MetricHistogram>> waitForInferReqTimeFamily;
+    std::vector<double> buckets;
+    const std::string servableName;
+    const model_version_t servableVersion;
+
+    std::shared_mutex mtx;
+    std::unordered_map<std::string, std::unique_ptr<NodeMetrics>> nodesMetrics;
+
+public:
+    NodeMetricReporter(const MetricConfig* metricConfig, MetricRegistry* registry, const std::string& servableName, model_version_t servableVersion);
+    ~NodeMetricReporter();
+
+    bool isEnabled() const {
+        return executionTimeFamily || waitForInferReqTimeFamily;
+    }
+
+    /**
+     * @brief Returns metrics of given node, nullptr if node metrics are disabled.
+     * Returned pointer remains valid for the lifetime of the reporter.
+     */
+    NodeMetrics* getNodeMetrics(const std::string& nodeName);
 };
 
 }  // namespace ovms
@@ -21,6 +21,9 @@
 #include <vector>
 
 #include <google/protobuf/util/json_util.h>
+#include <rapidjson/document.h>
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
 #include <spdlog/spdlog.h>
 
 #pragma GCC diagnostic push
@@ -43,6 +46,7 @@
 #include "servablemanagermodule.hpp"
 #include "server.hpp"
 #include "status.hpp"
+#include "stringutils.hpp"
 
 using google::protobuf::util::JsonPrintOptions;
 using google::protobuf::util::MessageToJsonString;
@@ -217,7 +221,57 @@ Status GetModelStatusImpl::getAllModelsStatuses(std::map<std::string, tensorflow
     return StatusCode::OK;
 }
 
-Status GetModelStatusImpl::serializeModelsStatuses2Json(const std::map<std::string, tensorflow::serving::GetModelStatusResponse>& modelsStatuses, std::string& output) {
+Status GetModelStatusImpl::getAllModelsMemoryUsage(models_memory_usage_t& modelsMemoryUsage, ModelManager& manager) {
+    std::shared_lock lock(manager.modelsMtx);
+    for (const auto& [modelName, model] : manager.getModels()) {
+        for (const auto& [modelVersion, modelInstance] : model->getModelVersionsMapCopy()) {
+            if (modelInstance.getStatus().getState() != ModelVersionState::AVAILABLE) {
+                continue;
+            }
+            modelsMemoryUsage[modelName][modelVersion] = modelInstance.getMemoryUsage();
+        }
+    }
+    return StatusCode::OK;
+}
+
+static Status addMemoryUsage2Json(const std::map<model_version_t, ModelMemoryUsage>& versionsMemoryUsage, std::string& responseStr) {
+    rapidjson::Document doc;
+    if (doc.Parse(responseStr.c_str()).HasParseError() || !doc.IsObject() || !doc.HasMember("model_version_status") || !doc["model_version_status"].IsArray()) {
+        return StatusCode::JSON_SERIALIZATION_ERROR;
+    }
+    auto& allocator = doc.GetAllocator();
+    for (auto& versionStatus : doc["model_version_status"].GetArray()) {
+        if (!versionStatus.HasMember("version") || !versionStatus["version"].IsString()) {
+            continue;
+        }
+        auto modelVersion = stoi64(versionStatus["version"].GetString());
+        if (!modelVersion.has_value()) {
+            continue;
+        }
+        auto it = versionsMemoryUsage.find(modelVersion.value());
+        if (it == versionsMemoryUsage.end()) {
+            continue;
+        }
+        const auto& usage = it->second;
+        rapidjson::Value memory(rapidjson::kObjectType);
+        memory.AddMember("weights", static_cast<uint64_t>(usage.weights), allocator);
+        memory.AddMember("shared_weights", static_cast<uint64_t>(usage.sharedWeights), allocator);
+        memory.AddMember("compiled_model_estimate", static_cast<uint64_t>(usage.compiledModel), allocator);
+        memory.AddMember("infer_requests", static_cast<uint64_t>(usage.inferRequests), allocator);
+        memory.AddMember("sequence_state", static_cast<uint64_t>(usage.sequenceState), allocator);
+        memory.AddMember("total", static_cast<uint64_t>(usage.total()), allocator);
+        versionStatus.AddMember("memory", memory, allocator);
+    }
+    rapidjson::StringBuffer buffer;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+    // Same indentation as protobuf serialization of statuses without memory
+    writer.SetIndent(' ', 1);
+    doc.Accept(writer);
+    responseStr = std::string(buffer.GetString()) + "\n";
+    return StatusCode::OK;
+}
+
+Status GetModelStatusImpl::serializeModelsStatuses2Json(const std::map<std::string, tensorflow::serving::GetModelStatusResponse>& modelsStatuses, std::string& output, const models_memory_usage_t* modelsMemoryUsage) {
     std::string outputTmp;
     if (modelsStatuses.begin() == modelsStatuses.end()) {
         output = "{}";
@@ -232,6 +286,15 @@ Status GetModelStatusImpl::serializeModelsStatuses2Json(const std::map<std::stri
         if (status != StatusCode::OK) {
             return status;
         }
+        if (modelsMemoryUsage) {
+            auto it = modelsMemoryUsage->find(modelStatus->first);
+            if (it != modelsMemoryUsage->end()) {
+                status = addMemoryUsage2Json(it->second, responseStr);
+                if (status != StatusCode::OK) {
+                    return status;
+                }
+            }
+        }
         responseStr.pop_back();
         outputTmp += responseStr;
         if (std::next(modelStatus) != modelsStatuses.end()) {
@@ -29,6 +29,7 @@
 #include "tensorflow_serving/apis/model_service.pb.h"
 #pragma GCC diagnostic pop
 
+#include "model_memory_usage.hpp"
 #include "modelversion.hpp"
 
 namespace ovms {
@@ -63,7 +64,9 @@ public:
     static Status serializeResponse2Json(const tensorflow::serving::GetModelStatusResponse* response, std::string* output);
 
     static Status getAllModelsStatuses(std::map<std::string, tensorflow::serving::GetModelStatusResponse>& models_versions, ModelManager& manager, ExecutionContext context);
-    static Status serializeModelsStatuses2Json(const std::map<std::string, tensorflow::serving::GetModelStatusResponse>& models_versions, std::string& output);
+    static Status serializeModelsStatuses2Json(const std::map<std::string, tensorflow::serving::GetModelStatusResponse>& models_versions, std::string& output, const models_memory_usage_t* modelsMemoryUsage = nullptr);
+
+    static Status getAllModelsMemoryUsage(models_memory_usage_t& modelsMemoryUsage, ModelManager& manager);
 };
 
 }  // namespace ovms
@@ -138,6 +138,26 @@ bool ModelConfig::isReloadRequired(const ModelConfig& rhs) const {
     if (this->isAllowCacheSetToTrue() != rhs.isAllowCacheSetToTrue()) {
         return true;
     }
+    if (this->maxShapeVariants != rhs.maxShapeVariants) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to max shape variants mismatch", this->name);
+        return true;
+    }
+    if (this->shapeBuckets != rhs.shapeBuckets) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to shape buckets mismatch", this->name);
+        return true;
+    }
+    if (this->numaNode != rhs.numaNode || this->cpuCores != rhs.cpuCores) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to placement mismatch", this->name);
+        return true;
+    }
+    if (this->priority != rhs.priority) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to priority mismatch", this->name);
+        return true;
+    }
+    if (this->memoryLimitMb != rhs.memoryLimitMb) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to memory limit mismatch", this->name);
+        return true;
+    }
     return false;
 }
 
@@ -717,6 +737,58 @@ Status ModelConfig::parseNode(const rapidjson::Value& v) {
         SPDLOG_DEBUG("allow_cache: {}", v["allow_cache"].GetBool());
     }
 
+    if (v.HasMember("max_shape_variants")) {
+        setMaxShapeVariants(v["max_shape_variants"].GetUint());
+        SPDLOG_DEBUG("max_shape_variants: {}", getMaxShapeVariants());
+    }
+
+    if (v.HasMember("shape_buckets")) {
+        auto status = parseShapeBuckets(v["shape_buckets"]);
+        if (!status.ok()) {
+            SPDLOG_ERROR("Couldn't parse shape buckets config");
+            return status;
+        }
+    }
+
+    if (v.HasMember("numa_node")) {
+        setNumaNode(v["numa_node"].GetUint());
+        SPDLOG_DEBUG("numa_node: {}", getNumaNode().value());
+    }
+
+    if (v.HasMember("cpu_cores")) {
+        auto status = parseCoreList(v["cpu_cores"].GetString(), this->cpuCores);
+        if (!status.ok()) {
+            SPDLOG_ERROR("Couldn't parse cpu_cores: {}", v["cpu_cores"].GetString());
+            return status;
+        }
+        SPDLOG_DEBUG("cpu_cores: {}", coreListToString(getCpuCores()));
+    }
+
+    if (v.HasMember("priority")) {
+        auto priority = requestPriorityFromString(v["priority"].GetString());
+        if (!priority.has_value()) {
+            SPDLOG_ERROR("Couldn't parse priority: {}", v["priority"].GetString());
+            return StatusCode::MODEL_CONFIG_INVALID;
+        }
+        setPriority(priority);
+        SPDLOG_DEBUG("priority: {}", toString(priority.value()));
+    }
+
+    if (v.HasMember("max_waiting_requests")) {
+        setMaxWaitingRequests(v["max_waiting_requests"].GetUint());
+        SPDLOG_DEBUG("max_waiting_requests: {}", getMaxWaitingRequests());
+    }
+
+    if (v.HasMember("max_queue_wait_ms")) {
+        setMaxQueueWaitMs(v["max_queue_wait_ms"].GetUint());
+        SPDLOG_DEBUG("max_queue_wait_ms: {}", getMaxQueueWaitMs());
+    }
+
+    if (v.HasMember("memory_limit_mb")) {
+        setMemoryLimitMb(v["memory_limit_mb"].GetUint());
+        SPDLOG_DEBUG("memory_limit_mb: {}", getMemoryLimitMb());
+    }
+
     // if the config has models which require custom loader to be used, then load the same here
     if (v.HasMember("custom_loader_options")) {
         if (!parseCustomLoaderOptionsConfig(v["custom_loader_options"]).ok()) {
@@ -744,6 +816,63 @@ Status ModelConfig::parseCustomLoaderOptionsConfig(const rapidjson::Value& node)
     return StatusCode::OK;
 }
 
+Status ModelConfig::parseShapeBuckets(const rapidjson::Value& node) {
+    if (!node.IsObject()) {
+        return StatusCode::MODEL_CONFIG_INVALID;
+    }
+    shape_buckets_map_t buckets;
+    for (auto it = node.MemberBegin(); it != node.MemberEnd(); ++it) {
+        const auto& bucketsNode = it->value;
+        if (!bucketsNode.IsObject() || !bucketsNode.HasMember("dim") || !bucketsNode["dim"].IsUint() ||
+            !bucketsNode.HasMember("sizes") || !bucketsNode["sizes"].IsArray()) {
+            return StatusCode::MODEL_CONFIG_INVALID;
+        }
+        ShapeBuckets inputBuckets;
+        inputBuckets.dimension = bucketsNode["dim"].GetUint();
+        for (const auto& size : bucketsNode["sizes"].GetArray()) {
+            if (!size.IsInt64() || size.GetInt64() <= 0) {
+                return StatusCode::MODEL_CONFIG_INVALID;
+            }
+            inputBuckets.sizes.push_back(size.GetInt64());
+        }
+        if (inputBuckets.sizes.empty()) {
+            return StatusCode::MODEL_CONFIG_INVALID;
+        }
+        std::sort(inputBuckets.sizes.begin(), inputBuckets.sizes.end());
+        inputBuckets.sizes.erase(std::unique(inputBuckets.sizes.begin(), inputBuckets.sizes.end()), inputBuckets.sizes.end());
+        if (bucketsNode.HasMember("pad_value")) {
+            if (!bucketsNode["pad_value"].IsNumber()) {
+                return StatusCode::MODEL_CONFIG_INVALID;
+            }
+            inputBuckets.padValue = bucketsNode["pad_value"].GetDouble();
+        }
+        if (bucketsNode.HasMember("outputs")) {
+            if (!bucketsNode["outputs"].IsObject()) {
+                return StatusCode::MODEL_CONFIG_INVALID;
+            }
+            for (auto outputIt = bucketsNode["outputs"].MemberBegin(); outputIt != bucketsNode["outputs"].MemberEnd(); ++outputIt) {
+                if (!outputIt->value.IsUint()) {
+                    return StatusCode::MODEL_CONFIG_INVALID;
+                }
+                inputBuckets.outputs.emplace(outputIt->name.GetString(), outputIt->value.GetUint());
+            }
+        }
+        std::stringstream sizes;
+        for (const auto& size : inputBuckets.sizes) {
+            sizes << size << " ";
+        }
+        std::stringstream outputs;
+        for (const auto& [outputName, dimension] : inputBuckets.outputs) {
+            outputs << outputName << ":" << dimension << " ";
+        }
+        SPDLOG_DEBUG("shape_buckets of input: {}; dim: {}; sizes: {}; pad_value: {}; outputs: {}",
+            it->name.GetString(), inputBuckets.dimension, sizes.str(), inputBuckets.padValue, outputs.str());
+        buckets.emplace(it->name.GetString(), std::move(inputBuckets));
+    }
+    setShapeBuckets(buckets);
+    return StatusCode::OK;
+}
+
 std::string ModelConfig::layoutConfigurationToString() const {
     if (getLayout().isSet()) {
         return getLayout().toString();
@@ -18,6 +18,7 @@
 #include <fstream>
 #include <map>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <tuple>
@@ -28,8 +29,11 @@
 
 #include "layout_configuration.hpp"
 #include "modelversion.hpp"
+#include "requestpriority.hpp"
 #include "shape.hpp"
+#include "shapebucketing.hpp"
 #include "status.hpp"
+#include "systeminfo.hpp"
 
 namespace ovms {
 class ModelVersionPolicy;
@@ -122,6 +126,46 @@ private:
          */
     bool isAllowCacheTrue = false;
 
+    /**
+         * @brief Maximum number of additionally compiled shape variants kept for shape or batch size set to auto, 0 to reload model instead
+         */
+    uint32_t maxShapeVariants = 0;
+
+    /**
+         * @brief Sizes to which inputs are padded, so that model is compiled for bucket shapes only
+         */
+    shape_buckets_map_t shapeBuckets;
+
+    /**
+         * @brief NUMA node on which compiled model and infer requests are placed
+         */
+    std::optional<uint32_t> numaNode;
+
+    /**
+         * @brief Cores to which model inference is restricted
+         */
+    cpu_cores_t cpuCores;
+
+    /**
+         * @brief Priority of model requests which do not specify one, passed as model priority to the device
+         */
+    std::optional<RequestPriority> priority;
+
+    /**
+         * @brief Maximum number of requests waiting for infer request, above which new requests are rejected, 0 means no limit
+         */
+    uint32_t maxWaitingRequests = 0;
+
+    /**
+         * @brief Maximum time the oldest request may wait for infer request before new requests are rejected, 0 means no limit
+         */
+    uint32_t maxQueueWaitMs = 0;
+
+    /**
+         * @brief Maximum memory in megabytes the model version may use, above which model load is refused, 0 means no limit
+         */
+    uint32_t memoryLimitMb = 0;
+
     /**
          * @brief Model version
          */
@@ -389,6 +433,159 @@ public:
         this->isAllowCacheTrue = allowCache;
     }
 
+    /**
+         * @brief Get the maximum number of compiled shape variants
+         * 
+         * @return uint32_t
+         */
+    uint32_t getMaxShapeVariants() const {
+        return this->maxShapeVariants;
+    }
+
+    /**
+         * @brief Set the maximum number of compiled shape variants
+         * 
+         * @param maxShapeVariants
+         */
+    void setMaxShapeVariants(const uint32_t maxShapeVariants) {
+        this->maxShapeVariants = maxShapeVariants;
+    }
+
+    /**
+         * @brief Get the shape buckets keyed by input name
+         * 
+         * @return const shape_buckets_map_t&
+         */
+    const shape_buckets_map_t& getShapeBuckets() const {
+        return this->shapeBuckets;
+    }
+
+    /**
+         * @brief Set the shape buckets
+         * 
+         * @param shapeBuckets
+         */
+    void setShapeBuckets(const shape_buckets_map_t& shapeBuckets) {
+        this->shapeBuckets = shapeBuckets;
+    }
+
+    /**
+         * @brief Parses json node with shape buckets of inputs
+         *
+         * @param json node representing shape_buckets
+         *
+         * @return status
+         */
+    Status parseShapeBuckets(const rapidjson::Value& node);
+
+    /**
+         * @brief Get the NUMA node to place model on
+         * 
+         * @return std::optional<uint32_t>
+         */
+    const std::optional<uint32_t>& getNumaNode() const {
+        return this->numaNode;
+    }
+
+    /**
+         * @brief Set the NUMA node to place model on
+         * 
+         * @param numaNode
+         */
+    void setNumaNode(const std::optional<uint32_t>& numaNode) {
+        this->numaNode = numaNode;
+    }
+
+    /**
+         * @brief Get the cores to which model inference is restricted
+         * 
+         * @return const cpu_cores_t&
+         */
+    const cpu_cores_t& getCpuCores() const {
+        return this->cpuCores;
+    }
+
+    /**
+         * @brief Set the cores to which model inference is restricted
+         * 
+         * @param cpuCores
+         */
+    void setCpuCores(const cpu_cores_t& cpuCores) {
+        this->cpuCores = cpuCores;
+    }
+
+    /**
+         * @brief Get the priority of model requests
+         * 
+         * @return const std::optional<RequestPriority>&
+         */
+    const std::optional<RequestPriority>& getPriority() const {
+        return this->priority;
+    }
+
+    /**
+         * @brief Set the priority of model requests
+         * 
+         * @param priority
+         */
+    void setPriority(const std::optional<RequestPriority>& priority) {
+        this->priority = priority;
+    }
+
+    /**
+         * @brief Get the maximum number of requests waiting for infer request
+         * 
+         * @return uint32_t
+         */
+    uint32_t getMaxWaitingRequests() const {
+        return this->maxWaitingRequests;
+    }
+
+    /**
+         * @brief Set the maximum number of requests waiting for infer request
+         * 
+         * @param maxWaitingRequests
+         */
+    void setMaxWaitingRequests(const uint32_t maxWaitingRequests) {
+        this->maxWaitingRequests = maxWaitingRequests;
+    }
+
+    /**
+         * @brief Get the maximum wait time for infer request in milliseconds
+         * 
+         * @return uint32_t
+         */
+    uint32_t getMaxQueueWaitMs() const {
+        return this->maxQueueWaitMs;
+    }
+
+    /**
+         * @brief Set the maximum wait time for infer request in milliseconds
+         * 
+         * @param maxQueueWaitMs
+         */
+    void setMaxQueueWaitMs(const uint32_t maxQueueWaitMs) {
+        this->maxQueueWaitMs = maxQueueWaitMs;
+    }
+
+    /**
+         * @brief Get the memory limit of model version in megabytes
+         * 
+         * @return uint32_t
+         */
+    uint32_t getMemoryLimitMb() const {
+        return this->memoryLimitMb;
+    }
+
+    /**
+         * @brief Set the memory limit of model version in megabytes
+         * 
+         * @param memoryLimitMb
+         */
+    void setMemoryLimitMb(const uint32_t memoryLimitMb) {
+        this->memoryLimitMb = memoryLimitMb;
+    }
+
     /**
          * @brief Checks if given device is used as single target device.
          * 
@@ -16,27 +16,34 @@
 #include "modelinstance.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <cstdlib>
+#include <functional>
 #include <iostream>
+#include <iterator>
 #include <memory>
 #include <set>
+#include <sstream>
 #include <string>
 #include <thread>
 #include <utility>
 
 #include <dirent.h>
 #include <malloc.h>
+#include <openvino/op/constant.hpp>
 #include <openvino/runtime/compiled_model.hpp>
 #include <spdlog/spdlog.h>
 #include <sys/types.h>
 
 #include "capi_frontend/inferencerequest.hpp"
 #include "capi_frontend/inferenceresponse.hpp"
+#include "compilationtimerstage.hpp"
 #include "config.hpp"
 #include "customloaderinterface.hpp"
 #include "customloaders.hpp"
 #include "deserialization.hpp"
 #include "executingstreamidguard.hpp"
+#include "execution_context.hpp"
 #include "filesystem.hpp"
 #include "layout.hpp"
 #include "layout_configuration.hpp"
@@ -50,6 +57,7 @@
 #include "profiler.hpp"
 #include "serialization.hpp"
 #include "shape.hpp"
+#include "shapebucketing.hpp"
 #include "status.hpp"
 #include "stringutils.hpp"
 #include "tensorinfo.hpp"
@@ -57,6 +65,7 @@
 
 namespace {
 enum : unsigned int {
+    VALIDATE,
     GET_INFER_REQUEST,
     PREPROCESS,
     DESERIALIZE,
@@ -72,8 +81,13 @@ namespace ovms {
 const uint MAX_NIREQ_COUNT = 100000;
 
 const uint UNLOAD_AVAILABILITY_CHECKING_INTERVAL_MILLISECONDS = 10;
+const uint CANCELLATION_CHECK_INTERVAL_MILLISECONDS = 5;
 
-ModelInstance::~ModelInstance() = default;
+ModelInstance::~ModelInstance() {
+    // Reporter outlives infer requests queue, gauges cannot read it after destruction
+    setInferRequestsQueueGauges(nullptr);
+    ModelInstance::setMemoryGauges(false);
+}
 ModelInstance::ModelInstance(const std::string& name, model_version_t version, ov::Core& ieCore, MetricRegistry* registry, const MetricConfig* metricConfig) :
     ieCore(ieCore),
     name(name),
@@ -404,6 +418,12 @@ Status ModelInstance::gatherReshapeInfo(bool isBatchingModeAuto, const DynamicMo
             if (requestedShape.size() > 0) {
                 shape = requestedShape.createPartialShape();
             }
+            auto mappedName = config.getMappingInputByKey(name);
+            auto bucketsIt = config.getShapeBuckets().find(mappedName != "" ? mappedName : name);
+            if (bucketsIt != config.getShapeBuckets().end() && bucketsIt->second.dimension < shape.size()) {
+                // Model is compiled for the largest bucket, smaller buckets are compiled on demand
+                shape[bucketsIt->second.dimension] = bucketsIt->second.getMaxSize();
+            }
             modelShapes[name] = shape;
             if (input.get_partial_shape() != shape) {
                 isReshapeRequired = true;
@@ -508,12 +528,11 @@ Status ModelInstance::loadInputTensors(const ModelConfig& config, const DynamicM
             return StatusCode::UNKNOWN_ERROR;
         }
     }
-    return StatusCode::OK;
+    return validateShapeBuckets(config);
 }
 
 Status ModelInstance::loadOutputTensors(const ModelConfig& config) {
     this->outputsInfo.clear();
-
     OV_LOGGER("ov::Model model: {}, model->outputs()", reinterpret_cast<void*>(model.get()));
     for (const ov::Output<ov::Node>& output : this->model->outputs()) {
         try {
@@ -525,6 +544,8 @@ Status ModelInstance::loadOutputTensors(const ModelConfig& config) {
             OV_LOGGER("ov::Output<ov::Node> output: {}, output.get_partial_shape()", reinterpret_cast<const void*>(&output));
             Shape shape(output.get_partial_shape());
             std::string mappingName = config.getMappingOutputByKey(name);
+            // Outputs of padded requests are trimmed back to request size
+            shape = getTrimmedOutputShape(shape, mappingName != "" ? mappingName : name, config.getShapeBuckets());
             const Layout layout = getReportedTensorLayout(config, name, false);
 
             if (!layout.isCompatible(shape)) {
@@ -562,7 +583,7 @@ Status ModelInstance::loadOutputTensors(const ModelConfig& config) {
         }
     }
 
-    return StatusCode::OK;
+    return validateShapeBucketsOutputs(config);
 }
 
 // Temporary methods. To be replaces with proper storage class.
@@ -694,9 +715,9 @@ Status ModelInstance::loadOVModelUsingCustomLoader() {
         std::string strModel(modelBinary.begin(), modelBinary.end());
 
         if (res == CustomLoaderStatus::MODEL_TYPE_IR) {
-            ov::Tensor tensorWts(ov::element::u8, ov::Shape{weights.size()});
-            std::memcpy(tensorWts.data(), weights.data(), weights.size());
-            model = ieCore.read_model(strModel, tensorWts);
+            auto sharedWts = SharedWeightsRegistry::instance().adopt(std::move(weights));
+            model = ieCore.read_model(strModel, sharedWts->getTensor());
+            this->sharedWeights = std::move(sharedWts);
         } else if (res == CustomLoaderStatus::MODEL_TYPE_ONNX) {
             model = ieCore.read_model(strModel, ov::Tensor());
         } else if (res == CustomLoaderStatus::MODEL_TYPE_BLOB) {
@@ -727,10 +748,83 @@ plugin_config_t ModelInstance::prepareDefaultPluginConfig(const ModelConfig& con
     return pluginConfig;
 }
 
-Status ModelInstance::loadOVCompiledModel(const ModelConfig& config) {
+plugin_config_t ModelInstance::prepareCompilationPluginConfig(const ModelConfig& config) const {
     plugin_config_t pluginConfig = prepareDefaultPluginConfig(config);
+    // Cache directory is passed per compilation instead of setting it on shared ov::Core,
+    // so that models loaded concurrently do not override each other's cache settings
+    if (!config.getCacheDir().empty()) {
+        pluginConfig[ov::cache_dir.name()] = this->cacheDisabled ? std::string("") : config.getCacheDir();
+    }
+    if (config.getPriority().has_value() && pluginConfig.count(ov::hint::model_priority.name()) == 0 &&
+        isPluginPropertySupported(ov::hint::model_priority.name(), config.getTargetDevice(), ieCore)) {
+        pluginConfig[ov::hint::model_priority.name()] = toOVPriority(config.getPriority().value());
+    }
+    // OpenVINO has no property selecting cores of the compiled model. Stream threads are created during compilation
+    // and inherit affinity of compiling thread bound to placement cores. Streams have single thread each,
+    // so that inference is executed by stream threads only and not by shared worker threads of the plugin.
+    if (!this->placementCores.empty() && config.isSingleDeviceUsed("CPU")) {
+        const int32_t coresCount = static_cast<int32_t>(this->placementCores.size());
+        const plugin_config_t& userPluginConfig = config.getPluginConfig();
+        if ((userPluginConfig.count("NUM_STREAMS") == 0) && (userPluginConfig.count("PERFORMANCE_HINT") == 0)) {
+            pluginConfig.erase("PERFORMANCE_HINT");
+            pluginConfig[ov::num_streams.name()] = coresCount;
+        }
+        if (pluginConfig.count(ov::inference_num_threads.name()) == 0) {
+            pluginConfig[ov::inference_num_threads.name()] = coresCount;
+        }
+        // Pinning would bind stream threads to cores selected by the plugin from all cores of the process
+        if (pluginConfig.count(ov::hint::enable_cpu_pinning.name()) == 0) {
+            pluginConfig[ov::hint::enable_cpu_pinning.name()] = false;
+        }
+    }
+    return pluginConfig;
+}
+
+Status ModelInstance::resolvePlacement(const ModelConfig& config) {
+    this->placementCores.clear();
+    this->placement.clear();
+    if (!config.getNumaNode().has_value() && config.getCpuCores().empty()) {
+        return StatusCode::OK;
+    }
+    cpu_cores_t cores = config.getCpuCores();
+    std::stringstream placement;
+    if (config.getNumaNode().has_value()) {
+        const auto topology = getNumaTopology();
+        auto it = topology.find(config.getNumaNode().value());
+        if (it == topology.end()) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "NUMA node: {} requested by model: {} version: {} is not available; topology: {}",
+                config.getNumaNode().value(), getName(), getVersion(), numaTopologyToString(topology));
+            return StatusCode::MODEL_CONFIG_INVALID;
+        }
+        if (cores.empty()) {
+            cores = it->second;
+        } else {
+            cpu_cores_t nodeCores;
+            std::set_intersection(cores.begin(), cores.end(), it->second.begin(), it->second.end(), std::back_inserter(nodeCores));
+            cores = std::move(nodeCores);
+        }
+        placement << "NUMA node: " << config.getNumaNode().value() << "; ";
+    }
+    if (cores.empty()) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "No cores available for placement of model: {} version: {}", getName(), getVersion());
+        return StatusCode::MODEL_CONFIG_INVALID;
+    }
+    placement << "cores: " << coreListToString(cores);
+    this->placementCores = std::move(cores);
+    this->placement = placement.str();
+    return StatusCode::OK;
+}
+
+Status ModelInstance::loadOVCompiledModel(const ModelConfig& config) {
+    plugin_config_t pluginConfig = prepareCompilationPluginConfig(config);
+    Timer<COMPILATION_TIMER_END> timer;
     try {
+        const size_t residentMemoryBefore = getProcessResidentMemory();
+        timer.start(COMPILE);
         loadCompiledModelPtr(pluginConfig);
+        timer.stop(COMPILE);
+        const size_t residentMemoryAfter = getProcessResidentMemory();
+        this->compiledModelMemory = residentMemoryAfter > residentMemoryBefore ? residentMemoryAfter - residentMemoryBefore : 0;
     } catch (ov::Exception& e) {
         Status status = StatusCode::CANNOT_COMPILE_MODEL_INTO_TARGET_DEVICE;
         SPDLOG_LOGGER_ERROR(modelmanager_logger, "{}; error: {}; model: {}; version: {}; device: {}",
@@ -750,6 +844,17 @@ Status ModelInstance::loadOVCompiledModel(const ModelConfig& config) {
             config.getTargetDevice());
         return status;
     }
+    OBSERVE_IF_ENABLED(this->getMetricReporter().compilationTime, timer.elapsed<std::chrono::microseconds>(COMPILE));
+    if (!config.getCacheDir().empty() && !this->cacheDisabled) {
+        bool loadedFromCache = isLoadedFromCache();
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Model: {} version: {} compiled in {} ms; loaded from cache: {}",
+            getName(), getVersion(), timer.elapsed<std::chrono::microseconds>(COMPILE) / 1000, loadedFromCache);
+        if (loadedFromCache) {
+            INCREMENT_IF_ENABLED(this->getMetricReporter().modelCacheHit);
+        } else {
+            INCREMENT_IF_ENABLED(this->getMetricReporter().modelCacheMiss);
+        }
+    }
 
     uint32_t numberOfStreams = getNumOfStreams();
     SET_IF_ENABLED(getMetricReporter().streams, numberOfStreams);
@@ -813,13 +918,130 @@ Status ModelInstance::fetchModelFilepaths() {
     return StatusCode::OK;
 }
 
+void ModelInstance::setInferRequestsQueueGauges(OVInferRequestsQueue* queue) {
+    auto& reporter = this->getMetricReporter();
+    if (reporter.inferReqWaiting) {
+        reporter.inferReqWaiting->setValueProvider(queue ? std::function<double()>([queue]() { return static_cast<double>(queue->getWaitersCount()); }) : nullptr);
+    }
+    if (reporter.inferReqOldestWaitTime) {
+        reporter.inferReqOldestWaitTime->setValueProvider(queue ? std::function<double()>([queue]() { return static_cast<double>(queue->getOldestWaiterAge().count()); }) : nullptr);
+    }
+}
+
+void ModelInstance::setAdmissionLimits(const ModelConfig& config) {
+    this->maxWaitingRequests = config.getMaxWaitingRequests();
+    this->maxQueueWaitMs = config.getMaxQueueWaitMs();
+}
+
+Status ModelInstance::admitRequest(OVInferRequestsQueue& queue) const {
+    const uint32_t maxWaitingRequests = this->maxWaitingRequests;
+    if (maxWaitingRequests > 0 && queue.getWaitersCount() >= maxWaitingRequests) {
+        SPDLOG_DEBUG("Rejecting request to model: {}; version: {}; {} requests are already waiting for infer request",
+            getName(), getVersion(), queue.getWaitersCount());
+        return StatusCode::INFER_QUEUE_OVERLOADED;
+    }
+    const uint32_t maxQueueWaitMs = this->maxQueueWaitMs;
+    if (maxQueueWaitMs > 0) {
+        const auto oldestWaiterAge = queue.getOldestWaiterAge();
+        if (oldestWaiterAge > std::chrono::milliseconds(maxQueueWaitMs)) {
+            SPDLOG_DEBUG("Rejecting request to model: {}; version: {}; oldest request waits for infer request: {} us",
+                getName(), getVersion(), oldestWaiterAge.count());
+            return StatusCode::INFER_QUEUE_OVERLOADED;
+        }
+    }
+    return StatusCode::OK;
+}
+
+static size_t getWeightsSize(const ov::Model& model) {
+    size_t size = 0;
+    for (const auto& op : model.get_ordered_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<ov::op::v0::Constant>(op)) {
+            size += constant->get_byte_size();
+        }
+    }
+    return size;
+}
+
+static size_t getInferRequestsSize(OVInferRequestsQueue& queue, const ov::CompiledModel& compiledModel) {
+    size_t size = 0;
+    for (size_t i = 0; i < queue.size(); ++i) {
+        auto& inferRequest = queue.getInferRequest(i);
+        for (const auto& ports : {compiledModel.inputs(), compiledModel.outputs()}) {
+            for (const auto& port : ports) {
+                try {
+                    size += inferRequest.get_tensor(port).get_byte_size();
+                } catch (const ov::Exception&) {
+                    // Tensors of dynamic shape are allocated during inference
+                }
+            }
+        }
+    }
+    return size;
+}
+
+ModelMemoryUsage ModelInstance::getMemoryUsage() const {
+    ModelMemoryUsage usage;
+    usage.weights = this->weightsMemory.load(std::memory_order_relaxed);
+    usage.sharedWeights = this->sharedWeightsMemory.load(std::memory_order_relaxed);
+    usage.compiledModel = this->compiledModelMemory.load(std::memory_order_relaxed);
+    usage.inferRequests = this->inferRequestsMemory.load(std::memory_order_relaxed);
+    return usage;
+}
+
+void ModelInstance::setMemoryGauges(bool enabled) {
+    auto& reporter = this->getMetricReporter();
+    if (reporter.memoryWeights) {
+        reporter.memoryWeights->setValueProvider(enabled ? std::function<double()>([this]() { return static_cast<double>(this->weightsMemory.load(std::memory_order_relaxed)); }) : nullptr);
+    }
+    if (reporter.memorySharedWeights) {
+        reporter.memorySharedWeights->setValueProvider(enabled ? std::function<double()>([this]() { return static_cast<double>(this->sharedWeightsMemory.load(std::memory_order_relaxed)); }) : nullptr);
+    }
+    if (reporter.memoryCompiledModel) {
+        reporter.memoryCompiledModel->setValueProvider(enabled ? std::function<double()>([this]() { return static_cast<double>(this->compiledModelMemory.load(std::memory_order_relaxed)); }) : nullptr);
+    }
+    if (reporter.memoryInferRequests) {
+        reporter.memoryInferRequests->setValueProvider(enabled ? std::function<double()>([this]() { return static_cast<double>(this->inferRequestsMemory.load(std::memory_order_relaxed)); }) : nullptr);
+    }
+    if (reporter.memorySequenceState) {
+        reporter.memorySequenceState->setValueProvider(nullptr);
+    }
+    if (!enabled) {
+        SET_IF_ENABLED(reporter.memoryWeights, 0);
+        SET_IF_ENABLED(reporter.memorySharedWeights, 0);
+        SET_IF_ENABLED(reporter.memoryCompiledModel, 0);
+        SET_IF_ENABLED(reporter.memoryInferRequests, 0);
+        SET_IF_ENABLED(reporter.memorySequenceState, 0);
+    }
+}
+
+Status ModelInstance::checkMemoryLimit() const {
+    const uint32_t memoryLimitMb = this->config.getMemoryLimitMb();
+    if (memoryLimitMb == 0) {
+        return StatusCode::OK;
+    }
+    const size_t memoryLimit = static_cast<size_t>(memoryLimitMb) * 1024 * 1024;
+    const auto usage = getMemoryUsage();
+    // Compiled model size is measured as resident memory growth which includes allocations of models loaded in parallel,
+    // so only sizes computed from the model and infer request tensors are checked
+    if (usage.exact() > memoryLimit) {
+        Status status = StatusCode::MODEL_MEMORY_LIMIT_EXCEEDED;
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "{}; model: {}; version: {}; limit: {} MB; weights: {} bytes; infer requests: {} bytes",
+            status.string(), getName(), getVersion(), memoryLimitMb, usage.weights, usage.inferRequests);
+        return status;
+    }
+    return StatusCode::OK;
+}
+
 Status ModelInstance::prepareInferenceRequestsQueue(const ModelConfig& config) {
     uint numberOfParallelInferRequests = getNumOfParallelInferRequests(config);
     if (numberOfParallelInferRequests == 0) {
         return Status(StatusCode::INVALID_NIREQ, "Exceeded allowed nireq value");
     }
+    setInferRequestsQueueGauges(nullptr);
     inferRequestsQueue = std::make_unique<OVInferRequestsQueue>(*compiledModel, numberOfParallelInferRequests);
     SET_IF_ENABLED(this->getMetricReporter().inferReqQueueSize, numberOfParallelInferRequests);
+    setInferRequestsQueueGauges(inferRequestsQueue.get());
+    this->inferRequestsMemory = getInferRequestsSize(*inferRequestsQueue, *compiledModel);
     auto batchSize = getBatchSize();
     SPDLOG_INFO("Loaded model {}; version: {}; batch size: {}; No of InferRequests: {}",
         getName(),
@@ -844,9 +1066,11 @@ Status ModelInstance::loadModelImpl(const ModelConfig& config, const DynamicMode
     bool needsToApplyLayoutConfiguration = isLayoutConfigurationChanged || !this->model;
 
     subscriptionManager.notifySubscribers();
+    clearShapeVariants();
     this->path = config.getPath();
     this->targetDevice = config.getTargetDevice();
     this->config = config;
+    setAdmissionLimits(config);
     auto status = fetchModelFilepaths();
 
     if (!status.ok()) {
@@ -859,7 +1083,14 @@ Status ModelInstance::loadModelImpl(const ModelConfig& config, const DynamicMode
             this->status.setLoading(ModelVersionStatusErrorCode::UNKNOWN);
             return status;
         }
+        status = resolvePlacement(this->config);
+        if (!status.ok()) {
+            this->status.setLoading(ModelVersionStatusErrorCode::UNKNOWN);
+            return status;
+        }
 
+        // Previously compiled model may still reference previous weights until it is replaced
+        auto previousSharedWeights = this->sharedWeights;
         if (!this->model || isLayoutConfigurationChanged) {
             if (this->config.isCustomLoaderRequiredToLoadModel()) {
                 status = loadOVModelUsingCustomLoader();
@@ -878,16 +1109,43 @@ Status ModelInstance::loadModelImpl(const ModelConfig& config, const DynamicMode
             this->status.setLoading(ModelVersionStatusErrorCode::UNKNOWN);
             return status;
         }
-        status = loadOVCompiledModel(this->config);
+        // Weights alone exceeding the limit are refused before spending time on compilation
+        // Weights shared with other versions are reported separately and not checked against the limit, since every sharing version would count them
+        const size_t weightsSize = getWeightsSize(*this->model);
+        this->sharedWeightsMemory = std::min(weightsSize, this->sharedWeights ? this->sharedWeights->getSize() : size_t(0));
+        this->weightsMemory = weightsSize - this->sharedWeightsMemory;
+        this->compiledModelMemory = 0;
+        this->inferRequestsMemory = 0;
+        status = checkMemoryLimit();
         if (!status.ok()) {
             this->status.setLoading(ModelVersionStatusErrorCode::UNKNOWN);
             return status;
         }
-        status = prepareInferenceRequestsQueue(this->config);
+        {
+            // Stream threads created during compilation inherit affinity to placement cores. Buffers allocated lazily
+            // during inference are first touched by these threads, so they are placed on the matching NUMA node.
+            CpuAffinityGuard affinityGuard(this->placementCores);
+            status = loadOVCompiledModel(this->config);
+            if (!status.ok()) {
+                this->status.setLoading(ModelVersionStatusErrorCode::UNKNOWN);
+                return status;
+            }
+            status = prepareInferenceRequestsQueue(this->config);
+            if (!status.ok()) {
+                this->status.setLoading(ModelVersionStatusErrorCode::UNKNOWN);
+                return status;
+            }
+        }
+        status = checkMemoryLimit();
         if (!status.ok()) {
             this->status.setLoading(ModelVersionStatusErrorCode::UNKNOWN);
             return status;
         }
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Model: {} version: {} memory usage; weights: {} bytes; shared weights: {} bytes; compiled model estimate: {} bytes; infer requests: {} bytes",
+            getName(), getVersion(), this->weightsMemory.load(), this->sharedWeightsMemory.load(), this->compiledModelMemory.load(), this->inferRequestsMemory.load());
+        if (!this->placement.empty()) {
+            SPDLOG_LOGGER_INFO(modelmanager_logger, "Model: {} version: {} placed on {}", getName(), getVersion(), this->placement);
+        }
     } catch (const ov::Exception& e) {
         SPDLOG_ERROR("exception occurred while loading model: {}", e.what());
         this->status.setLoading(ModelVersionStatusErrorCode::UNKNOWN);
@@ -904,27 +1162,96 @@ Status ModelInstance::loadModelImpl(const ModelConfig& config, const DynamicMode
     } catch (...) {
         SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Unable to get information if model was loaded from cache; model: {}; version: {}; device: {}", getName(), getVersion(), config.getTargetDevice());
     }
+    setMemoryGauges(true);
     this->status.setAvailable();
     modelLoadedNotify.notify_all();
     return status;
 }
 
+bool ModelInstance::isLoadedFromCache() const {
+    try {
+        OV_LOGGER("ov::CompiledModel: {} compiledModel->get_property(ov::loaded_from_cache)", reinterpret_cast<void*>(this->compiledModel.get()));
+        return compiledModel->get_property(ov::loaded_from_cache);
+    } catch (const ov::Exception& e) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Failed to query LOADED_FROM_CACHE for model: {} version: {}; error: {}", getName(), getVersion(), e.what());
+    }
+    return false;
+}
+
+bool ModelInstance::isCachingDisabledByDefault(const ModelConfig& config) {
+    return config.isCustomLoaderRequiredToLoadModel() || config.anyShapeSetToAuto() || (config.getBatchingMode() == Mode::AUTO);
+}
+
 Status ModelInstance::setCacheOptions(const ModelConfig& config) {
     if (!config.getCacheDir().empty()) {
-        if (!config.isAllowCacheSetToTrue() && (config.isCustomLoaderRequiredToLoadModel() || config.anyShapeSetToAuto() || (config.getBatchingMode() == Mode::AUTO))) {
-            OV_LOGGER("ov::Core: {}, ieCore.set_property(ov::cache_dir({}))", reinterpret_cast<const void*>(this->compiledModel.get()), "");
-            this->ieCore.set_property(ov::cache_dir(""));
+        if (!config.isAllowCacheSetToTrue() && isCachingDisabledByDefault(config)) {
             SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Model: {} has disabled caching", this->getName());
             this->cacheDisabled = true;
         } else if (config.isAllowCacheSetToTrue() && config.isCustomLoaderRequiredToLoadModel()) {
             SPDLOG_LOGGER_ERROR(modelmanager_logger, "Model: {} has allow cache set to true while using custom loader", this->getName());
             return StatusCode::ALLOW_CACHE_WITH_CUSTOM_LOADER;
         } else {
-            OV_LOGGER("ov::Core: {}, ieCore.set_property(ov::cache_dir({}))", reinterpret_cast<const void*>(this->compiledModel.get()), config.getCacheDir());
-            this->ieCore.set_property(ov::cache_dir(config.getCacheDir()));
             SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Model: {} has enabled caching", this->getName());
+            this->cacheDisabled = false;
+        }
+    }
+    return StatusCode::OK;
+}
+
+Status ModelInstance::compileIntoCache(const ModelConfig& config, bool& loadedFromCache) {
+    std::lock_guard<std::recursive_mutex> loadingLock(loadingMutex);
+    loadedFromCache = false;
+    if (config.getCacheDir().empty()) {
+        return StatusCode::OK;
+    }
+    this->path = config.getPath();
+    this->targetDevice = config.getTargetDevice();
+    this->config = config;
+    auto status = fetchModelFilepaths();
+    if (!status.ok()) {
+        return status;
+    }
+    try {
+        status = setCacheOptions(this->config);
+        if (!status.ok()) {
+            return status;
         }
+        if (this->cacheDisabled) {
+            return StatusCode::OK;
+        }
+        // Placement changes number of streams which is part of cache entry key
+        status = resolvePlacement(this->config);
+        if (!status.ok()) {
+            return status;
+        }
+        status = loadOVModel();
+        if (!status.ok()) {
+            return status;
+        }
+        status = loadTensors(this->config, true);
+        if (!status.ok()) {
+            return status;
+        }
+        OV_LOGGER("ov::Core: {}, ov::Model: {}, targetDevice: {}, ieCore.compile_model(model, targetDevice, pluginConfig", reinterpret_cast<void*>(&ieCore), reinterpret_cast<void*>(this->model.get()), this->targetDevice);
+        ov::CompiledModel compiled = ieCore.compile_model(this->model, this->targetDevice, prepareCompilationPluginConfig(this->config));
+        try {
+            OV_LOGGER("ov::CompiledModel: {} compiledModel.get_property(ov::loaded_from_cache)", reinterpret_cast<void*>(&compiled));
+            loadedFromCache = compiled.get_property(ov::loaded_from_cache);
+        } catch (const ov::Exception& e) {
+            SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Failed to query LOADED_FROM_CACHE for model: {} version: {}; error: {}", getName(), getVersion(), e.what());
+        }
+    } catch (const std::exception& e) {
+        Status status = StatusCode::CANNOT_COMPILE_MODEL_INTO_TARGET_DEVICE;
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "{}; error: {}; model: {}; version: {}; device: {}",
+            status.string(),
+            e.what(),
+            getName(),
+            getVersion(),
+            config.getTargetDevice());
+        this->model.reset();
+        return status;
     }
+    this->model.reset();
     return StatusCode::OK;
 }
 
@@ -1045,6 +1372,241 @@ Status ModelInstance::reloadModelIfRequired(
     return status;
 }
 
+bool ModelInstance::isShapeVariantsPoolEnabled() const {
+    return this->config.getMaxShapeVariants() > 0 && !this->config.isStateful();
+}
+
+size_t ModelInstance::getShapeVariantsLimit() const {
+    if (this->config.getMaxShapeVariants() > 0 || this->config.getShapeBuckets().empty()) {
+        return this->config.getMaxShapeVariants();
+    }
+    // All bucket combinations are kept by default, the largest buckets are served by main compiled model
+    size_t limit = 1;
+    for (const auto& [name, buckets] : this->config.getShapeBuckets()) {
+        limit *= buckets.sizes.size();
+    }
+    return limit - 1;
+}
+
+Status ModelInstance::validateShapeBuckets(const ModelConfig& config) const {
+    if (config.getShapeBuckets().empty()) {
+        return StatusCode::OK;
+    }
+    if (config.isStateful() || config.getBatchingMode() == Mode::AUTO || config.anyShapeSetToAuto()) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Shape buckets cannot be used with stateful model or shape/batch size set to auto; model: {}; version: {}",
+            getName(), getVersion());
+        return StatusCode::MODEL_CONFIG_INVALID;
+    }
+    for (const auto& [name, buckets] : config.getShapeBuckets()) {
+        auto it = this->inputsInfo.find(name);
+        if (it == this->inputsInfo.end()) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Shape buckets set for input: {} which is not present in model: {}; version: {}",
+                name, getName(), getVersion());
+            return StatusCode::CONFIG_SHAPE_IS_NOT_IN_MODEL;
+        }
+        const auto& info = *it->second;
+        const auto batchIndex = info.getLayout().getBatchIndex();
+        if (buckets.dimension >= info.getShape().size() || (batchIndex.has_value() && batchIndex.value() == buckets.dimension)) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Shape buckets dimension: {} is out of shape: {} or is a batch dimension of input: {}; model: {}; version: {}",
+                buckets.dimension, info.getShape().toString(), name, getName(), getVersion());
+            return StatusCode::MODEL_CONFIG_INVALID;
+        }
+    }
+    return StatusCode::OK;
+}
+
+Status ModelInstance::validateShapeBucketsOutputs(const ModelConfig& config) const {
+    for (const auto& [name, buckets] : config.getShapeBuckets()) {
+        for (const auto& [outputName, dimension] : buckets.outputs) {
+            auto it = this->outputsInfo.find(outputName);
+            if (it == this->outputsInfo.end()) {
+                SPDLOG_LOGGER_ERROR(modelmanager_logger, "Shape buckets of input: {} set for output: {} which is not present in model: {}; version: {}",
+                    name, outputName, getName(), getVersion());
+                return StatusCode::CONFIG_SHAPE_IS_NOT_IN_MODEL;
+            }
+            if (dimension >= it->second->getShape().size()) {
+                SPDLOG_LOGGER_ERROR(modelmanager_logger, "Shape buckets output dimension: {} is out of shape: {} of output: {}; model: {}; version: {}",
+                    dimension, it->second->getShape().toString(), outputName, getName(), getVersion());
+                return StatusCode::MODEL_CONFIG_INVALID;
+            }
+        }
+    }
+    return StatusCode::OK;
+}
+
+Status ModelInstance::getBucketShapeVariant(const std::map<std::string, shape_t>& requestShapes, std::map<std::string, InputPadding>& inputsPadding, std::shared_ptr<ShapeVariant>& variant) {
+    OVMS_PROFILE_FUNCTION();
+    std::map<std::string, ov::PartialShape> modelShapes;
+    bool variantRequired = false;
+    for (const auto& [name, info] : this->inputsInfo) {
+        ov::PartialShape shape = info->getShape().createPartialShape();
+        auto bucketsIt = this->config.getShapeBuckets().find(name);
+        auto requestShapeIt = requestShapes.find(name);
+        if (bucketsIt != this->config.getShapeBuckets().end() && requestShapeIt != requestShapes.end()) {
+            const auto& buckets = bucketsIt->second;
+            if (buckets.dimension >= requestShapeIt->second.size()) {
+                return StatusCode::INVALID_NO_OF_SHAPE_DIMENSIONS;
+            }
+            auto bucket = buckets.getBucket(static_cast<dimension_value_t>(requestShapeIt->second[buckets.dimension]));
+            if (!bucket.has_value()) {
+                return StatusCode::INVALID_SHAPE;
+            }
+            if (shape[buckets.dimension] != ov::Dimension(bucket.value())) {
+                shape[buckets.dimension] = bucket.value();
+                variantRequired = true;
+            }
+            auto& padding = inputsPadding[info->getName()];
+            padding = {buckets.dimension, bucket.value(), buckets.padValue, {}};
+            for (const auto& [outputName, outputDimension] : buckets.outputs) {
+                auto outputIt = this->outputsInfo.find(outputName);
+                if (outputIt != this->outputsInfo.end()) {
+                    padding.outputs.emplace(outputIt->second->getName(), outputDimension);
+                }
+            }
+        }
+        modelShapes[info->getName()] = shape;
+    }
+    if (!variantRequired) {
+        return StatusCode::OK;
+    }
+    return getShapeVariant(modelShapes, DynamicModelParameter(), variant);
+}
+
+size_t ModelInstance::getShapeVariantsCount() {
+    std::lock_guard<std::mutex> lock(shapeVariantsMtx);
+    return shapeVariants.size();
+}
+
+void ModelInstance::clearShapeVariants() {
+    decltype(shapeVariants) variants;
+    std::lock_guard<std::mutex> lock(shapeVariantsMtx);
+    variants.swap(shapeVariants);
+}
+
+static std::string createShapeVariantKey(const std::map<std::string, ov::PartialShape>& modelShapes, const DynamicModelParameter& parameter) {
+    std::stringstream key;
+    if (parameter.isBatchSizeRequested()) {
+        key << "batch:" << parameter.getBatchSize() << ";";
+    }
+    for (const auto& [name, shape] : modelShapes) {
+        key << name << ":" << shape.to_string() << ";";
+    }
+    return key.str();
+}
+
+Status ModelInstance::getShapeVariant(const DynamicModelParameter& parameter, std::shared_ptr<ShapeVariant>& variant) {
+    OVMS_PROFILE_FUNCTION();
+    std::map<std::string, ov::PartialShape> modelShapes;
+    bool reshapeRequired = false;
+    auto status = gatherReshapeInfo(this->config.getBatchingMode() == Mode::AUTO, parameter, reshapeRequired, modelShapes);
+    if (!status.ok()) {
+        return status;
+    }
+    return getShapeVariant(modelShapes, parameter, variant);
+}
+
+Status ModelInstance::getShapeVariant(const std::map<std::string, ov::PartialShape>& modelShapes, const DynamicModelParameter& parameter, std::shared_ptr<ShapeVariant>& variant) {
+    const std::string key = createShapeVariantKey(modelShapes, parameter);
+    auto findVariant = [this, &key]() -> std::shared_ptr<ShapeVariant> {
+        std::lock_guard<std::mutex> lock(shapeVariantsMtx);
+        for (auto it = shapeVariants.begin(); it != shapeVariants.end(); ++it) {
+            if (it->first == key) {
+                shapeVariants.splice(shapeVariants.begin(), shapeVariants, it);
+                return it->second;
+            }
+        }
+        return nullptr;
+    };
+    variant = findVariant();
+    if (variant) {
+        return StatusCode::OK;
+    }
+    std::lock_guard<std::mutex> compilationLock(shapeVariantsCompilationMtx);
+    variant = findVariant();
+    if (variant) {
+        return StatusCode::OK;
+    }
+    auto compiledVariant = std::make_shared<ShapeVariant>();
+    auto status = compileShapeVariant(modelShapes, parameter, *compiledVariant);
+    if (!status.ok()) {
+        return status;
+    }
+    // Evicted variants are released after unlocking since in-flight requests may still use them
+    decltype(shapeVariants) evicted;
+    std::lock_guard<std::mutex> lock(shapeVariantsMtx);
+    shapeVariants.emplace_front(key, compiledVariant);
+    while (shapeVariants.size() > getShapeVariantsLimit()) {
+        SPDLOG_DEBUG("Evicting shape variant: {} of model: {} version: {}", shapeVariants.back().first, getName(), getVersion());
+        evicted.splice(evicted.end(), shapeVariants, std::prev(shapeVariants.end()));
+    }
+    variant = std::move(compiledVariant);
+    return StatusCode::OK;
+}
+
+Status ModelInstance::compileShapeVariant(const std::map<std::string, ov::PartialShape>& modelShapes, const DynamicModelParameter& parameter, ShapeVariant& variant) {
+    SPDLOG_INFO("Compiling shape variant of model: {} version: {}", getName(), getVersion());
+    std::shared_ptr<ov::Model> variantModel;
+    try {
+        OV_LOGGER("ov::Model: {}, model->clone()", reinterpret_cast<void*>(this->model.get()));
+        variantModel = this->model->clone();
+        OV_LOGGER("ov::Model: {}, model->reshape(modelShapes)", reinterpret_cast<void*>(variantModel.get()));
+        variantModel->reshape(modelShapes);
+    } catch (const std::exception& e) {
+        SPDLOG_WARN("OV does not support reshaping model: {} with provided shape", getName());
+        SPDLOG_DEBUG("Description: {}", e.what());
+        return StatusCode::RESHAPE_ERROR;
+    }
+    if (parameter.isBatchSizeRequested()) {
+        try {
+            OV_LOGGER("ov::Model: {}, ov::set_batch({})", reinterpret_cast<void*>(variantModel.get()), parameter.getBatchSize());
+            ov::set_batch(variantModel, parameter.getBatchSize());
+        } catch (const std::exception& e) {
+            return Status(StatusCode::INVALID_BATCH_DIMENSION, e.what());
+        }
+    }
+    Timer<COMPILATION_TIMER_END> timer;
+    try {
+        for (const auto& [mappedName, info] : this->inputsInfo) {
+            OV_LOGGER("ov::Model: {}, model->input({}).get_partial_shape()", reinterpret_cast<void*>(variantModel.get()), info->getName());
+            variant.inputsInfo[mappedName] = std::make_shared<TensorInfo>(
+                info->getName(),
+                info->getMappedName(),
+                info->getPrecision(),
+                Shape(variantModel->input(info->getName()).get_partial_shape()),
+                info->getLayout());
+        }
+        for (const auto& [mappedName, info] : this->outputsInfo) {
+            OV_LOGGER("ov::Model: {}, model->output({}).get_partial_shape()", reinterpret_cast<void*>(variantModel.get()), info->getName());
+            Shape shape(variantModel->output(info->getName()).get_partial_shape());
+            shape = getTrimmedOutputShape(shape, mappedName, this->config.getShapeBuckets());
+            variant.outputsInfo[mappedName] = std::make_shared<TensorInfo>(
+                info->getName(),
+                info->getMappedName(),
+                info->getPrecision(),
+                shape,
+                info->getLayout());
+        }
+        CpuAffinityGuard affinityGuard(this->placementCores);
+        timer.start(COMPILE);
+        OV_LOGGER("ov::Core: {}, ov::Model: {}, targetDevice: {}, ieCore.compile_model(model, targetDevice, pluginConfig", reinterpret_cast<void*>(&ieCore), reinterpret_cast<void*>(variantModel.get()), this->targetDevice);
+        variant.compiledModel = std::make_shared<ov::CompiledModel>(ieCore.compile_model(variantModel, this->targetDevice, prepareCompilationPluginConfig(this->config)));
+        timer.stop(COMPILE);
+        variant.inferRequestsQueue = std::make_unique<OVInferRequestsQueue>(*variant.compiledModel, this->inferRequestsQueue->size());
+    } catch (const std::exception& e) {
+        Status status = StatusCode::CANNOT_COMPILE_MODEL_INTO_TARGET_DEVICE;
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "{}; error: {}; model: {}; version: {}; device: {}",
+            status.string(),
+            e.what(),
+            getName(),
+            getVersion(),
+            this->targetDevice);
+        return status;
+    }
+    OBSERVE_IF_ENABLED(this->getMetricReporter().compilationTime, timer.elapsed<std::chrono::microseconds>(COMPILE));
+    SPDLOG_INFO("Compiled shape variant of model: {} version: {} in {} ms", getName(), getVersion(), timer.elapsed<std::chrono::microseconds>(COMPILE) / 1000);
+    return StatusCode::OK;
+}
+
 Status ModelInstance::waitForLoaded(const uint waitForModelLoadedTimeoutMilliseconds,
     std::unique_ptr<ModelInstanceUnloadGuard>& modelInstanceUnloadGuard) {
     // order is important here for performance reasons
@@ -1123,9 +1685,17 @@ void ModelInstance::unloadModelComponents() {
     }
     SET_IF_ENABLED(this->getMetricReporter().inferReqQueueSize, 0);
     SET_IF_ENABLED(this->getMetricReporter().streams, 0);
+    clearShapeVariants();
+    setInferRequestsQueueGauges(nullptr);
+    setMemoryGauges(false);
+    this->weightsMemory = 0;
+    this->sharedWeightsMemory = 0;
+    this->compiledModelMemory = 0;
+    this->inferRequestsMemory = 0;
     inferRequestsQueue.reset();
     compiledModel.reset();
     model.reset();
+    sharedWeights.reset();
     outputsInfo.clear();
     inputsInfo.clear();
     modelFiles.clear();
@@ -1161,14 +1731,22 @@ const Status ModelInstance::validate(const RequestType* request) {
         getVersion(),
         this->getOptionalInputNames(),
         getModelConfig().getBatchingMode(),
-        getModelConfig().getShapes());
+        getModelConfig().getShapes(),
+        getModelConfig().getShapeBuckets());
 }
 
 template const Status ModelInstance::validate(const InferenceRequest* request);
 template const Status ModelInstance::validate(const ::KFSRequest* request);
 template const Status ModelInstance::validate(const tensorflow::serving::PredictRequest* request);
 
-Status ModelInstance::performInference(ov::InferRequest& inferRequest) {
+static Status checkClientWaiting(const ExecutionContext* executionContext) {
+    if (executionContext == nullptr) {
+        return StatusCode::OK;
+    }
+    return executionContext->checkClientWaiting();
+}
+
+Status ModelInstance::performInference(ov::InferRequest& inferRequest, const ExecutionContext* executionContext) {
     OVMS_PROFILE_FUNCTION();
     try {
         enum : unsigned int {
@@ -1183,7 +1761,25 @@ Status ModelInstance::performInference(ov::InferRequest& inferRequest) {
         OVMS_PROFILE_SYNC_END("ov::InferRequest::start_async");
         OV_LOGGER("ov::InferRequest: {}, inferRequest.wait()", reinterpret_cast<void*>(&inferRequest));
         OVMS_PROFILE_SYNC_BEGIN("ov::InferRequest::wait");
-        inferRequest.wait();
+        if (executionContext != nullptr && executionContext->canBeAbandoned()) {
+            while (!inferRequest.wait_for(std::chrono::milliseconds(CANCELLATION_CHECK_INTERVAL_MILLISECONDS))) {
+                auto status = executionContext->checkClientWaiting();
+                if (!status.ok()) {
+                    SPDLOG_DEBUG("Cancelling inference in model: {}, version: {}; {}", getName(), getVersion(), status.string());
+                    OV_LOGGER("ov::InferRequest: {}, inferRequest.cancel()", reinterpret_cast<void*>(&inferRequest));
+                    inferRequest.cancel();
+                    try {
+                        inferRequest.wait();
+                    } catch (const ov::Exception&) {
+                        // Cancelled inference reports exception when waited for
+                    }
+                    OVMS_PROFILE_SYNC_END("ov::InferRequest::wait");
+                    return status;
+                }
+            }
+        } else {
+            inferRequest.wait();
+        }
         OVMS_PROFILE_SYNC_END("ov::InferRequest::wait");
         timer.stop(INFER);
         double inferTime = timer.elapsed<std::chrono::microseconds>(INFER);
@@ -1199,7 +1795,8 @@ Status ModelInstance::performInference(ov::InferRequest& inferRequest) {
 template <typename RequestType, typename ResponseType>
 Status ModelInstance::infer(const RequestType* requestProto,
     ResponseType* responseProto,
-    std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr) {
+    std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr,
+    const ExecutionContext* executionContext) {
     OVMS_PROFILE_FUNCTION();
     Timer<TIMER_END> timer;
     using std::chrono::microseconds;
@@ -1208,31 +1805,70 @@ Status ModelInstance::infer(const RequestType* requestProto,
     auto status = requestProcessor->extractRequestParameters(requestProto);
     if (!status.ok())
         return status;
+    RequestPriority priority = getDefaultPriority();
+    status = getRequestPriority(requestProto, priority);
+    if (!status.ok())
+        return status;
+    timer.start(VALIDATE);
     status = validate(requestProto);
+    timer.stop(VALIDATE);
+    OBSERVE_IF_ENABLED(this->getMetricReporter().validationTime, timer.elapsed<microseconds>(VALIDATE));
+    std::shared_ptr<ShapeVariant> shapeVariant;
     if (status.batchSizeChangeRequired() || status.reshapeRequired()) {
         // We are ensured that request shape is valid and convertible to model shape (non negative, non zero)
         // We can use it to perform reshape via shape=auto
         auto requestBatchSize = getRequestBatchSize(requestProto, this->getBatchSizeIndex());
         auto requestShapes = getRequestShapes(requestProto);
-        status = reloadModelIfRequired(status, requestBatchSize, requestShapes, modelUnloadGuardPtr);
+        if (isShapeVariantsPoolEnabled()) {
+            if (status.batchSizeChangeRequired() && requestBatchSize.has_value() && requestBatchSize.value().isStatic()) {
+                status = getShapeVariant(DynamicModelParameter(requestBatchSize.value().getStaticValue()), shapeVariant);
+            } else {
+                status = getShapeVariant(DynamicModelParameter(requestShapes), shapeVariant);
+            }
+        } else {
+            status = reloadModelIfRequired(status, requestBatchSize, requestShapes, modelUnloadGuardPtr);
+        }
     }
     if (!status.ok())
         return status;
+    std::map<std::string, InputPadding> inputsPadding;
+    const bool isBucketingUsed = !this->config.getShapeBuckets().empty();
+    if (isBucketingUsed) {
+        status = getBucketShapeVariant(getRequestShapes(requestProto), inputsPadding, shapeVariant);
+        if (!status.ok())
+            return status;
+    }
     status = requestProcessor->prepare();
     if (!status.ok())
         return status;
+    const tensor_map_t& inputsInfo = shapeVariant ? shapeVariant->inputsInfo : getInputsInfo();
+    const tensor_map_t& outputsInfo = shapeVariant ? shapeVariant->outputsInfo : getOutputsInfo();
 
+    OVInferRequestsQueue& queue = shapeVariant ? *shapeVariant->inferRequestsQueue : getInferRequestsQueue();
+    status = admitRequest(queue);
+    if (!status.ok())
+        return status;
+    status = checkClientWaiting(executionContext);
+    if (!status.ok())
+        return status;
     timer.start(GET_INFER_REQUEST);
     OVMS_PROFILE_SYNC_BEGIN("getInferRequest");
-    ExecutingStreamIdGuard executingStreamIdGuard(getInferRequestsQueue(), this->getMetricReporter());
+    ExecutingStreamIdGuard executingStreamIdGuard(queue, this->getMetricReporter(), priority);
     int executingInferId = executingStreamIdGuard.getId();
     ov::InferRequest& inferRequest = executingStreamIdGuard.getInferRequest();
     OVMS_PROFILE_SYNC_END("getInferRequest");
     timer.stop(GET_INFER_REQUEST);
     double getInferRequestTime = timer.elapsed<microseconds>(GET_INFER_REQUEST);
     OBSERVE_IF_ENABLED(this->getMetricReporter().waitForInferReqTime, getInferRequestTime);
-    SPDLOG_DEBUG("Getting infer req duration in model {}, version {}, nireq {}: {:.3f} ms",
-        getName(), getVersion(), executingInferId, getInferRequestTime / 1000);
+    OBSERVE_IF_ENABLED(this->getMetricReporter().getWaitForInferReqTimeMetric(priority), getInferRequestTime);
+    SPDLOG_DEBUG("Getting infer req duration in model {}, version {}, nireq {}, priority {}: {:.3f} ms",
+        getName(), getVersion(), executingInferId, toString(priority), getInferRequestTime / 1000);
+    // Client could stop waiting while request was queued
+    status = checkClientWaiting(executionContext);
+    if (!status.ok()) {
+        SPDLOG_DEBUG("Skipping inference in model {}, version {}: {}", getName(), getVersion(), status.string());
+        return status;
+    }
 
     timer.start(PREPROCESS);
     status = requestProcessor->preInferenceProcessing(inferRequest);
@@ -1243,29 +1879,45 @@ Status ModelInstance::infer(const RequestType* requestProto,
         getName(), getVersion(), executingInferId, timer.elapsed<microseconds>(PREPROCESS) / 1000);
 
     timer.start(DESERIALIZE);
-    InputSink<ov::InferRequest&> inputSink(inferRequest);
+    BucketedInferRequest bucketedInferRequest(inferRequest, inputsPadding);
     bool isPipeline = false;
-    status = deserializePredictRequest<ConcreteTensorProtoDeserializator>(*requestProto, getInputsInfo(), inputSink, isPipeline);
+    if (isBucketingUsed) {
+        InputSink<BucketedInferRequest&> inputSink(bucketedInferRequest);
+        status = deserializePredictRequest<ConcreteTensorProtoDeserializator>(*requestProto, inputsInfo, inputSink, isPipeline);
+    } else {
+        InputSink<ov::InferRequest&> inputSink(inferRequest);
+        status = deserializePredictRequest<ConcreteTensorProtoDeserializator>(*requestProto, inputsInfo, inputSink, isPipeline);
+    }
     timer.stop(DESERIALIZE);
     if (!status.ok())
         return status;
+    OBSERVE_IF_ENABLED(this->getMetricReporter().deserializationTime, timer.elapsed<microseconds>(DESERIALIZE));
     SPDLOG_DEBUG("Deserialization duration in model {}, version {}, nireq {}: {:.3f} ms",
         getName(), getVersion(), executingInferId, timer.elapsed<microseconds>(DESERIALIZE) / 1000);
 
     timer.start(PREDICTION);
-    status = performInference(inferRequest);
+    status = performInference(inferRequest, executionContext);
     timer.stop(PREDICTION);
+    if (!status.ok())
+        return status;
+    status = checkClientWaiting(executionContext);
     if (!status.ok())
         return status;
     SPDLOG_DEBUG("Prediction duration in model {}, version {}, nireq {}: {:.3f} ms",
         getName(), getVersion(), executingInferId, timer.elapsed<microseconds>(PREDICTION) / 1000);
 
     timer.start(SERIALIZE);
-    OutputGetter<ov::InferRequest&> outputGetter(inferRequest);
-    status = serializePredictResponse(outputGetter, getName(), getVersion(), getOutputsInfo(), responseProto, getTensorInfoName, useSharedOutputContentFn(requestProto));
+    if (isBucketingUsed) {
+        OutputGetter<BucketedInferRequest&> outputGetter(bucketedInferRequest);
+        status = serializePredictResponse(outputGetter, getName(), getVersion(), outputsInfo, responseProto, getTensorInfoName, useSharedOutputContentFn(requestProto));
+    } else {
+        OutputGetter<ov::InferRequest&> outputGetter(inferRequest);
+        status = serializePredictResponse(outputGetter, getName(), getVersion(), outputsInfo, responseProto, getTensorInfoName, useSharedOutputContentFn(requestProto));
+    }
     timer.stop(SERIALIZE);
     if (!status.ok())
         return status;
+    OBSERVE_IF_ENABLED(this->getMetricReporter().serializationTime, timer.elapsed<microseconds>(SERIALIZE));
     SPDLOG_DEBUG("Serialization duration in model {}, version {}, nireq {}: {:.3f} ms",
         getName(), getVersion(), executingInferId, timer.elapsed<microseconds>(SERIALIZE) / 1000);
 
@@ -1285,10 +1937,12 @@ Status ModelInstance::infer(const RequestType* requestProto,
 }
 template Status ModelInstance::infer<tensorflow::serving::PredictRequest, tensorflow::serving::PredictResponse>(const tensorflow::serving::PredictRequest* requestProto,
     tensorflow::serving::PredictResponse* responseProto,
-    std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr);
+    std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr,
+    const ExecutionContext* executionContext);
 template Status ModelInstance::infer(const ::KFSRequest* requestProto,
     ::KFSResponse* responseProto,
-    std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr);
+    std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr,
+    const ExecutionContext* executionContext);
 const size_t ModelInstance::getBatchSizeIndex() const {
     const auto& inputItr = this->inputsInfo.cbegin();
     if (inputItr == this->inputsInfo.cend()) {
@@ -1336,7 +1990,7 @@ std::unique_ptr<RequestProcessor<InferenceRequest, InferenceResponse>> ModelInst
     return std::make_unique<RequestProcessor<InferenceRequest, InferenceResponse>>();
 }
 
-template Status ModelInstance::infer<InferenceRequest, InferenceResponse>(InferenceRequest const*, InferenceResponse*, std::unique_ptr<ModelInstanceUnloadGuard>&);
+template Status ModelInstance::infer<InferenceRequest, InferenceResponse>(InferenceRequest const*, InferenceResponse*, std::unique_ptr<ModelInstanceUnloadGuard>&, const ExecutionContext*);
 
 template <typename RequestType, typename ResponseType>
 RequestProcessor<RequestType, ResponseType>::RequestProcessor() = default;
@@ -15,10 +15,13 @@
 //*****************************************************************************
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <functional>
+#include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <string>
@@ -28,16 +31,21 @@
 #include <openvino/openvino.hpp>
 
 #include "kfs_frontend/kfs_grpc_inference_service.hpp"
+#include "model_memory_usage.hpp"
 #include "model_metric_reporter.hpp"
 #include "modelchangesubscription.hpp"
 #include "modelconfig.hpp"
 #include "modelinstanceunloadguard.hpp"
 #include "modelversionstatus.hpp"
 #include "ovinferrequestsqueue.hpp"
+#include "shapebucketing.hpp"
+#include "sharedweights.hpp"
+#include "systeminfo.hpp"
 #include "tensorinfo.hpp"
 #include "tfs_frontend/tfs_utils.hpp"
 
 namespace ovms {
+struct ExecutionContext;
 class MetricRegistry;
 class ModelInstanceUnloadGuard;
 class InferenceRequest;
@@ -92,11 +100,36 @@ protected:
          */
     std::shared_ptr<ov::Model> model;
 
+    /**
+         * @brief Model weights shared with other instances, referenced by model constants
+         */
+    std::shared_ptr<const SharedWeights> sharedWeights;
+
     /**
          * @brief OpenVINO Runtime CompiledModel object
          */
     std::shared_ptr<ov::CompiledModel> compiledModel;
 
+    /**
+         * @brief Memory used by model weights, compiled model and infer requests, measured during load
+         */
+    std::atomic<size_t> weightsMemory = 0;
+    std::atomic<size_t> sharedWeightsMemory = 0;
+    std::atomic<size_t> compiledModelMemory = 0;
+    std::atomic<size_t> inferRequestsMemory = 0;
+
+    /**
+         * @brief Points memory gauges to this instance, disabling detaches them
+         */
+    virtual void setMemoryGauges(bool enabled);
+
+    /**
+         * @brief Checks weights and infer requests memory against memory_limit_mb from model config
+         *
+         * @return Status MODEL_MEMORY_LIMIT_EXCEEDED when model should not be loaded
+         */
+    Status checkMemoryLimit() const;
+
     /**
          * @brief Model name
          */
@@ -206,6 +239,11 @@ protected:
          */
     virtual Status loadOVCompiledModel(const ModelConfig& config);
 
+    /**
+         * @brief Plugin config used for model compilation, including model cache settings
+         */
+    plugin_config_t prepareCompilationPluginConfig(const ModelConfig& config) const;
+
     /**
          * @brief Prepares inferenceRequestsQueue
          */
@@ -258,6 +296,27 @@ private:
          */
     std::unique_ptr<OVInferRequestsQueue> inferRequestsQueue;
 
+    /**
+         * @brief Model compiled for shapes requested with shape or batch size set to auto, served next to the main compiled model
+         */
+    struct ShapeVariant {
+        std::shared_ptr<ov::CompiledModel> compiledModel;
+        std::unique_ptr<OVInferRequestsQueue> inferRequestsQueue;
+        tensor_map_t inputsInfo;
+        tensor_map_t outputsInfo;
+    };
+
+    /**
+         * @brief Recently used shape variants keyed by input shapes, most recently used first
+         */
+    std::list<std::pair<std::string, std::shared_ptr<ShapeVariant>>> shapeVariants;
+    std::mutex shapeVariantsMtx;
+
+    /**
+         * @brief Serializes compilation of shape variants so that requests for the same shape compile it once
+         */
+    std::mutex shapeVariantsCompilationMtx;
+
     /**
          * @brief Holds current usage count in predict requests
          * 
@@ -265,6 +324,12 @@ private:
          */
     std::atomic<uint64_t> predictRequestsHandlesCount = 0;
 
+    /**
+         * @brief Admission control limits, updated without reloading model version
+         */
+    std::atomic<uint32_t> maxWaitingRequests = 0;
+    std::atomic<uint32_t> maxQueueWaitMs = 0;
+
     /**
          * @brief Internal method for loading tensors
          *
@@ -292,6 +357,17 @@ private:
       */
     bool cacheDisabled = false;
 
+    /**
+      * @brief Cores on which compiled model and infer requests are placed, empty when placement is not configured
+      */
+    cpu_cores_t placementCores;
+    std::string placement;
+
+    /**
+         * @brief Resolves cores for numa_node and cpu_cores options against host topology
+         */
+    Status resolvePlacement(const ModelConfig& config);
+
     /**
          * @brief Configures batchsize
          */
@@ -319,6 +395,45 @@ private:
          */
     Status reshapeWithFullReload(const Status& status, const DynamicModelParameter& parameter);
 
+    bool isShapeVariantsPoolEnabled() const;
+
+    /**
+         * @brief Finds compiled shape variant for requested dynamic parameter or compiles it, evicting least recently used variant over the limit
+         */
+    Status getShapeVariant(const DynamicModelParameter& parameter, std::shared_ptr<ShapeVariant>& variant);
+
+    Status getShapeVariant(const std::map<std::string, ov::PartialShape>& modelShapes, const DynamicModelParameter& parameter, std::shared_ptr<ShapeVariant>& variant);
+
+    Status compileShapeVariant(const std::map<std::string, ov::PartialShape>& modelShapes, const DynamicModelParameter& parameter, ShapeVariant& variant);
+
+    size_t getShapeVariantsLimit() const;
+
+    /**
+         * @brief Checks if shape buckets from config can be applied to model inputs
+         */
+    Status validateShapeBuckets(const ModelConfig& config) const;
+
+    /**
+         * @brief Selects bucket sizes for request inputs. Main compiled model serves the largest buckets, other buckets are served by shape variants.
+         *
+         * @param requestShapes shapes of request inputs
+         * @param inputsPadding padding of model inputs to apply on deserialization
+         * @param variant shape variant to use, not set if main compiled model should be used
+         */
+    Status getBucketShapeVariant(const std::map<std::string, shape_t>& requestShapes, std::map<std::string, InputPadding>& inputsPadding, std::shared_ptr<ShapeVariant>& variant);
+
+    /**
+         * @brief Checks that outputs trimmed by shape buckets are present in model
+         */
+    Status validateShapeBucketsOutputs(const ModelConfig& config) const;
+
+    void clearShapeVariants();
+
+    /**
+         * @brief Points infer request queue gauges to the queue, nullptr detaches them
+         */
+    void setInferRequestsQueueGauges(OVInferRequestsQueue* queue);
+
     /**
       * Variable to tell reload is due to customloader config change
       */
@@ -423,6 +538,30 @@ public:
         return cacheDisabled;
     }
 
+    /**
+         * @brief Check if caching is disabled for model config unless allowed explicitly with allow_cache
+         */
+    static bool isCachingDisabledByDefault(const ModelConfig& config);
+
+    /**
+         * @brief Check if compiled model was imported from model cache
+         */
+    bool isLoadedFromCache() const;
+
+    /**
+         * @brief Describes NUMA node and cores the model is placed on, empty when placement is not configured
+         */
+    const std::string& getPlacement() const {
+        return placement;
+    }
+
+    /**
+         * @brief Priority of requests which do not specify one
+         */
+    RequestPriority getDefaultPriority() const {
+        return config.getPriority().value_or(RequestPriority::MEDIUM);
+    }
+
     /**
          * @brief Gets batch size
          *
@@ -485,6 +624,34 @@ public:
         return *inferRequestsQueue;
     }
 
+    /**
+         * @brief Checks admission control limits from model config before request waits for infer request
+         *
+         * @param queue infer requests queue the request is going to wait in
+         *
+         * @return Status INFER_QUEUE_OVERLOADED when request should be rejected
+         */
+    Status admitRequest(OVInferRequestsQueue& queue) const;
+
+    /**
+         * @brief Applies admission control limits from model config, does not require model version reload
+         *
+         * @param config
+         */
+    void setAdmissionLimits(const ModelConfig& config);
+
+    /**
+         * @brief Get host memory used by model version
+         *
+         * @return ModelMemoryUsage
+         */
+    virtual ModelMemoryUsage getMemoryUsage() const;
+
+    /**
+         * @brief Get number of compiled shape variants kept in addition to the main compiled model
+         */
+    size_t getShapeVariantsCount();
+
     /**
          * @brief Combines plugin config from user with default config calculated at runtime
          *
@@ -501,6 +668,18 @@ public:
          */
     virtual Status loadModel(const ModelConfig& config);
 
+    /**
+         * @brief Compiles model version into model cache without loading it for serving.
+         * Model is transformed the same way as for serving so that cache entry is reused on load,
+         * but compiled model is released right away and no inference requests are created.
+         *
+         * @param config model configuration with cache directory set
+         * @param loadedFromCache set to true if model was already present in cache
+         *
+         * @return Status
+         */
+    Status compileIntoCache(const ModelConfig& config, bool& loadedFromCache);
+
     /**
          * @brief Reloads model version
          *
@@ -567,12 +746,16 @@ public:
 
     const ModelChangeSubscription& getSubscribtionManager() const { return subscriptionManager; }
 
-    Status performInference(ov::InferRequest& inferRequest);
+    /**
+     * @brief Runs inference, cancels it when execution context reports that client does not wait for the response
+     */
+    Status performInference(ov::InferRequest& inferRequest, const ExecutionContext* executionContext = nullptr);
 
     template <typename RequestType, typename ResponseType>
     Status infer(const RequestType* requestProto,
         ResponseType* responseProto,
-        std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr);
+        std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr,
+        const ExecutionContext* executionContext = nullptr);
 
     ModelMetricReporter& getMetricReporter() const { return *this->reporter; }
 
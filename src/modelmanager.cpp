@@ -16,7 +16,9 @@
 #include "modelmanager.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <filesystem>
 #include <fstream>
 #include <memory>
@@ -50,6 +52,7 @@
 #include "dags/pipeline_factory.hpp"
 #include "dags/pipelinedefinition.hpp"
 #include "filesystem.hpp"
+#include "filesystemwatcher.hpp"
 #include "gcsfilesystem.hpp"
 #include "localfilesystem.hpp"
 #include "logging.hpp"
@@ -60,6 +63,7 @@
 #include "metric_config.hpp"
 #include "metric_registry.hpp"
 #include "modelinstance.hpp"  // for logging
+#include "modelprecompiler.hpp"
 #include "ov_utils.hpp"
 #include "s3filesystem.hpp"
 #include "schema.hpp"
@@ -139,16 +143,27 @@ void ModelManager::logPluginConfiguration() {
 ModelManager::~ModelManager() {
     join();
     models.clear();
+    publishModelsSnapshot();
 }
 
 Status ModelManager::start(const Config& config) {
     this->watcherIntervalMillisec = config.filesystemPollWaitSeconds() * 1000;
+    this->filesystemEventsEnabled = config.filesystemEventsEnabled();
     sequenceCleaupIntervalMinutes = config.sequenceCleanerPollWaitMinutes();
     resourcesCleanupIntervalSec = config.resourcesCleanerPollWaitSeconds();
     if (resourcesCleanupIntervalSec < 1) {
         SPDLOG_LOGGER_WARN(modelmanager_logger, "Parameter: custom_node_resources_cleaner_interval_seconds has to be greater than 0. Applying default value(1 second)");
         resourcesCleanupIntervalSec = 1;
     }
+    modelLoadingThreads = config.modelLoadingThreads();
+    if (modelLoadingThreads < 1) {
+        SPDLOG_LOGGER_WARN(modelmanager_logger, "Parameter: model_loading_threads has to be greater than 0. Applying default value(1)");
+        modelLoadingThreads = 1;
+    }
+    modelLoadingMemoryBudgetBytes = static_cast<uint64_t>(config.modelLoadingMemoryBudgetMB()) * 1024 * 1024;
+    if (config.precompileStagedVersions() && !precompiler) {
+        precompiler = std::make_unique<ModelPrecompiler>(*ieCore);
+    }
     Status status;
     bool startFromConfigFile = (config.configPath() != "");
     if (startFromConfigFile) {
@@ -559,6 +574,7 @@ Status ModelManager::loadMediapipeGraphsConfig(std::vector<MediapipeGraphConfig>
     }
     std::set<std::string> mediapipesInConfigFileNames;
     Status firstErrorStatus = StatusCode::OK;
+    MediapipeFactory::PublishingBatch publishingBatch(mediapipeFactory);
     try {
         for (const auto& mediapipeGraphConfig : mediapipesInConfigFile) {
             auto status = processMediapipeConfig(mediapipeGraphConfig, mediapipesInConfigFileNames, mediapipeFactory);
@@ -585,6 +601,7 @@ Status ModelManager::loadPipelinesConfig(rapidjson::Document& configJson) {
     }
     std::set<std::string> pipelinesInConfigFile;
     Status firstErrorStatus = StatusCode::OK;
+    PipelineFactory::PublishingBatch publishingBatch(pipelineFactory);
     for (const auto& pipelineConfig : itrp->value.GetArray()) {
         auto status = processPipelineConfig(configJson, pipelineConfig, pipelinesInConfigFile, pipelineFactory, *this);
         if (status != StatusCode::OK) {
@@ -694,6 +711,8 @@ Status ModelManager::loadMetricsConfig(rapidjson::Document& configJson) {
 
 Status ModelManager::loadModels(const rapidjson::Value::MemberIterator& modelsConfigList, std::vector<ModelConfig>& gatedModelConfigs, std::set<std::string>& modelsInConfigFile, std::set<std::string>& modelsWithInvalidConfig, std::unordered_map<std::string, ModelConfig>& newModelConfigs, const std::string& rootDirectoryPath) {
     Status firstErrorStatus = StatusCode::OK;
+    Status pluginConfigStatus = StatusCode::OK;
+    std::vector<ModelConfig> modelConfigsToReload;
 
     for (const auto& configs : modelsConfigList->value.GetArray()) {
         ModelConfig modelConfig;
@@ -710,7 +729,8 @@ Status ModelManager::loadModels(const rapidjson::Value::MemberIterator& modelsCo
         status = validatePluginConfiguration(modelConfig.getPluginConfig(), modelConfig.getTargetDevice(), *ieCore.get());
         if (!status.ok()) {
             SPDLOG_LOGGER_ERROR(modelmanager_logger, "Plugin config contains unsupported keys");
-            return status;
+            pluginConfigStatus = status;
+            break;
         }
         modelConfig.setCacheDir(this->modelCacheDirectory);
 
@@ -732,11 +752,19 @@ Status ModelManager::loadModels(const rapidjson::Value::MemberIterator& modelsCo
             SPDLOG_LOGGER_WARN(modelmanager_logger, "Duplicated model names: {} defined in config file. Only first definition will be loaded.", modelName);
             continue;
         }
+        modelsInConfigFile.emplace(modelName);
+        modelConfigsToReload.emplace_back(std::move(modelConfig));
+    }
 
-        status = reloadModelWithVersions(modelConfig);
+    // Models are independent at this point - names are unique, so they can be loaded concurrently.
+    // Results are processed in config file order to keep gating behavior deterministic.
+    auto reloadStatuses = reloadModelsWithVersions(modelConfigsToReload);
+    for (size_t i = 0; i < modelConfigsToReload.size(); ++i) {
+        auto& modelConfig = modelConfigsToReload[i];
+        const auto modelName = modelConfig.getName();
+        const auto& status = reloadStatuses[i];
         IF_ERROR_NOT_OCCURRED_EARLIER_THEN_SET_FIRST_ERROR(status);
 
-        modelsInConfigFile.emplace(modelName);
         if (!status.ok()) {
             SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Cannot reload model: {} with versions due to error: {}", modelName, status.string());
         }
@@ -753,6 +781,9 @@ Status ModelManager::loadModels(const rapidjson::Value::MemberIterator& modelsCo
             newModelConfigs.emplace(modelName, std::move(modelConfig));
         }
     }
+    if (!pluginConfigStatus.ok()) {
+        return pluginConfigStatus;
+    }
     return firstErrorStatus;
 }
 #if (MEDIAPIPE_DISABLE == 0)
@@ -1013,13 +1044,16 @@ void ModelManager::retireModelsRemovedFromConfigFile(const std::set<std::string>
     }
 }
 
-Status ModelManager::updateConfigurationWithoutConfigFile() {
+Status ModelManager::updateConfigurationWithoutConfigFile(bool remoteModelsOnly) {
     std::lock_guard<std::recursive_mutex> loadingLock(configMtx);
     SPDLOG_LOGGER_TRACE(modelmanager_logger, "Checking if something changed with model versions");
     bool reloadNeeded = false;
     Status firstErrorStatus = StatusCode::OK;
     Status status;
     for (auto& [name, config] : servedModelConfigs) {
+        if (remoteModelsOnly && FileSystem::isLocalFilesystem(config.getBasePath())) {
+            continue;
+        }
         status = reloadModelWithVersions(config);
         if (!status.ok()) {
             IF_ERROR_NOT_OCCURRED_EARLIER_THEN_SET_FIRST_ERROR(status);
@@ -1067,8 +1101,86 @@ Status ModelManager::configFileReloadNeeded(bool& isNeeded) {
     return StatusCode::OK;
 }
 
+void ModelManager::refreshFileSystemWatches(FileSystemWatcher& fsWatcher, bool watchConfigFile, bool& remoteModelsServed, bool& allLocalPathsWatched) {
+    std::lock_guard<std::recursive_mutex> loadingLock(configMtx);
+    remoteModelsServed = false;
+    std::set<std::string> directories;
+    if (watchConfigFile) {
+        // Directory is watched instead of the file since editors usually replace the file on save
+        auto configDirectory = std::filesystem::path(configFilename).parent_path();
+        directories.emplace(configDirectory.empty() ? std::string(".") : configDirectory.string());
+    }
+    for (const auto& [name, config] : servedModelConfigs) {
+        const auto& basePath = config.getBasePath();
+        if (!FileSystem::isLocalFilesystem(basePath)) {
+            remoteModelsServed = true;
+            continue;
+        }
+        directories.emplace(basePath);
+        std::error_code ec;
+        for (auto it = std::filesystem::directory_iterator(basePath, ec); !ec && it != std::filesystem::directory_iterator(); it.increment(ec)) {
+            std::error_code dirEc;
+            if (it->is_directory(dirEc)) {
+                directories.emplace(it->path().string());
+            }
+        }
+    }
+    allLocalPathsWatched = fsWatcher.setWatchedDirectories(directories);
+}
+
+void ModelManager::watchFileSystemEvents(FileSystemWatcher& fsWatcher, std::future<void>& exitSignal, bool watchConfigFile) {
+    const auto basePollingInterval = std::chrono::milliseconds(this->watcherIntervalMillisec);
+    auto pollingInterval = basePollingInterval;
+    auto lastPoll = std::chrono::steady_clock::now();
+    bool remoteModelsServed = false;
+    bool allLocalPathsWatched = true;
+    refreshFileSystemWatches(fsWatcher, watchConfigFile, remoteModelsServed, allLocalPathsWatched);
+    while (exitSignal.wait_for(std::chrono::milliseconds(0)) == std::future_status::timeout) {
+        // Wait in short slices to react on exit signal
+        bool changed = fsWatcher.waitForChanges(std::chrono::milliseconds(FILESYSTEM_EVENTS_EXIT_CHECK_INTERVAL_MS));
+        auto now = std::chrono::steady_clock::now();
+        bool pollDue = (remoteModelsServed || !allLocalPathsWatched) && (now - lastPoll >= pollingInterval);
+        if (!changed && !pollDue) {
+            continue;
+        }
+        SPDLOG_LOGGER_TRACE(modelmanager_logger, "Models configuration and filesystem check cycle begin; filesystem changed: {}; polling: {}", changed, pollDue);
+        std::unique_lock<std::recursive_mutex> loadingLock(configMtx);
+        if (watchConfigFile) {
+            bool isNeeded;
+            configFileReloadNeeded(isNeeded);
+            if (isNeeded) {
+                loadConfig(configFilename);
+            }
+        }
+        // Local models have to be checked on filesystem event or when some of local paths could not be watched
+        auto status = updateConfigurationWithoutConfigFile(!changed && allLocalPathsWatched);
+        if (pollDue) {
+            // Back off polling of remote storage while nothing changes there
+            if (status == StatusCode::OK_RELOADED) {
+                pollingInterval = basePollingInterval;
+            } else {
+                pollingInterval = std::min(pollingInterval * 2, basePollingInterval * FILESYSTEM_POLL_MAX_BACKOFF_MULTIPLIER);
+            }
+            SPDLOG_LOGGER_TRACE(modelmanager_logger, "Next remote filesystem check in: {} ms", pollingInterval.count());
+        }
+        lastPoll = now;
+        refreshFileSystemWatches(fsWatcher, watchConfigFile, remoteModelsServed, allLocalPathsWatched);
+        loadingLock.unlock();
+        SPDLOG_LOGGER_TRACE(modelmanager_logger, "Models configuration and filesystem check cycle end");
+    }
+}
+
 void ModelManager::watcher(std::future<void> exitSignal, bool watchConfigFile) {
     SPDLOG_LOGGER_INFO(modelmanager_logger, "Started model manager thread");
+    if (this->filesystemEventsEnabled) {
+        FileSystemWatcher fsWatcher;
+        if (fsWatcher.isInitialized()) {
+            watchFileSystemEvents(fsWatcher, exitSignal, watchConfigFile);
+            SPDLOG_LOGGER_INFO(modelmanager_logger, "Stopped model manager thread");
+            return;
+        }
+        SPDLOG_LOGGER_WARN(modelmanager_logger, "Filesystem events are not available. Falling back to polling every {} ms", this->watcherIntervalMillisec);
+    }
     while (exitSignal.wait_for(std::chrono::milliseconds(this->watcherIntervalMillisec)) == std::future_status::timeout) {
         SPDLOG_LOGGER_TRACE(modelmanager_logger, "Models configuration and filesystem check cycle begin");
         std::unique_lock<std::recursive_mutex> loadingLock(configMtx);
@@ -1146,6 +1258,8 @@ void ModelManager::join() {
     if (watcherStarted) {
         exitTrigger.set_value();
     }
+    // Stops after compilation in progress is finished, versions still waiting in queue are skipped
+    precompiler.reset();
     if (cleanerStarted) {
         cleanerExitTrigger.set_value();
     }
@@ -1272,15 +1386,14 @@ std::shared_ptr<ovms::Model> ModelManager::getModelIfExistCreateElse(const std::
     auto modelIt = models.find(modelName);
     if (models.end() == modelIt) {
         models.insert({modelName, modelFactory(modelName, isStateful)});
+        publishModelsSnapshot();
     }
     return models[modelName];
 }
 
 std::shared_ptr<FileSystem> ModelManager::getFilesystem(const std::string& basePath) {
     if (basePath.rfind(FileSystem::S3_URL_PREFIX, 0) == 0) {
-        Aws::SDKOptions options;
-        Aws::InitAPI(options);
-        return std::make_shared<S3FileSystem>(options, basePath);
+        return std::make_shared<S3FileSystem>(basePath);
     }
     if (basePath.rfind(FileSystem::GCS_URL_PREFIX, 0) == 0) {
         return std::make_shared<ovms::GCSFileSystem>();
@@ -1393,6 +1506,94 @@ Status ModelManager::reloadModelVersions(std::shared_ptr<ovms::Model>& model, st
     return status;
 }
 
+static uint64_t estimateModelLoadingMemoryUsage(const ModelConfig& config) {
+    // Size of model files is known upfront only for local filesystem, remote models are downloaded during load
+    if (!FileSystem::isLocalFilesystem(config.getBasePath())) {
+        return 0;
+    }
+    uint64_t size = 0;
+    std::error_code ec;
+    for (auto it = std::filesystem::recursive_directory_iterator(config.getBasePath(), ec); !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec)) {
+        std::error_code sizeEc;
+        if (it->is_regular_file(sizeEc)) {
+            auto fileSize = it->file_size(sizeEc);
+            if (!sizeEc) {
+                size += fileSize;
+            }
+        }
+    }
+    return size;
+}
+
+namespace {
+class ModelLoadingMemoryBudget {
+    const uint64_t budgetBytes;
+    uint64_t usedBytes = 0;
+    std::mutex mtx;
+    std::condition_variable cv;
+
+public:
+    ModelLoadingMemoryBudget(uint64_t budgetBytes) :
+        budgetBytes(budgetBytes) {}
+
+    // Model which exceeds the budget on its own is admitted only when no other model is loading
+    void acquire(uint64_t bytes) {
+        if (budgetBytes == 0) {
+            return;
+        }
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait(lock, [this, bytes]() { return usedBytes == 0 || usedBytes + bytes <= budgetBytes; });
+        usedBytes += bytes;
+    }
+
+    void release(uint64_t bytes) {
+        if (budgetBytes == 0) {
+            return;
+        }
+        std::unique_lock<std::mutex> lock(mtx);
+        usedBytes -= bytes;
+        cv.notify_all();
+    }
+};
+}  // namespace
+
+std::vector<Status> ModelManager::reloadModelsWithVersions(std::vector<ModelConfig>& configs) {
+    std::vector<Status> statuses(configs.size());
+    const size_t threadsCount = std::min<size_t>(this->modelLoadingThreads, configs.size());
+    if (threadsCount <= 1) {
+        for (size_t i = 0; i < configs.size(); ++i) {
+            statuses[i] = reloadModelWithVersions(configs[i]);
+        }
+        return statuses;
+    }
+    SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Loading {} models using {} threads", configs.size(), threadsCount);
+    ModelLoadingMemoryBudget memoryBudget(this->modelLoadingMemoryBudgetBytes);
+    std::atomic<size_t> nextConfigIndex{0};
+    auto loader = [this, &configs, &statuses, &memoryBudget, &nextConfigIndex]() {
+        size_t i;
+        while ((i = nextConfigIndex++) < configs.size()) {
+            const uint64_t estimatedBytes = estimateModelLoadingMemoryUsage(configs[i]);
+            memoryBudget.acquire(estimatedBytes);
+            try {
+                statuses[i] = reloadModelWithVersions(configs[i]);
+            } catch (std::exception& e) {
+                SPDLOG_LOGGER_ERROR(modelmanager_logger, "Exception occurred while loading model: {}; {}", configs[i].getName(), e.what());
+                statuses[i] = StatusCode::UNKNOWN_ERROR;
+            }
+            memoryBudget.release(estimatedBytes);
+        }
+    };
+    std::vector<std::thread> loaders;
+    loaders.reserve(threadsCount);
+    for (size_t i = 0; i < threadsCount; ++i) {
+        loaders.emplace_back(loader);
+    }
+    for (auto& t : loaders) {
+        t.join();
+    }
+    return statuses;
+}
+
 Status ModelManager::reloadModelWithVersions(ModelConfig& config) {
     SPDLOG_LOGGER_TRACE(modelmanager_logger, "Started applying config changes to model: {}", config.getName());
 
@@ -1484,6 +1685,10 @@ Status ModelManager::reloadModelWithVersions(ModelConfig& config) {
             blocking_status = status;
         }
     }
+    // Admission control limits are not part of reload check, apply them to versions kept loaded
+    for (const auto& [version, modelInstance] : model->getModelVersions()) {
+        modelInstance->setAdmissionLimits(config);
+    }
 
     for (const auto version : *versionsFailed) {
         SPDLOG_LOGGER_TRACE(modelmanager_logger, "Removing available version {} due to load failure.", version);
@@ -1517,6 +1722,10 @@ Status ModelManager::reloadModelWithVersions(ModelConfig& config) {
         }
     }
 
+    if (precompiler) {
+        schedulePrecompilation(config, availableVersions, requestedVersions);
+    }
+
     if (blocking_status.ok() && reloadNeeded) {
         return StatusCode::OK_RELOADED;
     }
@@ -1524,10 +1733,27 @@ Status ModelManager::reloadModelWithVersions(ModelConfig& config) {
     return blocking_status;
 }
 
+void ModelManager::schedulePrecompilation(const ModelConfig& config, const model_versions_t& availableVersions, const model_versions_t& servedVersions) {
+    if (!ModelPrecompiler::isPrecompilationPossible(config)) {
+        return;
+    }
+    for (const auto version : ModelPrecompiler::getStagedVersions(availableVersions, servedVersions)) {
+        ModelConfig stagedVersionConfig = config;
+        stagedVersionConfig.setVersion(version);
+        stagedVersionConfig.setLocalPath(config.getBasePath());
+        precompiler->schedule(stagedVersionConfig);
+    }
+}
+
+void ModelManager::publishModelsSnapshot() {
+    modelsSnapshot.publish(std::make_unique<const std::map<std::string, std::shared_ptr<Model>>>(models));
+}
+
 const std::shared_ptr<Model> ModelManager::findModelByName(const std::string& name) const {
-    std::shared_lock lock(modelsMtx);
-    auto it = models.find(name);
-    return it != models.end() ? it->second : nullptr;
+    RcuReadGuard guard;
+    const auto& modelsMap = modelsSnapshot.read(guard);
+    auto it = modelsMap.find(name);
+    return it != modelsMap.end() ? it->second : nullptr;
 }
 
 Status ModelManager::getModelInstance(const std::string& modelName,
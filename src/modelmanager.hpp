@@ -38,11 +38,13 @@
 #endif
 #include "metric_config.hpp"
 #include "model.hpp"
+#include "rcu.hpp"
 #include "status.hpp"
 
 namespace ovms {
 
 const uint32_t DEFAULT_WAIT_FOR_MODEL_LOADED_TIMEOUT_MS = 10000;
+const uint32_t FILESYSTEM_POLL_MAX_BACKOFF_MULTIPLIER = 16;
 extern const std::string DEFAULT_MODEL_CACHE_DIRECTORY;
 
 class Config;
@@ -52,6 +54,8 @@ class CustomNodeLibraryManager;
 class MetricRegistry;
 class ModelConfig;
 class FileSystem;
+class FileSystemWatcher;
+class ModelPrecompiler;
 class MediapipeGraphExecutor;
 struct FunctorSequenceCleaner;
 struct FunctorResourcesCleaner;
@@ -80,6 +84,16 @@ protected:
     std::map<std::string, std::shared_ptr<Model>> models;
     std::unique_ptr<ov::Core> ieCore;
 
+    /**
+     * @brief Copy of models used by request threads for lookup without taking modelsMtx
+     */
+    RcuSnapshot<std::map<std::string, std::shared_ptr<Model>>> modelsSnapshot;
+
+    /**
+     * @brief Publishes current models to request threads. Needs to be called with modelsMtx locked after each change of models.
+     */
+    void publishModelsSnapshot();
+
     PipelineFactory pipelineFactory;
 #if (MEDIAPIPE_DISABLE == 0)
     MediapipeFactory mediapipeFactory;
@@ -123,6 +137,19 @@ private:
      */
     void watcher(std::future<void> exitSignal, bool watchConfigFile);
 
+    /**
+     * @brief Watcher loop reacting to filesystem events on local paths and polling remote paths with backoff
+     */
+    void watchFileSystemEvents(FileSystemWatcher& fsWatcher, std::future<void>& exitSignal, bool watchConfigFile);
+
+    /**
+     * @brief Updates set of directories watched for changes: config file directory, local model base paths and their version directories
+     *
+     * @param remoteModelsServed set to true if any of served models is stored outside of local filesystem
+     * @param allLocalPathsWatched set to false if any of local directories could not be watched
+     */
+    void refreshFileSystemWatches(FileSystemWatcher& fsWatcher, bool watchConfigFile, bool& remoteModelsServed, bool& allLocalPathsWatched);
+
     /**
      * @brief Cleaner thread for sequence and resources cleanup
      */
@@ -193,6 +220,31 @@ protected:
     uint watcherIntervalMillisec = 1000;
     const int WRONG_CONFIG_FILE_RETRY_DELAY_MS = 10;
 
+    /**
+     * Detect changes of config and local models using filesystem events instead of polling
+     */
+    bool filesystemEventsEnabled = false;
+
+    /**
+     * Number of models loaded concurrently
+     */
+    uint32_t modelLoadingThreads = 1;
+
+    /**
+     * Upper limit for total size of model files loaded concurrently (in bytes). Zero means no limit
+     */
+    uint64_t modelLoadingMemoryBudgetBytes = 0;
+
+    /**
+     * Compiles staged model versions in background to populate model cache. Created when enabled
+     */
+    std::unique_ptr<ModelPrecompiler> precompiler;
+
+    /**
+     * @brief Schedules background compilation of versions newer than served ones
+     */
+    void schedulePrecompilation(const ModelConfig& config, const model_versions_t& availableVersions, const model_versions_t& servedVersions);
+
 private:
     /**
      * Time interval between two consecutive sequence cleanup scans (in minutes)
@@ -418,6 +470,15 @@ public:
      */
     Status reloadModelWithVersions(ModelConfig& config);
 
+    /**
+     * @brief Reloads models using up to modelLoadingThreads concurrent loaders.
+     * Configs have to refer to distinct models.
+     *
+     * @param configs model configurations
+     * @return statuses of reloadModelWithVersions in order of provided configs
+     */
+    std::vector<Status> reloadModelsWithVersions(std::vector<ModelConfig>& configs);
+
     /**
      * @brief Starts model manager using ovms::Config
      * 
@@ -494,8 +555,10 @@ public:
 
     /**
      * @brief Updates OVMS configuration with cached configuration file. Will check for newly added model versions
+     *
+     * @param remoteModelsOnly check only models stored outside of local filesystem
      */
-    Status updateConfigurationWithoutConfigFile();
+    Status updateConfigurationWithoutConfigFile(bool remoteModelsOnly = false);
 
     /**
      * @brief Cleaner thread procedure to cleanup resources that are not used
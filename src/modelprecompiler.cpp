@@ -0,0 +1,152 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "modelprecompiler.hpp"
+
+#include <algorithm>
+#include <exception>
+
+#include "compilationtimerstage.hpp"
+#include "filesystem.hpp"
+#include "logging.hpp"
+#include "modelinstance.hpp"
+#include "status.hpp"
+#include "timer.hpp"
+
+namespace ovms {
+
+ModelPrecompiler::ModelPrecompiler(ov::Core& ieCore) :
+    ieCore(ieCore) {
+    worker = std::thread(&ModelPrecompiler::run, this);
+}
+
+ModelPrecompiler::~ModelPrecompiler() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        exit = true;
+        queue.clear();
+    }
+    cv.notify_all();
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
+
+bool ModelPrecompiler::isPrecompilationPossible(const ModelConfig& config) {
+    if (config.getCacheDir().empty()) {
+        return false;
+    }
+    // Stateful models are transformed differently when served, custom loaders do not support model cache
+    if (config.isStateful() || config.isCustomLoaderRequiredToLoadModel()) {
+        return false;
+    }
+    if (!config.isAllowCacheSetToTrue() && ModelInstance::isCachingDisabledByDefault(config)) {
+        return false;
+    }
+    // Versions which are not served are not downloaded from remote storage
+    return FileSystem::isLocalFilesystem(config.getBasePath());
+}
+
+model_versions_t ModelPrecompiler::getStagedVersions(const model_versions_t& availableVersions, const model_versions_t& servedVersions) {
+    model_versions_t staged;
+    if (servedVersions.empty()) {
+        return staged;
+    }
+    const model_version_t newestServedVersion = *std::max_element(servedVersions.begin(), servedVersions.end());
+    std::copy_if(availableVersions.begin(), availableVersions.end(), std::back_inserter(staged),
+        [newestServedVersion](model_version_t version) { return version > newestServedVersion; });
+    return staged;
+}
+
+bool ModelPrecompiler::schedule(const ModelConfig& config) {
+    if (!isPrecompilationPossible(config)) {
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        auto key = std::make_pair(config.getName(), config.getVersion());
+        auto it = scheduled.find(key);
+        if (it != scheduled.end() && !it->second.isReloadRequired(config)) {
+            return false;
+        }
+        scheduled.insert_or_assign(key, config);
+        queue.push_back(config);
+    }
+    SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Scheduled precompilation of model: {} version: {}", config.getName(), config.getVersion());
+    cv.notify_all();
+    return true;
+}
+
+bool ModelPrecompiler::waitUntilIdle(std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(mtx);
+    return cv.wait_for(lock, timeout, [this]() { return queue.empty() && !busy; });
+}
+
+uint64_t ModelPrecompiler::getPrecompiledCount() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return precompiledCount;
+}
+
+Status ModelPrecompiler::precompile(const ModelConfig& config) {
+    Timer<COMPILATION_TIMER_END> timer;
+    timer.start(COMPILE);
+    // Model is transformed by instance the same way as when served, so that cache entry matches.
+    // Only compilation into cache directory is done, instance is not loaded and has no inference requests.
+    ModelInstance instance(config.getName(), config.getVersion(), ieCore);
+    bool loadedFromCache = false;
+    auto status = instance.compileIntoCache(config, loadedFromCache);
+    timer.stop(COMPILE);
+    if (!status.ok()) {
+        SPDLOG_LOGGER_WARN(modelmanager_logger, "Precompilation of model: {} version: {} failed: {}", config.getName(), config.getVersion(), status.string());
+        return status;
+    }
+    SPDLOG_LOGGER_INFO(modelmanager_logger, "Precompiled model: {} version: {} in {} ms; already in cache: {}",
+        config.getName(), config.getVersion(), timer.elapsed<std::chrono::microseconds>(COMPILE) / 1000, loadedFromCache);
+    return status;
+}
+
+void ModelPrecompiler::run() {
+    SPDLOG_LOGGER_INFO(modelmanager_logger, "Started model precompilation thread");
+    while (true) {
+        ModelConfig config;
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            cv.wait(lock, [this]() { return exit || !queue.empty(); });
+            if (exit) {
+                break;
+            }
+            config = queue.front();
+            queue.pop_front();
+            busy = true;
+        }
+        Status status;
+        try {
+            status = precompile(config);
+        } catch (std::exception& e) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Exception occurred during precompilation of model: {} version: {}; {}", config.getName(), config.getVersion(), e.what());
+            status = StatusCode::INTERNAL_ERROR;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            busy = false;
+            if (status.ok()) {
+                precompiledCount++;
+            }
+        }
+        cv.notify_all();
+    }
+    SPDLOG_LOGGER_INFO(modelmanager_logger, "Stopped model precompilation thread");
+}
+}  // namespace ovms
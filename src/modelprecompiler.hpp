@@ -0,0 +1,95 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "modelconfig.hpp"
+#include "modelversion.hpp"
+
+namespace ov {
+class Core;
+}  // namespace ov
+
+namespace ovms {
+class Status;
+
+/**
+ * @brief Compiles model versions which are present in model repository but not served yet in the background,
+ * so that model cache (cache_dir) is populated before the versions are requested by version policy change.
+ * Serving such version later imports the compiled model from cache instead of compiling it.
+ */
+class ModelPrecompiler {
+    ov::Core& ieCore;
+
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::deque<ModelConfig> queue;
+    /**
+     * @brief Configs of versions already precompiled or waiting in queue
+     */
+    std::map<std::pair<std::string, model_version_t>, ModelConfig> scheduled;
+    bool exit = false;
+    bool busy = false;
+    uint64_t precompiledCount = 0;
+    std::thread worker;
+
+    void run();
+    Status precompile(const ModelConfig& config);
+
+public:
+    ModelPrecompiler(ov::Core& ieCore);
+    ~ModelPrecompiler();
+    ModelPrecompiler(const ModelPrecompiler&) = delete;
+    ModelPrecompiler& operator=(const ModelPrecompiler&) = delete;
+
+    /**
+     * @brief Checks if compiled model for given config can be stored in model cache
+     */
+    static bool isPrecompilationPossible(const ModelConfig& config);
+
+    /**
+     * @brief Selects versions newer than all served versions
+     *
+     * @param availableVersions versions present in model repository
+     * @param servedVersions versions selected by version policy
+     */
+    static model_versions_t getStagedVersions(const model_versions_t& availableVersions, const model_versions_t& servedVersions);
+
+    /**
+     * @brief Schedules compilation of model version from config. Versions already compiled with the same config are skipped.
+     *
+     * @return true if compilation was scheduled
+     */
+    bool schedule(const ModelConfig& config);
+
+    /**
+     * @brief Waits until all scheduled compilations are finished
+     *
+     * @return false on timeout
+     */
+    bool waitUntilIdle(std::chrono::milliseconds timeout);
+
+    uint64_t getPrecompiledCount();
+};
+}  // namespace ovms
@@ -103,7 +103,7 @@ static void insertSupportedKeys(std::set<std::string>& aggregatedPluginSupported
     }
 }
 
-Status validatePluginConfiguration(const plugin_config_t& pluginConfig, const std::string& targetDevice, const ov::Core& ieCore) {
+static std::set<std::string> getPluginSupportedConfigKeys(const std::string& targetDevice, const ov::Core& ieCore) {
     std::set<std::string> pluginSupportedConfigKeys;
     std::string pluginDelimiter = ":";
     auto pluginDelimeterPos = targetDevice.find(pluginDelimiter);
@@ -120,7 +120,11 @@ Status validatePluginConfiguration(const plugin_config_t& pluginConfig, const st
     } else {
         insertSupportedKeys(pluginSupportedConfigKeys, targetDevice, ieCore);
     }
+    return pluginSupportedConfigKeys;
+}
 
+Status validatePluginConfiguration(const plugin_config_t& pluginConfig, const std::string& targetDevice, const ov::Core& ieCore) {
+    std::set<std::string> pluginSupportedConfigKeys = getPluginSupportedConfigKeys(targetDevice, ieCore);
     for (auto& config : pluginConfig) {
         if (std::find(pluginSupportedConfigKeys.begin(), pluginSupportedConfigKeys.end(), config.first) == pluginSupportedConfigKeys.end()) {
             SPDLOG_LOGGER_ERROR(modelmanager_logger, "Plugin config key: {} not found in supported config keys for device: {}.", config.first, targetDevice);
@@ -134,4 +138,20 @@ Status validatePluginConfiguration(const plugin_config_t& pluginConfig, const st
 
     return StatusCode::OK;
 }
+
+bool isPluginPropertySupported(const std::string& property, const std::string& targetDevice, const ov::Core& ieCore) {
+    return getPluginSupportedConfigKeys(targetDevice, ieCore).count(property) > 0;
+}
+
+ov::hint::Priority toOVPriority(RequestPriority priority) {
+    switch (priority) {
+    case RequestPriority::LOW:
+        return ov::hint::Priority::LOW;
+    case RequestPriority::HIGH:
+        return ov::hint::Priority::HIGH;
+    case RequestPriority::MEDIUM:
+    default:
+        return ov::hint::Priority::MEDIUM;
+    }
+}
 }  // namespace ovms
@@ -27,6 +27,7 @@
 
 #include "logging.hpp"
 #include "modelconfig.hpp"
+#include "requestpriority.hpp"
 #include "stringutils.hpp"
 
 namespace ovms {
@@ -44,6 +45,10 @@ std::optional<ov::Layout> getLayoutFromRTMap(const ov::RTMap& rtMap);
 
 Status validatePluginConfiguration(const plugin_config_t& pluginConfig, const std::string& targetDevice, const ov::Core& ieCore);
 
+bool isPluginPropertySupported(const std::string& property, const std::string& targetDevice, const ov::Core& ieCore);
+
+ov::hint::Priority toOVPriority(RequestPriority priority);
+
 // Logging
 // #1 model/global plugin  CompiledMode:DUMMY / Global OpenVINO plugin:CPU
 // #2 version/_
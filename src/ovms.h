@@ -277,6 +277,16 @@ OVMS_Status* OVMS_ServerSettingsSetGrpcMemoryQuota(OVMS_ServerSettings* settings
 OVMS_Status* OVMS_ServerSettingsSetFileSystemPollWaitSeconds(OVMS_ServerSettings* settings,
     uint32_t seconds);
 
+// Set filesystem events usage for changes detection server setting.
+// Equivalent of starting server with
+// --file_system_events_enable.
+//
+// \param settings The server settings object to be set
+// \param enabled The value to be set
+// \return OVMS_Status object in case of failure
+OVMS_Status* OVMS_ServerSettingsSetFileSystemEventsEnabled(OVMS_ServerSettings* settings,
+    bool enabled);
+
 // Set sequence cleaner interval server setting.
 // Equivalent of starting server with
 // --sequence_cleaner_poll_wait_minutes.
@@ -297,6 +307,26 @@ OVMS_Status* OVMS_ServerSettingsSetSequenceCleanerPollWaitMinutes(OVMS_ServerSet
 OVMS_Status* OVMS_ServerSettingsSetCustomNodeResourcesCleanerIntervalSeconds(OVMS_ServerSettings* settings,
     uint32_t seconds);
 
+// Set number of models loaded concurrently server setting.
+// Equivalent of starting server with
+// --model_loading_threads.
+//
+// \param settings The server settings object to be set
+// \param threads The value to be set
+// \return OVMS_Status object in case of failure
+OVMS_Status* OVMS_ServerSettingsSetModelLoadingThreads(OVMS_ServerSettings* settings,
+    uint32_t threads);
+
+// Set limit for total size of model files loaded concurrently server setting.
+// Equivalent of starting server with
+// --model_loading_memory_budget_mb.
+//
+// \param settings The server settings object to be set
+// \param megabytes The value to be set
+// \return OVMS_Status object in case of failure
+OVMS_Status* OVMS_ServerSettingsSetModelLoadingMemoryBudgetMB(OVMS_ServerSettings* settings,
+    uint32_t megabytes);
+
 // Set cpu extension path server setting. Equivalent of starting server with
 // --cpu_extension.
 //
@@ -315,6 +345,16 @@ OVMS_Status* OVMS_ServerSettingsSetCpuExtensionPath(OVMS_ServerSettings* setting
 OVMS_Status* OVMS_ServerSettingsSetCacheDir(OVMS_ServerSettings* settings,
     const char* cache_dir);
 
+// Set background compilation of staged model versions server setting.
+// Equivalent of starting server with
+// --precompile_staged_versions.
+//
+// \param settings The server settings object to be set
+// \param enabled The value to be set
+// \return OVMS_Status object in case of failure
+OVMS_Status* OVMS_ServerSettingsSetPrecompileStagedVersions(OVMS_ServerSettings* settings,
+    bool enabled);
+
 // Set log level server setting. Equivalent of starting server with
 // --log_level.
 //
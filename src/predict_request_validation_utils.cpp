@@ -101,6 +101,7 @@ class RequestValidator {
     const std::set<std::string>& optionalAllowedInputNames;
     const Mode batchingMode;
     const shapes_info_map_t& shapeInfo;
+    const shape_buckets_map_t& shapeBuckets;
 
     InputIterator it;
 
@@ -115,14 +116,15 @@ public:
     RequestValidator(
         const RequestType& request, const tensor_map_t& inputsInfo,
         const std::string& servableName, const model_version_t servableVersion, const std::set<std::string>& optionalAllowedInputNames,
-        const Mode batchingMode, const shapes_info_map_t& shapeInfo) :
+        const Mode batchingMode, const shapes_info_map_t& shapeInfo, const shape_buckets_map_t& shapeBuckets) :
         request(request),
         inputsInfo(inputsInfo),
         servableName(servableName),
         servableVersion(servableVersion),
         optionalAllowedInputNames(optionalAllowedInputNames),
         batchingMode(batchingMode),
-        shapeInfo(shapeInfo) {}
+        shapeInfo(shapeInfo),
+        shapeBuckets(shapeBuckets) {}
 
     Status validateInferenceTensorBufferType(const InferenceTensor& it) const;
     Status validateNumberOfInputs() const;
@@ -505,26 +507,36 @@ Status RequestValidator<RequestType, InputTensorType, IteratorType, ShapeType>::
     const auto& shape = inputInfo.getShape();
     bool mismatch = false;
     RequestShapeInfo<InputTensorType, ShapeType> rsi(proto);
+    // Bucketed dimension accepts any size which is padded to one of the buckets
+    auto bucketsIt = shapeBuckets.find(getCurrentlyValidatedInputName());
+    const ShapeBuckets* buckets = bucketsIt != shapeBuckets.end() ? &bucketsIt->second : nullptr;
+    auto dimMatches = [&shape, &rsi, buckets](size_t i) {
+        auto dim = static_cast<dimension_value_t>(rsi.getDim(i));
+        if (buckets != nullptr && buckets->dimension == i) {
+            return dim > 0 && buckets->getBucket(dim).has_value();
+        }
+        return shape[i].match(dim);
+    };
     if (batchingMode == AUTO) {  // Skip batch dimension
         if (!batchSizeIndex.has_value()) {
             SPDLOG_ERROR("Batching AUTO enabled but batch size is missing");
             return StatusCode::INTERNAL_ERROR;
         }
         for (size_t i = 0; i < batchSizeIndex.value(); i++) {
-            if (!shape[i].match(static_cast<dimension_value_t>(rsi.getDim(i)))) {
+            if (!dimMatches(i)) {
                 mismatch = true;
                 break;
             }
         }
         for (size_t i = batchSizeIndex.value() + 1; i < rsi.getShapeSize(); i++) {
-            if (!shape[i].match(static_cast<dimension_value_t>(rsi.getDim(i)))) {
+            if (!dimMatches(i)) {
                 mismatch = true;
                 break;
             }
         }
     } else {  // Do not skip batch dimension
         for (size_t i = 0; i < rsi.getShapeSize(); i++) {
-            if (!shape[i].match(static_cast<dimension_value_t>(rsi.getDim(i)))) {
+            if (!dimMatches(i)) {
                 mismatch = true;
                 break;
             }
@@ -541,6 +553,9 @@ Status RequestValidator<RequestType, InputTensorType, IteratorType, ShapeType>::
         ss << "Expected: " << inputInfo.getShape().toString()
            << "; Actual: " << tensorShapeToString(rsi.getShape())
            << "; input name: " << getCurrentlyValidatedInputName();
+        if (buckets != nullptr) {
+            ss << "; dimension: " << buckets->dimension << " accepts sizes up to: " << buckets->getMaxSize();
+        }
         const std::string details = ss.str();
         SPDLOG_DEBUG("[servable name: {} version: {}] Invalid shape - {}", servableName, servableVersion, details);
         return Status(StatusCode::INVALID_SHAPE, details);
@@ -1019,21 +1034,21 @@ Status RequestValidator<RequestType, InputTensorType, IteratorType, ShapeType>::
 }
 
 template <>
-Status validate(const TFSRequestType& request, const tensor_map_t& inputsInfo, const std::string& servableName, const model_version_t servableVersion, const std::set<std::string>& optionalAllowedInputNames, const Mode batchingMode, const shapes_info_map_t& shapeInfo) {
+Status validate(const TFSRequestType& request, const tensor_map_t& inputsInfo, const std::string& servableName, const model_version_t servableVersion, const std::set<std::string>& optionalAllowedInputNames, const Mode batchingMode, const shapes_info_map_t& shapeInfo, const shape_buckets_map_t& shapeBuckets) {
     OVMS_PROFILE_FUNCTION();
-    return RequestValidator<TFSRequestType, TFSInputTensorType, TFSInputTensorIteratorType, TFSShapeType>(request, inputsInfo, servableName, servableVersion, optionalAllowedInputNames, batchingMode, shapeInfo).validate();
+    return RequestValidator<TFSRequestType, TFSInputTensorType, TFSInputTensorIteratorType, TFSShapeType>(request, inputsInfo, servableName, servableVersion, optionalAllowedInputNames, batchingMode, shapeInfo, shapeBuckets).validate();
 }
 
 template <>
-Status validate(const KFSRequest& request, const tensor_map_t& inputsInfo, const std::string& servableName, const model_version_t servableVersion, const std::set<std::string>& optionalAllowedInputNames, const Mode batchingMode, const shapes_info_map_t& shapeInfo) {
+Status validate(const KFSRequest& request, const tensor_map_t& inputsInfo, const std::string& servableName, const model_version_t servableVersion, const std::set<std::string>& optionalAllowedInputNames, const Mode batchingMode, const shapes_info_map_t& shapeInfo, const shape_buckets_map_t& shapeBuckets) {
     OVMS_PROFILE_FUNCTION();
-    return RequestValidator<KFSRequest, KFSTensorInputProto, KFSInputTensorIteratorType, KFSShapeType>(request, inputsInfo, servableName, servableVersion, optionalAllowedInputNames, batchingMode, shapeInfo).validate();
+    return RequestValidator<KFSRequest, KFSTensorInputProto, KFSInputTensorIteratorType, KFSShapeType>(request, inputsInfo, servableName, servableVersion, optionalAllowedInputNames, batchingMode, shapeInfo, shapeBuckets).validate();
 }
 
 template <>
-Status validate(const InferenceRequest& request, const tensor_map_t& inputsInfo, const std::string& servableName, const model_version_t servableVersion, const std::set<std::string>& optionalAllowedInputNames, const Mode batchingMode, const shapes_info_map_t& shapeInfo) {
+Status validate(const InferenceRequest& request, const tensor_map_t& inputsInfo, const std::string& servableName, const model_version_t servableVersion, const std::set<std::string>& optionalAllowedInputNames, const Mode batchingMode, const shapes_info_map_t& shapeInfo, const shape_buckets_map_t& shapeBuckets) {
     OVMS_PROFILE_FUNCTION();
-    return RequestValidator<InferenceRequest, InferenceTensor, const InferenceTensor*, signed_shape_t>(request, inputsInfo, servableName, servableVersion, optionalAllowedInputNames, batchingMode, shapeInfo).validate();
+    return RequestValidator<InferenceRequest, InferenceTensor, const InferenceTensor*, signed_shape_t>(request, inputsInfo, servableName, servableVersion, optionalAllowedInputNames, batchingMode, shapeInfo, shapeBuckets).validate();
 }
 }  // namespace request_validation_utils
 }  // namespace ovms
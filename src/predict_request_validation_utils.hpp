@@ -24,6 +24,7 @@
 
 #include "modelversion.hpp"
 #include "shape.hpp"
+#include "shapebucketing.hpp"
 #include "tensorinfo.hpp"
 
 namespace ovms {
@@ -38,7 +39,8 @@ Status validate(
     const model_version_t servableVersion,
     const std::set<std::string>& optionalAllowedInputNames = {},
     const Mode batchingMode = Mode::FIXED,
-    const shapes_info_map_t& shapeInfo = shapes_info_map_t());
+    const shapes_info_map_t& shapeInfo = shapes_info_map_t(),
+    const shape_buckets_map_t& shapeBuckets = shape_buckets_map_t());
 
 // This function is expected to be called with already validated shape that does not contain negative dimensions
 template <typename T>
@@ -88,6 +88,7 @@ grpc::Status ovms::PredictionServiceImpl::Predict(
     ServerContext* context,
     const PredictRequest* request,
     PredictResponse* response) {
+    TraceRequestGuard traceRequestGuard;
     OVMS_PROFILE_FUNCTION();
     Timer<TIMER_END> timer;
     timer.start(TOTAL);
@@ -118,12 +119,13 @@ grpc::Status ovms::PredictionServiceImpl::Predict(
     ExecutionContext executionContext{
         ExecutionContext::Interface::GRPC,
         ExecutionContext::Method::Predict};
+    propagateDeadlineAndCancellation(context, executionContext);
 
     if (pipelinePtr) {
         status = pipelinePtr->execute(executionContext);
         INCREMENT_IF_ENABLED(pipelinePtr->getMetricReporter().getInferRequestMetric(executionContext, status.ok()));
     } else {
-        status = modelInstance->infer(request, response, modelInstanceUnloadGuard);
+        status = modelInstance->infer(request, response, modelInstanceUnloadGuard, &executionContext);
         INCREMENT_IF_ENABLED(modelInstance->getMetricReporter().getInferRequestMetric(executionContext, status.ok()));
     }
 
@@ -21,10 +21,12 @@
 #include "capi_frontend/inferencetensor.hpp"
 #include "deserialization.hpp"
 #include "executingstreamidguard.hpp"
+#include "logging.hpp"
 #include "modelinstance.hpp"
 #include "modelinstanceunloadguard.hpp"
 #include "modelmanager.hpp"
 #include "serialization.hpp"
+#include "status.hpp"
 #include "stringutils.hpp"
 #include "timer.hpp"
 
@@ -129,4 +131,32 @@ bool useSharedOutputContentFn(const InferenceRequest* request) {
     return false;
 }
 
+Status getRequestPriority(const ::KFSRequest* request, RequestPriority& priority) {
+    auto it = request->parameters().find(PRIORITY_PARAMETER_NAME);
+    if (it == request->parameters().end()) {
+        return StatusCode::OK;
+    }
+    if (it->second.parameter_choice_case() != inference::InferParameter::ParameterChoiceCase::kStringParam) {
+        SPDLOG_DEBUG("Request priority parameter for model: {} should be a string", request->model_name());
+        return StatusCode::INVALID_PRIORITY;
+    }
+    auto requestedPriority = requestPriorityFromString(it->second.string_param());
+    if (!requestedPriority.has_value()) {
+        SPDLOG_DEBUG("Invalid request priority: {} for model: {}", it->second.string_param(), request->model_name());
+        return StatusCode::INVALID_PRIORITY;
+    }
+    priority = requestedPriority.value();
+    return StatusCode::OK;
+}
+
+Status getRequestPriority(const tensorflow::serving::PredictRequest* request, RequestPriority& priority) {
+    // does not apply for TFS frontend
+    return StatusCode::OK;
+}
+
+Status getRequestPriority(const InferenceRequest* request, RequestPriority& priority) {
+    // does not apply for C-API frontend
+    return StatusCode::OK;
+}
+
 }  // namespace ovms
@@ -24,10 +24,12 @@
 #include "tensorflow_serving/apis/prediction_service.grpc.pb.h"
 #pragma GCC diagnostic pop
 #include "kfs_frontend/kfs_grpc_inference_service.hpp"
+#include "requestpriority.hpp"
 #include "shape.hpp"
 
 namespace ovms {
 class InferenceRequest;
+class Status;
 
 std::optional<Dimension> getRequestBatchSize(const ::KFSRequest* request, const size_t batchSizeIndex);
 std::map<std::string, shape_t> getRequestShapes(const ::KFSRequest* request);
@@ -46,4 +48,12 @@ std::map<std::string, shape_t> getRequestShapes(const InferenceRequest* request)
 bool useSharedOutputContentFn(const tensorflow::serving::PredictRequest* request);
 bool useSharedOutputContentFn(const ::KFSRequest* request);
 bool useSharedOutputContentFn(const InferenceRequest* request);
+
+/**
+ * Overrides priority with the one requested in KFS request parameters.
+ * Other frontends do not pass priority and leave it unchanged.
+ */
+Status getRequestPriority(const ::KFSRequest* request, RequestPriority& priority);
+Status getRequestPriority(const tensorflow::serving::PredictRequest* request, RequestPriority& priority);
+Status getRequestPriority(const InferenceRequest* request, RequestPriority& priority);
 }  // namespace ovms
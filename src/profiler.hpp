@@ -18,18 +18,40 @@
 #include <string>
 
 #include "minitrace.h"  // NOLINT
+#include "tracer.hpp"
 
-#define OVMS_PROFILE_SCOPE(name) MTR_SCOPE("OVMS", name);
-#define OVMS_PROFILE_SCOPE_S(name, vname, cstr) MTR_SCOPE_S("OVMS", name, vname, cstr);
+#define OVMS_TRACE_CONCAT_IMPL(a, b) a##b
+#define OVMS_TRACE_CONCAT(a, b) OVMS_TRACE_CONCAT_IMPL(a, b)
+#define OVMS_TRACE_SCOPE(name) ::ovms::TraceScope OVMS_TRACE_CONCAT(____ovms_trace_scope, __LINE__)(name);
+
+// Events are recorded by minitrace when built with MTR_ENABLED and by ovms::Tracer for sampled requests
+#define OVMS_PROFILE_SCOPE(name)    \
+    MTR_SCOPE("OVMS", name);        \
+    OVMS_TRACE_SCOPE(name)
+#define OVMS_PROFILE_SCOPE_S(name, vname, cstr) \
+    MTR_SCOPE_S("OVMS", name, vname, cstr);     \
+    OVMS_TRACE_SCOPE(name)
 #define OVMS_PROFILE_FUNCTION() OVMS_PROFILE_SCOPE(__PRETTY_FUNCTION__)
 
-#define OVMS_PROFILE_SYNC_BEGIN(name) MTR_BEGIN("OVMS", name);
-#define OVMS_PROFILE_SYNC_END(name) MTR_END("OVMS", name);
-#define OVMS_PROFILE_SYNC_BEGIN_S(name, vname, cstr) MTR_BEGIN_S("OVMS", name, vname, cstr);
-#define OVMS_PROFILE_SYNC_END_S(name, vname, cstr) MTR_END_S("OVMS", name, vname, cstr);
+#define OVMS_PROFILE_SYNC_BEGIN(name) \
+    MTR_BEGIN("OVMS", name);          \
+    ::ovms::traceEvent('B', name);
+#define OVMS_PROFILE_SYNC_END(name) \
+    MTR_END("OVMS", name);          \
+    ::ovms::traceEvent('E', name);
+#define OVMS_PROFILE_SYNC_BEGIN_S(name, vname, cstr) \
+    MTR_BEGIN_S("OVMS", name, vname, cstr);          \
+    ::ovms::traceEvent('B', name);
+#define OVMS_PROFILE_SYNC_END_S(name, vname, cstr) \
+    MTR_END_S("OVMS", name, vname, cstr);          \
+    ::ovms::traceEvent('E', name);
 
-#define OVMS_PROFILE_ASYNC_BEGIN(name, id) MTR_START("OVMS", name, id);
-#define OVMS_PROFILE_ASYNC_END(name, id) MTR_FINISH("OVMS", name, id);
+#define OVMS_PROFILE_ASYNC_BEGIN(name, id) \
+    MTR_START("OVMS", name, id);           \
+    ::ovms::traceEvent('b', name, reinterpret_cast<uint64_t>(id));
+#define OVMS_PROFILE_ASYNC_END(name, id) \
+    MTR_FINISH("OVMS", name, id);        \
+    ::ovms::traceEvent('e', name, reinterpret_cast<uint64_t>(id));
 
 namespace ovms {
 
@@ -18,6 +18,7 @@
 
 #include <functional>
 #include <numeric>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -43,13 +44,7 @@ OvmsPyTensor::OvmsPyTensor(const std::string& name, void* data, const std::vecto
 
     ndim = bufferShape.size();
     itemsize = bufferFormatToItemsize.at(format);
-    if (ndim > 0) {
-        strides.insert(strides.begin(), itemsize);
-        for (int i = 1; i < ndim; i++) {
-            py::ssize_t stride = bufferShape[ndim - i] * strides[0];
-            strides.insert(strides.begin(), stride);
-        }
-    }
+    setContiguousStrides();
     if (copy) {
         ownedDataPtr = std::make_unique<char[]>(size);
         memcpy(this->ownedDataPtr.get(), data, size);
@@ -75,3 +70,33 @@ OvmsPyTensor::OvmsPyTensor(const std::string& name, const py::buffer& buffer) :
     auto it = bufferFormatToDatatype.find(format);
     datatype = it != bufferFormatToDatatype.end() ? it->second : format;
 }
+
+OvmsPyTensor::OvmsPyTensor(const std::string& name, const py::buffer& buffer, const std::string& datatype, const std::vector<py::ssize_t>& userShape,
+    const std::string& format, const std::vector<py::ssize_t>& bufferShape, py::ssize_t itemsize) :
+    name(name),
+    datatype(datatype),
+    userShape(userShape),
+    bufferShape(bufferShape),
+    format(format),
+    itemsize(itemsize),
+    refObj(buffer) {
+    py::buffer_info bufferInfo = buffer.request();
+    ptr = bufferInfo.ptr;
+    size = bufferInfo.size * bufferInfo.itemsize;
+    ndim = this->bufferShape.size();
+    py::ssize_t expectedSize = std::accumulate(std::begin(this->bufferShape), std::end(this->bufferShape), 1, std::multiplies<py::ssize_t>()) * itemsize;
+    if (expectedSize != static_cast<py::ssize_t>(size)) {
+        throw std::invalid_argument("Buffer size: " + std::to_string(size) + " does not match shape and itemsize of tensor: " + std::to_string(expectedSize));
+    }
+    setContiguousStrides();
+}
+
+void OvmsPyTensor::setContiguousStrides() {
+    if (ndim > 0) {
+        strides.insert(strides.begin(), itemsize);
+        for (int i = 1; i < ndim; i++) {
+            py::ssize_t stride = bufferShape[ndim - i] * strides[0];
+            strides.insert(strides.begin(), stride);
+        }
+    }
+}
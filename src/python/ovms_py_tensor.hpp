@@ -91,6 +91,8 @@ struct OvmsPyTensor {
 private:
     std::unique_ptr<char[]> ownedDataPtr;
 
+    void setContiguousStrides();
+
 public:
     std::string name;
     // Can be one of Kserve datatypes (like UINT8, FP32 etc.) or totally custom like numpy (for example "<U83")
@@ -122,5 +124,10 @@ public:
 
     // Construct object from buffer info
     OvmsPyTensor(const std::string& name, const py::buffer& buffer);
+
+    // Construct object from contiguous buffer holding data of tensor with known metadata.
+    // Used to pass tensors between processes without changing their datatype, shape or format.
+    OvmsPyTensor(const std::string& name, const py::buffer& buffer, const std::string& datatype, const std::vector<py::ssize_t>& userShape,
+        const std::string& format, const std::vector<py::ssize_t>& bufferShape, py::ssize_t itemsize);
 };
 }  // namespace ovms
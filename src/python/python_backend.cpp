@@ -43,11 +43,13 @@ PythonBackend::PythonBackend() {
     SPDLOG_DEBUG("Creating python backend");
     pyovmsModule = std::make_unique<py::module_>(py::module_::import("pyovms"));
     tensorClass = std::make_unique<py::object>(pyovmsModule->attr("Tensor"));
+    createTensorFromData = std::make_unique<py::object>(tensorClass->attr("create_from_data"));
 }
 
 PythonBackend::~PythonBackend() {
     SPDLOG_DEBUG("Python backend destructor start");
     py::gil_scoped_acquire acquire;
+    createTensorFromData.reset();
     tensorClass.reset();
     pyovmsModule.reset();
     SPDLOG_DEBUG("Python backend destructor end");
@@ -57,7 +59,7 @@ bool PythonBackend::createOvmsPyTensor(const std::string& name, void* ptr, const
     const std::string& datatype, py::ssize_t size, std::unique_ptr<PyObjectWrapper<py::object>>& outTensor, bool copy) {
     py::gil_scoped_acquire acquire;
     try {
-        py::object ovmsPyTensor = tensorClass->attr("create_from_data")(name, ptr, shape, datatype, size, copy);
+        py::object ovmsPyTensor = (*createTensorFromData)(name, ptr, shape, datatype, size, copy);
         outTensor = std::make_unique<PyObjectWrapper<py::object>>(ovmsPyTensor);
         return true;
     } catch (const pybind11::error_already_set& e) {
@@ -33,6 +33,8 @@ namespace ovms {
 class PythonBackend {
     std::unique_ptr<py::module_> pyovmsModule;
     std::unique_ptr<py::object> tensorClass;
+    // Bound Tensor.create_from_data, resolved once to avoid attribute lookup on every call
+    std::unique_ptr<py::object> createTensorFromData;
 
 public:
     PythonBackend();
@@ -0,0 +1,100 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "pythonnodebatcher.hpp"
+
+#include <chrono>
+#include <string>
+#include <utility>
+
+#include <pybind11/stl.h>
+
+#include "../logging.hpp"
+#include "utils.hpp"
+
+namespace ovms {
+
+PythonNodeBatcher::PythonNodeBatcher(py::object& ovmsPythonModel, uint32_t maxBatchSize, uint32_t batchTimeoutMicroseconds) :
+    ovmsPythonModel(ovmsPythonModel),
+    maxBatchSize(maxBatchSize),
+    batchTimeoutMicroseconds(batchTimeoutMicroseconds) {}
+
+void PythonNodeBatcher::executeBatch(std::vector<Task*>& batch) {
+    py::gil_scoped_acquire acquire;
+    try {
+        py::list batchInputs;
+        for (auto* task : batch) {
+            batchInputs.append(py::cast(task->inputs));
+        }
+        py::object batchResult = ovmsPythonModel.attr("execute_batch")(batchInputs);
+        if (!py::isinstance<py::list>(batchResult)) {
+            throw UnexpectedPythonObjectError(batchResult, "list");
+        }
+        py::list batchOutputs = batchResult.cast<py::list>();
+        if (batchOutputs.size() != batch.size()) {
+            throw BadPythonNodeConfigurationError("execute_batch returned " + std::to_string(batchOutputs.size()) + " results for batch of " + std::to_string(batch.size()) + " input sets");
+        }
+        for (size_t i = 0; i < batch.size(); ++i) {
+            batch[i]->outputs = batchOutputs[i];
+        }
+    } catch (...) {
+        auto error = std::current_exception();
+        for (auto* task : batch) {
+            task->error = error;
+        }
+    }
+    // Inputs have to be released while holding GIL
+    for (auto* task : batch) {
+        task->inputs.clear();
+    }
+}
+
+py::object PythonNodeBatcher::execute(std::vector<py::object>& inputs) {
+    Task task;
+    task.inputs = std::move(inputs);
+    {
+        py::gil_scoped_release release;
+        std::unique_lock<std::mutex> lock(mtx);
+        pendingTasks.push_back(&task);
+        signal.notify_all();
+        while (!task.done) {
+            if (leaderActive) {
+                signal.wait(lock, [this, &task]() { return task.done || !leaderActive; });
+                continue;
+            }
+            leaderActive = true;
+            signal.wait_for(lock, std::chrono::microseconds(batchTimeoutMicroseconds), [this]() { return pendingTasks.size() >= maxBatchSize; });
+            std::vector<Task*> batch;
+            while (!pendingTasks.empty() && batch.size() < maxBatchSize) {
+                batch.push_back(pendingTasks.front());
+                pendingTasks.pop_front();
+            }
+            lock.unlock();
+            SPDLOG_TRACE("Executing Python node batch of size: {}", batch.size());
+            executeBatch(batch);
+            lock.lock();
+            for (auto* batchTask : batch) {
+                batchTask->done = true;
+            }
+            leaderActive = false;
+            signal.notify_all();
+        }
+    }
+    if (task.error) {
+        std::rethrow_exception(task.error);
+    }
+    return std::move(task.outputs);
+}
+}  // namespace ovms
@@ -0,0 +1,64 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <vector>
+
+#include <pybind11/embed.h>  // everything needed for embedding
+
+namespace py = pybind11;
+
+namespace ovms {
+
+/**
+ * @brief Groups input sets coming from concurrent executions of the same Python node
+ * and passes them to OvmsPythonModel.execute_batch in a single call.
+ *
+ * Thread that finds no batch in progress becomes a leader - it waits up to batch timeout
+ * for other input sets (or until max batch size is reached) and executes the batch on behalf of all waiting threads.
+ */
+class PythonNodeBatcher {
+    struct Task {
+        std::vector<py::object> inputs;
+        py::object outputs;
+        std::exception_ptr error;
+        bool done = false;
+    };
+
+    py::object& ovmsPythonModel;
+    const uint32_t maxBatchSize;
+    const uint32_t batchTimeoutMicroseconds;
+
+    std::mutex mtx;
+    std::condition_variable signal;
+    std::deque<Task*> pendingTasks;
+    bool leaderActive = false;
+
+    void executeBatch(std::vector<Task*>& batch);
+
+public:
+    PythonNodeBatcher(py::object& ovmsPythonModel, uint32_t maxBatchSize, uint32_t batchTimeoutMicroseconds);
+
+    // Must be called with GIL held. GIL is released while waiting for the batch to complete.
+    // Returns result of execute_batch corresponding to provided inputs. Rethrows errors raised during batch execution.
+    py::object execute(std::vector<py::object>& inputs);
+};
+}  // namespace ovms
@@ -24,6 +24,7 @@
 
 #include "../logging.hpp"
 #include "../status.hpp"
+#include "pythonnodeworkerpool.hpp"
 
 #if (PYTHON_DISABLE == 0)
 #pragma GCC diagnostic push
@@ -135,18 +136,33 @@ Status PythonNodeResources::createPythonNodeResources(std::shared_ptr<PythonNode
 
     py::gil_scoped_acquire acquire;
     try {
-        py::module_ sys = py::module_::import("sys");
-        sys.attr("path").attr("append")(parentPath.c_str());
-        py::module_ script = py::module_::import(filename.c_str());
-
-        py::object OvmsPythonModel = script.attr("OvmsPythonModel");
-        nodeResources->ovmsPythonModel = std::make_unique<py::object>(OvmsPythonModel());
-
-        if (py::hasattr(*nodeResources->ovmsPythonModel, "initialize")) {
+        if (nodeOptions.worker_processes() > 0) {
+            SPDLOG_DEBUG("Python node: {} will be executed in: {} worker processes", graphNodeConfig.name(), nodeOptions.worker_processes());
             py::dict kwargsParam = preparePythonNodeInitializeArguments(graphNodeConfig);
-            nodeResources->ovmsPythonModel->attr("initialize")(kwargsParam);
+            nodeResources->ovmsPythonModel = std::make_unique<py::object>(createPythonNodeWorkerPool(nodeOptions.handler_path(), kwargsParam, nodeOptions.worker_processes(), nodeOptions.worker_executable()));
         } else {
-            SPDLOG_DEBUG("OvmsPythonModel class does not have an initialize method. Python node path {} ", nodeOptions.handler_path());
+            py::module_ sys = py::module_::import("sys");
+            sys.attr("path").attr("append")(parentPath.c_str());
+            py::module_ script = py::module_::import(filename.c_str());
+
+            py::object OvmsPythonModel = script.attr("OvmsPythonModel");
+            nodeResources->ovmsPythonModel = std::make_unique<py::object>(OvmsPythonModel());
+
+            if (py::hasattr(*nodeResources->ovmsPythonModel, "initialize")) {
+                py::dict kwargsParam = preparePythonNodeInitializeArguments(graphNodeConfig);
+                nodeResources->ovmsPythonModel->attr("initialize")(kwargsParam);
+            } else {
+                SPDLOG_DEBUG("OvmsPythonModel class does not have an initialize method. Python node path {} ", nodeOptions.handler_path());
+            }
+        }
+
+        if (nodeOptions.max_batch_size() > 1) {
+            if (py::hasattr(*nodeResources->ovmsPythonModel, "execute_batch")) {
+                SPDLOG_DEBUG("Python node: {} will execute batches of up to: {} input sets with timeout: {} us", graphNodeConfig.name(), nodeOptions.max_batch_size(), nodeOptions.batch_timeout_us());
+                nodeResources->batcher = std::make_unique<PythonNodeBatcher>(*nodeResources->ovmsPythonModel, nodeOptions.max_batch_size(), nodeOptions.batch_timeout_us());
+            } else {
+                SPDLOG_WARN("Python node: {} has max_batch_size set but OvmsPythonModel class does not have an execute_batch method. Python node path {} ", graphNodeConfig.name(), nodeOptions.handler_path());
+            }
         }
     } catch (const pybind11::error_already_set& e) {
         SPDLOG_ERROR("Failed to process python node file {} : {}", nodeOptions.handler_path(), e.what());
@@ -161,6 +177,7 @@ Status PythonNodeResources::createPythonNodeResources(std::shared_ptr<PythonNode
 PythonNodeResources::~PythonNodeResources() {
     SPDLOG_DEBUG("Calling Python node resource destructor");
     this->finalize();
+    this->batcher.reset();
     py::gil_scoped_acquire acquire;
     this->ovmsPythonModel.reset();
 }
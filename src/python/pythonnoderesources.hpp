@@ -21,6 +21,7 @@
 
 #include <pybind11/embed.h>  // everything needed for embedding
 
+#include "pythonnodebatcher.hpp"
 #include "src/mediapipe_calculators/python_executor_calculator_options.pb.h"
 
 namespace py = pybind11;
@@ -38,6 +39,8 @@ public:
     PythonBackend* pythonBackend;
     std::string pythonNodeFilePath;
     std::unordered_map<std::string, std::string> outputsNameTagMapping;
+    // Set only when node is configured with max_batch_size > 1 and OvmsPythonModel implements execute_batch
+    std::unique_ptr<PythonNodeBatcher> batcher;
 
     PythonNodeResources(PythonBackend* pythonBackend);
     ~PythonNodeResources();
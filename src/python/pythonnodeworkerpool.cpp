@@ -0,0 +1,310 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "pythonnodeworkerpool.hpp"
+
+#include <string>
+
+namespace ovms {
+
+// Shared memory exchange of pyovms.Tensor objects used by both the server and worker processes.
+// Writer copies tensors into a new file in /dev/shm, reader maps the file, unlinks it and wraps tensors
+// with Tensor.create_from_buffer, so that mapping lives as long as tensors referencing it.
+static const char* TENSORS_EXCHANGE_SOURCE = R"PY(
+import itertools
+import mmap
+import os
+import tempfile
+
+from pyovms import Tensor
+
+_SEGMENTS_DIRECTORY = "/dev/shm" if os.path.isdir("/dev/shm") else tempfile.gettempdir()
+_ALIGNMENT = 64
+_segments_counter = itertools.count()
+
+
+def _tensor_bytes(view):
+    # Casting does not copy data, but it is possible only for contiguous tensors of native formats
+    if view.c_contiguous and view.ndim > 0:
+        try:
+            return view.cast("B")
+        except (TypeError, ValueError):
+            pass
+    return memoryview(view.tobytes())
+
+
+def remove_segment(path):
+    if path is None:
+        return
+    try:
+        os.unlink(path)
+    except FileNotFoundError:
+        pass
+
+
+def write_segment(tensors):
+    views = []
+    metadata = []
+    offset = 0
+    for tensor in tensors:
+        if not isinstance(tensor, Tensor):
+            raise TypeError("Expected pyovms.Tensor, got {}".format(type(tensor).__name__))
+        view = memoryview(tensor)
+        data = _tensor_bytes(view)
+        metadata.append((tensor.name, tensor.datatype, list(tensor.shape), view.format, list(view.shape), view.itemsize, offset, data.nbytes))
+        views.append((offset, data))
+        offset += (data.nbytes + _ALIGNMENT - 1) // _ALIGNMENT * _ALIGNMENT
+    if offset == 0:
+        return None, metadata
+    path = os.path.join(_SEGMENTS_DIRECTORY, "ovms_python_node_{}_{}".format(os.getpid(), next(_segments_counter)))
+    fd = os.open(path, os.O_CREAT | os.O_EXCL | os.O_RDWR, 0o600)
+    try:
+        os.ftruncate(fd, offset)
+        with mmap.mmap(fd, offset) as segment:
+            for data_offset, data in views:
+                segment[data_offset:data_offset + data.nbytes] = data
+    except BaseException:
+        remove_segment(path)
+        raise
+    finally:
+        os.close(fd)
+    return path, metadata
+
+
+def read_segment(path, metadata):
+    segment = None
+    if path is not None:
+        fd = os.open(path, os.O_RDWR)
+        try:
+            segment = mmap.mmap(fd, 0)
+        finally:
+            os.close(fd)
+            remove_segment(path)
+    tensors = []
+    for name, datatype, shape, buffer_format, buffer_shape, itemsize, offset, size in metadata:
+        data = memoryview(segment)[offset:offset + size] if size > 0 else b""
+        tensors.append(Tensor.create_from_buffer(name, data, datatype, shape, buffer_format, buffer_shape, itemsize))
+    return tensors
+
+
+def split(tensors, counts):
+    tensor_sets = []
+    begin = 0
+    for count in counts:
+        tensor_sets.append(tensors[begin:begin + count])
+        begin += count
+    return tensor_sets
+)PY";
+
+// Main loop of worker process. Worker loads OvmsPythonModel and executes requests received from the server until pipes are closed.
+static const char* WORKER_SOURCE = R"PY(
+import importlib
+import sys
+import traceback
+from multiprocessing.connection import Connection
+
+
+def _check_outputs(outputs):
+    if not isinstance(outputs, list):
+        raise TypeError("OvmsPythonModel executed in worker process has to return list, got {}. "
+                        "Generators are not supported in worker processes.".format(type(outputs).__name__))
+    return outputs
+
+
+def _execute(model, method, input_sets):
+    if method == "execute":
+        return [_check_outputs(model.execute(input_sets[0]))]
+    return [_check_outputs(outputs) for outputs in _check_outputs(model.execute_batch(input_sets))]
+
+
+def main(requests, responses):
+    handler_path, initialize_arguments = requests.recv()
+    try:
+        directory, module_name = os.path.split(os.path.splitext(handler_path)[0])
+        sys.path.append(directory)
+        model = importlib.import_module(module_name).OvmsPythonModel()
+        if hasattr(model, "initialize"):
+            model.initialize(initialize_arguments)
+    except BaseException:
+        responses.send(("error", traceback.format_exc()))
+        return
+    responses.send(("ok", hasattr(model, "execute_batch")))
+    while True:
+        try:
+            method, path, metadata, counts = requests.recv()
+        except EOFError:
+            break
+        try:
+            if method == "finalize":
+                if hasattr(model, "finalize"):
+                    model.finalize()
+                responses.send(("ok", None))
+                break
+            output_sets = _execute(model, method, split(read_segment(path, metadata), counts))
+            output_path, output_metadata = write_segment([tensor for outputs in output_sets for tensor in outputs])
+            responses.send(("ok", (output_path, output_metadata, [len(outputs) for outputs in output_sets])))
+        except BaseException:
+            responses.send(("error", traceback.format_exc()))
+
+
+main(Connection(int(sys.argv[1]), writable=False), Connection(int(sys.argv[2]), readable=False))
+)PY";
+
+// Server side of the pool. Waiting for free worker and for worker response releases the GIL.
+static const char* WORKER_POOL_SOURCE = R"PY(
+import queue
+import shutil
+import subprocess
+import sys
+from multiprocessing.connection import Connection
+
+_WORKER_EXIT_TIMEOUT_SECONDS = 10
+
+
+def _default_executable():
+    if os.path.basename(sys.executable).startswith("python"):
+        return sys.executable
+    return shutil.which("python3") or "python3"
+
+
+class _Worker:
+    def __init__(self, executable, handler_path, initialize_arguments, environment):
+        requests_read, requests_write = os.pipe()
+        responses_read, responses_write = os.pipe()
+        try:
+            # New session keeps terminal signals sent to the server away from workers, they exit when pipes are closed
+            self.process = subprocess.Popen([executable, "-c", WORKER_SOURCE, str(requests_read), str(responses_write)],
+                                            pass_fds=(requests_read, responses_write), env=environment, start_new_session=True)
+        except BaseException:
+            os.close(requests_write)
+            os.close(responses_read)
+            raise
+        finally:
+            os.close(requests_read)
+            os.close(responses_write)
+        self.requests = Connection(requests_write, readable=False)
+        self.responses = Connection(responses_read, writable=False)
+        try:
+            self.requests.send((handler_path, initialize_arguments))
+            status, result = self.responses.recv()
+        except (EOFError, OSError) as error:
+            self.close()
+            raise RuntimeError("Python node worker process exited during initialization") from error
+        if status != "ok":
+            self.close()
+            raise RuntimeError("Python node initialization failed in worker process:\n" + result)
+        self.has_execute_batch = result
+
+    def call(self, method, input_sets):
+        if self.requests.closed:
+            raise EOFError("Python node worker process is not running")
+        path, metadata = write_segment([tensor for inputs in input_sets for tensor in inputs])
+        try:
+            self.requests.send((method, path, metadata, [len(inputs) for inputs in input_sets]))
+            status, result = self.responses.recv()
+        finally:
+            remove_segment(path)
+        if status != "ok":
+            raise RuntimeError(result)
+        output_path, output_metadata, counts = result
+        return split(read_segment(output_path, output_metadata), counts)
+
+    def finalize(self):
+        if self.requests.closed:
+            raise EOFError("Python node worker process is not running")
+        self.requests.send(("finalize", None, [], []))
+        status, result = self.responses.recv()
+        if status != "ok":
+            raise RuntimeError(result)
+
+    def close(self):
+        self.requests.close()
+        self.responses.close()
+        try:
+            self.process.wait(timeout=_WORKER_EXIT_TIMEOUT_SECONDS)
+        except subprocess.TimeoutExpired:
+            self.process.kill()
+            self.process.wait()
+
+
+class PythonNodeWorkerPool:
+    def __init__(self, handler_path, initialize_arguments, workers_count, executable):
+        environment = dict(os.environ)
+        # Workers import pyovms and other modules from the same locations as the server
+        environment["PYTHONPATH"] = os.pathsep.join(path for path in sys.path if path)
+        self._arguments = (executable or _default_executable(), handler_path, initialize_arguments, environment)
+        self._workers = []
+        self._idle_workers = queue.Queue()
+        try:
+            for _ in range(workers_count):
+                self._workers.append(_Worker(*self._arguments))
+        except BaseException:
+            self._close()
+            raise
+        for worker in self._workers:
+            self._idle_workers.put(worker)
+        if self._workers[0].has_execute_batch:
+            self.execute_batch = self._execute_batch
+
+    def execute(self, inputs):
+        return self._call("execute", [inputs])[0]
+
+    def _execute_batch(self, input_sets):
+        return self._call("execute_batch", input_sets)
+
+    def _call(self, method, input_sets):
+        worker = self._idle_workers.get()
+        try:
+            return worker.call(method, input_sets)
+        except (EOFError, BrokenPipeError, ConnectionResetError) as error:
+            worker = self._restart(worker)
+            raise RuntimeError("Python node worker process failed during execution") from error
+        finally:
+            self._idle_workers.put(worker)
+
+    def _restart(self, worker):
+        worker.close()
+        try:
+            restarted = _Worker(*self._arguments)
+        except BaseException:
+            # Dead worker stays in the pool, so that next execution tries to start it again
+            return worker
+        self._workers[self._workers.index(worker)] = restarted
+        return restarted
+
+    def finalize(self):
+        errors = []
+        for worker in self._workers:
+            try:
+                worker.finalize()
+            except Exception as error:
+                errors.append(str(error))
+        self._close()
+        if errors:
+            raise RuntimeError("\n".join(errors))
+
+    def _close(self):
+        for worker in self._workers:
+            worker.close()
+)PY";
+
+py::object createPythonNodeWorkerPool(const std::string& handlerPath, const py::dict& initializeArguments, uint32_t workersCount, const std::string& executable) {
+    py::object module = py::module_::import("types").attr("ModuleType")("ovms_python_node_worker_pool");
+    py::object moduleGlobals = module.attr("__dict__");
+    moduleGlobals["WORKER_SOURCE"] = std::string(TENSORS_EXCHANGE_SOURCE) + WORKER_SOURCE;
+    py::exec(std::string(TENSORS_EXCHANGE_SOURCE) + WORKER_POOL_SOURCE, moduleGlobals);
+    return module.attr("PythonNodeWorkerPool")(handlerPath, initializeArguments, workersCount, executable);
+}
+}  // namespace ovms
@@ -0,0 +1,43 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include <pybind11/embed.h>  // everything needed for embedding
+
+namespace py = pybind11;
+
+namespace ovms {
+
+/**
+ * @brief Creates object executing OvmsPythonModel of the node in a pool of worker processes.
+ * Each worker process has its own interpreter, so executions of the node in different workers are not serialized on the GIL of the server.
+ *
+ * Returned object has the same interface as OvmsPythonModel instance: execute, execute_batch (only if implemented by the model)
+ * and finalize. Calling thread waits for a free worker with the GIL released. Tensors are passed through shared memory files
+ * and are wrapped without copying on the receiving side.
+ *
+ * Must be called with GIL held. Throws pybind11::error_already_set when workers cannot be started or model initialization fails.
+ *
+ * @param handlerPath path to Python file with OvmsPythonModel class
+ * @param initializeArguments arguments passed to OvmsPythonModel.initialize in each worker
+ * @param workersCount number of worker processes
+ * @param executable Python executable used to start workers, if empty the interpreter of the server or python3 is used
+ */
+py::object createPythonNodeWorkerPool(const std::string& handlerPath, const py::dict& initializeArguments, uint32_t workersCount, const std::string& executable);
+}  // namespace ovms
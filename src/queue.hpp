@@ -15,7 +15,9 @@
 //*****************************************************************************
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <future>
 #include <memory>
@@ -27,6 +29,7 @@
 #include <vector>
 
 // #include "profiler.hpp"
+#include "requestpriority.hpp"
 
 namespace ovms {
 
@@ -35,8 +38,10 @@ class Queue {
 public:
     /**
     * @brief Allocating idle stream for execution
+    *
+    * @param priority class in which request waits when there is no idle stream
     */
-    std::future<int> getIdleStream() {
+    std::future<int> getIdleStream(RequestPriority priority = RequestPriority::MEDIUM) {
         // OVMS_PROFILE_FUNCTION();
         int value;
         std::promise<int> idleStreamPromise;
@@ -44,7 +49,8 @@ public:
         std::unique_lock<std::mutex> lk(front_mut);
         if (streams[front_idx] < 0) {  // we need to wait for any idle stream to be returned
             std::unique_lock<std::mutex> queueLock(queue_mutex);
-            promises.push(std::move(idleStreamPromise));
+            promises[static_cast<size_t>(priority)].push({std::move(idleStreamPromise), std::chrono::steady_clock::now()});
+            waitersCount.fetch_add(1, std::memory_order_relaxed);
         } else {  // we can give idle stream right away
             value = streams[front_idx];
             streams[front_idx] = -1;  // negative value indicate consumed vector index
@@ -76,9 +82,15 @@ public:
     void returnStream(int streamID) {
         // OVMS_PROFILE_FUNCTION();
         std::unique_lock<std::mutex> lk(queue_mutex);
-        if (promises.size()) {
-            std::promise<int> promise = std::move(promises.front());
-            promises.pop();
+        auto waitingClass = selectWaitingClass();
+        if (waitingClass.has_value()) {
+            auto& waiting = promises[waitingClass.value()];
+            std::promise<int> promise = std::move(waiting.front().promise);
+            waiting.pop();
+            waitersCount.fetch_sub(1, std::memory_order_relaxed);
+            if (waiting.empty()) {
+                currentWeights[waitingClass.value()] = 0;
+            }
             lk.unlock();
             promise.set_value(streamID);
             return;
@@ -104,6 +116,41 @@ public:
         }
     }
 
+    /**
+     * @brief Number of streams managed by the queue
+     */
+    size_t size() const {
+        return streams.size();
+    }
+
+    /**
+     * @brief Number of requests waiting for idle stream
+     */
+    size_t getWaitersCount() const {
+        return waitersCount.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Time for which the longest waiting request waits for idle stream, zero when none waits
+     */
+    std::chrono::microseconds getOldestWaiterAge() {
+        if (getWaitersCount() == 0) {
+            return std::chrono::microseconds(0);
+        }
+        std::unique_lock<std::mutex> lk(queue_mutex);
+        std::optional<std::chrono::steady_clock::time_point> oldest;
+        for (const auto& waiting : promises) {
+            if (!waiting.empty() && (!oldest.has_value() || waiting.front().enqueued < oldest.value())) {
+                oldest = waiting.front().enqueued;
+            }
+        }
+        lk.unlock();
+        if (!oldest.has_value()) {
+            return std::chrono::microseconds(0);
+        }
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - oldest.value());
+    }
+
     /**
      * @brief Give InferRequest
      */
@@ -111,6 +158,30 @@ public:
         return inferRequests[streamID];
     }
 
+private:
+    /**
+     * @brief Smooth weighted round robin over priority classes with waiting requests, so that lower classes
+     * still get their share of streams under load. Has to be called with queue_mutex locked.
+     */
+    std::optional<size_t> selectWaitingClass() {
+        std::optional<size_t> selected;
+        int64_t totalWeight = 0;
+        for (size_t i = REQUEST_PRIORITY_CLASSES; i-- > 0;) {
+            if (promises[i].empty()) {
+                continue;
+            }
+            currentWeights[i] += REQUEST_PRIORITY_WEIGHTS[i];
+            totalWeight += REQUEST_PRIORITY_WEIGHTS[i];
+            if (!selected.has_value() || currentWeights[i] > currentWeights[selected.value()]) {
+                selected = i;
+            }
+        }
+        if (selected.has_value()) {
+            currentWeights[selected.value()] -= totalWeight;
+        }
+        return selected;
+    }
+
 protected:
     /**
     * @brief Vector representing circular buffer for infer queue
@@ -136,6 +207,17 @@ protected:
      * 
      */
     std::vector<T> inferRequests;
-    std::queue<std::promise<int>> promises;
+
+    struct Waiter {
+        std::promise<int> promise;
+        std::chrono::steady_clock::time_point enqueued;
+    };
+
+    /**
+     * @brief Requests waiting for idle stream, indexed by RequestPriority
+     */
+    std::array<std::queue<Waiter>, REQUEST_PRIORITY_CLASSES> promises;
+    std::atomic<size_t> waitersCount{0};
+    std::array<int64_t, REQUEST_PRIORITY_CLASSES> currentWeights{};
 };
 }  // namespace ovms
@@ -0,0 +1,117 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "rcu.hpp"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace ovms {
+
+namespace {
+constexpr uint32_t MAX_SPINS_BEFORE_SLEEP = 1000;
+constexpr uint32_t WAIT_FOR_READER_SLEEP_US = 50;
+
+/**
+ * @brief Reader slot is assigned to the thread on its first read section and returned to the domain on thread exit
+ */
+struct ThreadReaderState {
+    RcuDomain::ReaderSlot* slot = nullptr;
+    uint32_t depth = 0;
+
+    ~ThreadReaderState() {
+        if (slot != nullptr) {
+            RcuDomain::instance().releaseSlot(*slot);
+        }
+    }
+};
+
+thread_local ThreadReaderState threadReaderState;
+}  // namespace
+
+RcuDomain& RcuDomain::instance() {
+    static RcuDomain instance;
+    return instance;
+}
+
+RcuDomain::ReaderSlot& RcuDomain::acquireSlot() {
+    std::lock_guard<std::mutex> lock(slotsMtx);
+    for (auto& slot : slots) {
+        if (!slot.inUse) {
+            slot.inUse = true;
+            return slot;
+        }
+    }
+    auto& slot = slots.emplace_back();
+    slot.inUse = true;
+    return slot;
+}
+
+void RcuDomain::releaseSlot(ReaderSlot& slot) {
+    std::lock_guard<std::mutex> lock(slotsMtx);
+    slot.epoch.store(0);
+    slot.inUse = false;
+}
+
+void RcuDomain::synchronize() {
+    // Readers entering after epoch change are guaranteed to see already published data
+    const uint64_t targetEpoch = globalEpoch.fetch_add(1) + 1;
+    // Slots are never removed and deque keeps references valid on emplace_back,
+    // so waiting for readers does not need to block threads acquiring or releasing slots.
+    // Slot released or reused meanwhile has epoch 0 or not older than target epoch.
+    std::vector<const ReaderSlot*> slotsToWaitFor;
+    {
+        std::lock_guard<std::mutex> lock(slotsMtx);
+        slotsToWaitFor.reserve(slots.size());
+        for (const auto& slot : slots) {
+            slotsToWaitFor.push_back(&slot);
+        }
+    }
+    for (const auto* slot : slotsToWaitFor) {
+        uint32_t spins = 0;
+        while (true) {
+            const uint64_t readerEpoch = slot->epoch.load();
+            if (readerEpoch == 0 || readerEpoch >= targetEpoch) {
+                break;
+            }
+            if (++spins < MAX_SPINS_BEFORE_SLEEP) {
+                std::this_thread::yield();
+            } else {
+                std::this_thread::sleep_for(std::chrono::microseconds(WAIT_FOR_READER_SLEEP_US));
+            }
+        }
+    }
+}
+
+RcuReadGuard::RcuReadGuard() {
+    auto& state = threadReaderState;
+    if (state.depth++ > 0) {
+        return;
+    }
+    if (state.slot == nullptr) {
+        state.slot = &RcuDomain::instance().acquireSlot();
+    }
+    state.slot->epoch.store(RcuDomain::instance().getEpoch());
+}
+
+RcuReadGuard::~RcuReadGuard() {
+    auto& state = threadReaderState;
+    if (--state.depth > 0) {
+        return;
+    }
+    state.slot->epoch.store(0, std::memory_order_release);
+}
+}  // namespace ovms
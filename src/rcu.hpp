@@ -0,0 +1,102 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+namespace ovms {
+
+/**
+ * @brief Epoch based read-copy-update domain.
+ * Readers announce the epoch they started in, in a per thread slot, so that read side does not write to memory shared with other threads.
+ * Writers publish new data and wait until all readers which could still see previous data leave their read sections.
+ */
+class RcuDomain {
+public:
+    struct alignas(64) ReaderSlot {
+        std::atomic<uint64_t> epoch{0};
+        bool inUse = false;
+    };
+
+private:
+    std::atomic<uint64_t> globalEpoch{1};
+    std::mutex slotsMtx;
+    std::deque<ReaderSlot> slots;
+
+public:
+    static RcuDomain& instance();
+
+    ReaderSlot& acquireSlot();
+    void releaseSlot(ReaderSlot& slot);
+
+    uint64_t getEpoch() const {
+        return globalEpoch.load();
+    }
+
+    /**
+     * @brief Waits until all read sections started before the call are finished.
+     * Must not be called from within read section.
+     */
+    void synchronize();
+};
+
+/**
+ * @brief Marks read section of calling thread. Data read from RcuSnapshot stays valid until guard is destroyed.
+ * Guards can be nested.
+ */
+class RcuReadGuard {
+public:
+    RcuReadGuard();
+    ~RcuReadGuard();
+    RcuReadGuard(const RcuReadGuard&) = delete;
+    RcuReadGuard& operator=(const RcuReadGuard&) = delete;
+};
+
+/**
+ * @brief Immutable snapshot of data published by writers and read without locks.
+ * Writers need to be serialized by the owner of the snapshot.
+ */
+template <typename T>
+class RcuSnapshot {
+    std::atomic<const T*> current;
+
+public:
+    RcuSnapshot() :
+        current(new T()) {}
+    ~RcuSnapshot() {
+        delete current.load();
+    }
+    RcuSnapshot(const RcuSnapshot&) = delete;
+    RcuSnapshot& operator=(const RcuSnapshot&) = delete;
+
+    const T& read(const RcuReadGuard&) const {
+        return *current.load();
+    }
+
+    /**
+     * @brief Replaces snapshot and releases the previous one once no reader can access it
+     */
+    void publish(std::unique_ptr<const T> next) {
+        const T* previous = current.exchange(next.release());
+        RcuDomain::instance().synchronize();
+        delete previous;
+    }
+};
+}  // namespace ovms
@@ -0,0 +1,44 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "requestpriority.hpp"
+
+#include <algorithm>
+#include <cctype>
+
+namespace ovms {
+
+const std::string PRIORITY_PARAMETER_NAME = "priority";
+
+std::optional<RequestPriority> requestPriorityFromString(const std::string& priority) {
+    std::string upper = priority;
+    std::transform(upper.begin(), upper.end(), upper.begin(), ::toupper);
+    if (upper == "LOW") {
+        return RequestPriority::LOW;
+    }
+    if (upper == "MEDIUM") {
+        return RequestPriority::MEDIUM;
+    }
+    if (upper == "HIGH") {
+        return RequestPriority::HIGH;
+    }
+    return std::nullopt;
+}
+
+const std::string& toString(RequestPriority priority) {
+    static const std::array<std::string, REQUEST_PRIORITY_CLASSES> names = {"LOW", "MEDIUM", "HIGH"};
+    return names[static_cast<size_t>(priority)];
+}
+}  // namespace ovms
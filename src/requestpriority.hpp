@@ -0,0 +1,46 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace ovms {
+
+/**
+ * @brief Priority class of inference request. Requests waiting for infer request of the same model
+ * are admitted with weighted fair share of the released streams per class.
+ */
+enum class RequestPriority {
+    LOW,
+    MEDIUM,
+    HIGH
+};
+
+constexpr size_t REQUEST_PRIORITY_CLASSES = 3;
+
+/**
+ * @brief Share of released streams given to each priority class when all classes are waiting, indexed by RequestPriority
+ */
+constexpr std::array<uint32_t, REQUEST_PRIORITY_CLASSES> REQUEST_PRIORITY_WEIGHTS = {1, 3, 9};
+
+extern const std::string PRIORITY_PARAMETER_NAME;
+
+std::optional<RequestPriority> requestPriorityFromString(const std::string& priority);
+const std::string& toString(RequestPriority priority);
+}  // namespace ovms
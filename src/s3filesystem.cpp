@@ -81,11 +81,29 @@ StatusCode S3FileSystem::parsePath(const std::string& path, std::string* bucket,
     return StatusCode::OK;
 }
 
-S3FileSystem::S3FileSystem(const Aws::SDKOptions& options, const std::string& s3_path) :
-    options_(options),
+namespace {
+class AwsSdk {
+    Aws::SDKOptions options;
+
+public:
+    AwsSdk() {
+        Aws::InitAPI(options);
+    }
+    ~AwsSdk() {
+        Aws::ShutdownAPI(options);
+    }
+};
+}  // namespace
+
+void S3FileSystem::initializeSdk() {
+    static AwsSdk sdk;
+}
+
+S3FileSystem::S3FileSystem(const std::string& s3_path) :
     s3_regex_(FileSystem::S3_URL_PREFIX + "([0-9a-zA-Z-.]+):([0-9]+)/([0-9a-z.-]+)(((/"
                                           "[0-9a-zA-Z.-_]+)*)?)"),
     proxy_regex_("^(https?)://(([^:]{1,128}):([^@]{1,256})@)?([^:/]{1,255})(:([0-9]{1,5}))?/?") {
+    initializeSdk();
     Aws::Client::ClientConfiguration config;
     Aws::Auth::AWSCredentials credentials;
 
@@ -172,10 +190,6 @@ S3FileSystem::S3FileSystem(const Aws::SDKOptions& options, const std::string& s3
     }
 }
 
-S3FileSystem::~S3FileSystem() {
-    Aws::ShutdownAPI(options_);
-}
-
 StatusCode S3FileSystem::fileExists(const std::string& path, bool* exists) {
     *exists = false;
     std::string bucket, object;
@@ -457,60 +471,137 @@ StatusCode S3FileSystem::downloadFileFolder(const std::string& path, const std::
             }
         }
 
+        std::vector<std::pair<std::string, std::string>> filesToDownload;
         for (auto iter = files.begin(); iter != files.end(); ++iter) {
             if (std::any_of(acceptedFiles.begin(), acceptedFiles.end(), [&iter](const std::string& x) {
                     return iter->size() > 0 && endsWith(*iter, x);
                 })) {
-                std::string bucket, object;
-                status = parsePath(*iter, &bucket, &object);
-                if (status != StatusCode::OK) {
-                    return status;
-                }
-
-                // Send a request for the objects metadata
-                s3::Model::GetObjectRequest object_request;
-                object_request.SetBucket(bucket.c_str());
-                object_request.SetKey(object.c_str());
-
-                auto get_object_outcome = client_.GetObject(object_request);
-                if (get_object_outcome.IsSuccess()) {
-                    auto& retrieved_file =
-                        get_object_outcome.GetResultWithOwnership().GetBody();
-                    std::string s3_removed_path = (*iter).substr(effective_path.size());
-                    std::string local_file_path = FileSystem::joinPath({local_path, s3_removed_path});
-                    std::ofstream output_file(local_file_path.c_str(), std::ios::binary);
-                    output_file << retrieved_file.rdbuf();
-                    output_file.close();
-                } else {
-                    SPDLOG_LOGGER_ERROR(s3_logger, "Failed to get object at {}", *iter);
-                    return StatusCode::S3_FAILED_GET_OBJECT;
-                }
+                std::string s3_removed_path = (*iter).substr(effective_path.size());
+                filesToDownload.emplace_back(*iter, FileSystem::joinPath({local_path, s3_removed_path}));
             }
         }
+        return downloadFiles(filesToDownload);
     } else {
-        std::string bucket, object;
-        auto s = parsePath(effective_path, &bucket, &object);
-        if (s != StatusCode::OK) {
-            return s;
+        return downloadFiles({{effective_path, local_path}});
+    }
+}
+
+StatusCode S3FileSystem::downloadObject(const std::string& bucket, const std::string& object, const std::string& etag, uint64_t size, const std::string& local_path) {
+    s3::Model::GetObjectRequest object_request;
+    object_request.SetBucket(bucket.c_str());
+    object_request.SetKey(object.c_str());
+    object_request.SetIfMatch(etag.c_str());
+
+    auto get_object_outcome = client_.GetObject(object_request);
+    if (!get_object_outcome.IsSuccess()) {
+        SPDLOG_LOGGER_ERROR(s3_logger, "Failed to get object at {}/{} with ETag {}: {}", bucket, object, etag, get_object_outcome.GetError().GetMessage());
+        return StatusCode::S3_FAILED_GET_OBJECT;
+    }
+    auto& retrieved_file = get_object_outcome.GetResultWithOwnership().GetBody();
+    return writeStreamToFile(retrieved_file, local_path, size, StatusCode::S3_FAILED_GET_OBJECT);
+}
+
+StatusCode S3FileSystem::downloadObjectRange(const std::string& bucket, const std::string& object, const std::string& etag, const std::string& local_path, const byte_range_t& range) {
+    s3::Model::GetObjectRequest object_request;
+    object_request.SetBucket(bucket.c_str());
+    object_request.SetKey(object.c_str());
+    // All ranges have to come from the same object version, so that file is not mixed when object is replaced during download
+    object_request.SetIfMatch(etag.c_str());
+    object_request.SetRange(("bytes=" + std::to_string(range.first) + "-" + std::to_string(range.second)).c_str());
+
+    auto get_object_outcome = client_.GetObject(object_request);
+    if (!get_object_outcome.IsSuccess()) {
+        SPDLOG_LOGGER_ERROR(s3_logger, "Failed to get object at {}/{} with ETag {} range: {}-{}: {}", bucket, object, etag, range.first, range.second, get_object_outcome.GetError().GetMessage());
+        return StatusCode::S3_FAILED_GET_OBJECT;
+    }
+    auto& retrieved_range = get_object_outcome.GetResultWithOwnership().GetBody();
+    std::vector<char> buffer(range.second - range.first + 1);
+    retrieved_range.read(buffer.data(), buffer.size());
+    if (static_cast<size_t>(retrieved_range.gcount()) != buffer.size()) {
+        SPDLOG_LOGGER_ERROR(s3_logger, "Received incomplete range: {}-{} of object at {}/{}", range.first, range.second, bucket, object);
+        return StatusCode::S3_FAILED_GET_OBJECT;
+    }
+    return writeFileRange(local_path, range.first, buffer.data(), buffer.size());
+}
+
+StatusCode S3FileSystem::downloadFiles(const std::vector<std::pair<std::string, std::string>>& filesToDownload) {
+    struct FileDownload {
+        std::string remotePath;
+        std::string localPath;
+        std::string bucket;
+        std::string object;
+        std::string etag;
+        std::string cacheKey;
+        uint64_t size = 0;
+        bool cached = false;
+    };
+    const DownloadCache& cache = DownloadCache::instance();
+    std::vector<FileDownload> downloads(filesToDownload.size());
+    std::vector<download_task_t> tasks;
+    // Object size and ETag are required to split download into ranges and to look up the cache
+    for (size_t i = 0; i < filesToDownload.size(); ++i) {
+        auto& download = downloads[i];
+        download.remotePath = filesToDownload[i].first;
+        download.localPath = filesToDownload[i].second;
+        auto status = parsePath(download.remotePath, &download.bucket, &download.object);
+        if (status != StatusCode::OK) {
+            return status;
         }
+        tasks.emplace_back([this, &download, &cache]() {
+            s3::Model::HeadObjectRequest head_request;
+            head_request.SetBucket(download.bucket.c_str());
+            head_request.SetKey(download.object.c_str());
+            auto head_object_outcome = client_.HeadObject(head_request);
+            if (!head_object_outcome.IsSuccess()) {
+                SPDLOG_LOGGER_ERROR(s3_logger, "Failed to get object metadata at {}", download.remotePath);
+                return StatusCode::S3_FAILED_GET_OBJECT;
+            }
+            download.size = head_object_outcome.GetResult().GetContentLength();
+            download.etag = head_object_outcome.GetResult().GetETag().c_str();
+            download.cacheKey = DownloadCache::createKey(download.remotePath, download.etag);
+            download.cached = cache.fetch(download.cacheKey, download.localPath);
+            return StatusCode::OK;
+        });
+    }
+    auto status = runDownloadTasks(tasks);
+    if (status != StatusCode::OK) {
+        return status;
+    }
 
-        // Send a request for the objects metadata
-        s3::Model::GetObjectRequest object_request;
-        object_request.SetBucket(bucket.c_str());
-        object_request.SetKey(object.c_str());
-
-        auto get_object_outcome = client_.GetObject(object_request);
-        if (get_object_outcome.IsSuccess()) {
-            auto& retrieved_file = get_object_outcome.GetResultWithOwnership().GetBody();
-            std::ofstream output_file(local_path.c_str(), std::ios::binary);
-            output_file << retrieved_file.rdbuf();
-            output_file.close();
-        } else {
-            SPDLOG_LOGGER_ERROR(s3_logger, "Failed to get object at {}", effective_path);
-            return StatusCode::S3_FAILED_GET_OBJECT;
+    tasks.clear();
+    for (auto& download : downloads) {
+        if (download.cached) {
+            continue;
+        }
+        auto ranges = splitIntoDownloadRanges(download.size);
+        if (ranges.size() <= 1) {
+            tasks.emplace_back([this, &download]() { return downloadObject(download.bucket, download.object, download.etag, download.size, download.localPath); });
+            continue;
         }
+        SPDLOG_LOGGER_DEBUG(s3_logger, "Downloading {} ({} bytes) in {} parts", download.remotePath, download.size, ranges.size());
+        status = createFileOfSize(download.localPath, download.size);
+        if (status != StatusCode::OK) {
+            return status;
+        }
+        for (const auto& range : ranges) {
+            tasks.emplace_back([this, &download, range]() { return downloadObjectRange(download.bucket, download.object, download.etag, download.localPath, range); });
+        }
+    }
+    status = runDownloadTasks(tasks);
+    if (status != StatusCode::OK) {
+        return status;
     }
 
+    for (const auto& download : downloads) {
+        if (download.cached) {
+            continue;
+        }
+        status = checkDownloadedFileSize(download.localPath, download.size);
+        if (status != StatusCode::OK) {
+            return status;
+        }
+        cache.store(download.cacheKey, download.localPath);
+    }
     return StatusCode::OK;
 }
 
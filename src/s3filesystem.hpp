@@ -17,11 +17,13 @@
 
 #include <regex>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <aws/core/Aws.h>
 #include <aws/s3/S3Client.h>
 
+#include "download_utils.hpp"
 #include "filesystem.hpp"
 #include "status.hpp"
 
@@ -32,16 +34,15 @@ public:
     /**
      * @brief Construct a new S3FileSystem object
      * 
-     * @param options 
      * @param s3_path 
      */
-    S3FileSystem(const Aws::SDKOptions& options, const std::string& s3_path);
+    S3FileSystem(const std::string& s3_path);
 
     /**
-     * @brief Destroy the S3FileSystem object
-     * 
+     * @brief Initializes AWS SDK once per process. SDK is shut down at process exit,
+     * since it cannot be initialized and shut down concurrently by file systems used by parallel model loading.
      */
-    ~S3FileSystem();
+    static void initializeSdk();
 
     /**
      * @brief Check if given path or file exists
@@ -136,10 +137,20 @@ private:
     StatusCode parsePath(const std::string& path, std::string* bucket, std::string* object);
 
     /**
-     * @brief 
+     * @brief Download objects concurrently. Big objects are downloaded with multiple ranged requests.
+     * Unchanged objects are taken from download cache if enabled.
      * 
+     * @param filesToDownload pairs of remote object path and local file path
+     * @return StatusCode 
      */
-    Aws::SDKOptions options_;
+    StatusCode downloadFiles(const std::vector<std::pair<std::string, std::string>>& filesToDownload);
+
+    /**
+     * @brief Downloads object version with given ETag, fails when object was replaced since its metadata was read
+     */
+    StatusCode downloadObject(const std::string& bucket, const std::string& object, const std::string& etag, uint64_t size, const std::string& local_path);
+
+    StatusCode downloadObjectRange(const std::string& bucket, const std::string& object, const std::string& etag, const std::string& local_path, const byte_range_t& range);
 
     /**
      * @brief 
@@ -63,6 +63,65 @@ const std::string MODEL_CONFIG_DEFINITION = R"(
 				"allow_cache": {
 					"type": "boolean"
 				},
+				"max_shape_variants": {
+					"type": "integer",
+					"minimum": 0
+				},
+				"numa_node": {
+					"type": "integer",
+					"minimum": 0
+				},
+				"cpu_cores": {
+					"type": "string"
+				},
+				"priority": {
+					"type": "string",
+					"enum": ["LOW", "MEDIUM", "HIGH"]
+				},
+				"max_waiting_requests": {
+					"type": "integer",
+					"minimum": 0
+				},
+				"max_queue_wait_ms": {
+					"type": "integer",
+					"minimum": 0
+				},
+				"memory_limit_mb": {
+					"type": "integer",
+					"minimum": 0
+				},
+				"shape_buckets": {
+					"type": "object",
+					"additionalProperties": {
+						"type": "object",
+						"required": ["dim", "sizes"],
+						"properties": {
+							"dim": {
+								"type": "integer",
+								"minimum": 0
+							},
+							"sizes": {
+								"type": "array",
+								"minItems": 1,
+								"items": {
+									"type": "integer",
+									"minimum": 1
+								}
+							},
+							"pad_value": {
+								"type": "number"
+							},
+							"outputs": {
+								"type": "object",
+								"additionalProperties": {
+									"type": "integer",
+									"minimum": 0
+								}
+							}
+						},
+						"additionalProperties": false
+					}
+				},
 				"plugin_config": {
 					"type": "object",
 		"additionalProperties": {"anyOf": [
@@ -203,6 +262,10 @@ const std::string MODELS_CONFIG_SCHEMA = R"({
              },
              "subconfig": {
                  "type": "string"
+             },
+             "stream_max_in_flight_requests": {
+                 "type": "integer",
+                 "minimum": 1
              }
         },
         "additionalProperties": false
@@ -32,6 +32,10 @@ const sequence_memory_state_t& Sequence::getMemoryState() const {
     return memoryState;
 }
 
+size_t Sequence::getMemoryStateSize() const {
+    return memoryStateSize.load(std::memory_order_relaxed);
+}
+
 const bool Sequence::isIdle() const {
     return idle;
 }
@@ -51,6 +55,11 @@ Status Sequence::updateMemoryState(model_memory_state_t& newState) {
         }
         memoryState[stateName] = copyTensor;
     }
+    size_t size = 0;
+    for (const auto& [stateName, tensor] : memoryState) {
+        size += tensor.get_byte_size();
+    }
+    memoryStateSize.store(size, std::memory_order_relaxed);
     setIdle(false);
     return StatusCode::OK;
 }
@@ -15,6 +15,7 @@
 //*****************************************************************************
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <memory>
 #include <mutex>
@@ -36,6 +37,8 @@ class Sequence {
 private:
     uint64_t sequenceId;
     sequence_memory_state_t memoryState;
+    // Updated with memory state, so it can be read without waiting for sequence mutex
+    std::atomic<size_t> memoryStateSize{0};
     std::mutex mutex;
     bool terminated;
     bool idle;
@@ -46,6 +49,7 @@ public:
         terminated(false),
         idle(false) {}
     const sequence_memory_state_t& getMemoryState() const;
+    size_t getMemoryStateSize() const;
     const uint64_t getId() const;
     const bool isIdle() const;
     void setIdle(bool idle = true);
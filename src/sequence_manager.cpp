@@ -53,6 +53,15 @@ bool SequenceManager::sequenceExists(const uint64_t sequenceId) const {
     return sequences.find(sequenceId) != sequences.end();
 }
 
+size_t SequenceManager::getMemoryStateSize() {
+    std::unique_lock<std::mutex> sequenceManagerLock(mutex);
+    size_t size = 0;
+    for (const auto& [sequenceId, sequence] : sequences) {
+        size += sequence.getMemoryStateSize();
+    }
+    return size;
+}
+
 Status SequenceManager::removeIdleSequences() {
     std::unique_lock<std::mutex> sequenceManagerLock(mutex);
     for (auto it = sequences.begin(); it != sequences.end();) {
@@ -79,6 +79,9 @@ public:
 
     Status removeIdleSequences();
 
+    // Sum of memory state sizes of all sequences in bytes
+    size_t getMemoryStateSize();
+
     Status processRequestedSpec(SequenceProcessingSpec& sequenceProcessingSpec);
 };
 }  // namespace ovms
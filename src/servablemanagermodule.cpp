@@ -22,6 +22,7 @@
 #include "logging.hpp"
 #include "metric_module.hpp"
 #include "modelmanager.hpp"
+#include "s3filesystem.hpp"
 #include "server.hpp"
 #if (PYTHON_DISABLE == 0)
 #include "pythoninterpretermodule.hpp"
@@ -49,6 +50,8 @@ ServableManagerModule::ServableManagerModule(ovms::Server& ovmsServer) {
 Status ServableManagerModule::start(const ovms::Config& config) {
     state = ModuleState::STARTED_INITIALIZE;
     SPDLOG_INFO("{} starting", SERVABLE_MANAGER_MODULE_NAME);
+    // Models are loaded in parallel, so cloud storage SDKs are initialized before any of them is used
+    S3FileSystem::initializeSdk();
     auto status = getServableManager().start(config);
     if (status.ok()) {
         state = ModuleState::INITIALIZED;
@@ -51,6 +51,8 @@
 #include "profilermodule.hpp"
 #include "servablemanagermodule.hpp"
 #include "stringutils.hpp"
+#include "systeminfo.hpp"
+#include "tracer.hpp"
 #include "version.hpp"
 
 #if (PYTHON_DISABLE == 0)
@@ -81,6 +83,7 @@ static void logConfig(const Config& config) {
     std::string project_version(PROJECT_VERSION);
     SPDLOG_INFO(project_name + " " + project_version);
     SPDLOG_INFO("OpenVINO backend {}", OPENVINO_NAME);
+    SPDLOG_INFO("CPU topology: {}", numaTopologyToString(getNumaTopology()));
     SPDLOG_DEBUG("CLI parameters passed to ovms server");
     if (config.configPath().empty()) {
         SPDLOG_DEBUG("model_path: {}", config.modelPath());
@@ -371,6 +374,7 @@ Status Server::start(ServerSettingsImpl* serverSettings, ModelsSettingsImpl* mod
             return StatusCode::OPTIONS_USAGE_ERROR;
         configure_logger(config.logLevel(), config.logPath());
         logConfig(config);
+        Tracer::instance().setSamplingRate(config.traceSamplingRate());
         return this->startModules(config, withPython);
     } catch (std::exception& e) {
         SPDLOG_ERROR("Exception catch: {} - will now terminate.", e.what());
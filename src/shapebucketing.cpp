@@ -0,0 +1,215 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "shapebucketing.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <numeric>
+
+#include "deserialization.hpp"
+#include "logging.hpp"
+#include "profiler.hpp"
+#include "serialization.hpp"
+#include "status.hpp"
+
+namespace ovms {
+
+std::optional<dimension_value_t> ShapeBuckets::getBucket(dimension_value_t size) const {
+    auto it = std::lower_bound(sizes.begin(), sizes.end(), size);
+    if (it == sizes.end()) {
+        return std::nullopt;
+    }
+    return *it;
+}
+
+template <typename T>
+static void fill(ov::Tensor& tensor, double value) {
+    T* data = static_cast<T*>(tensor.data());
+    std::fill(data, data + tensor.get_size(), static_cast<T>(value));
+}
+
+static Status fillTensor(ov::Tensor& tensor, double value) {
+    switch (tensor.get_element_type()) {
+    case ov::element::Type_t::f64:
+        fill<double>(tensor, value);
+        break;
+    case ov::element::Type_t::f32:
+        fill<float>(tensor, value);
+        break;
+    case ov::element::Type_t::f16:
+        fill<ov::float16>(tensor, value);
+        break;
+    case ov::element::Type_t::bf16:
+        fill<ov::bfloat16>(tensor, value);
+        break;
+    case ov::element::Type_t::i64:
+        fill<int64_t>(tensor, value);
+        break;
+    case ov::element::Type_t::i32:
+        fill<int32_t>(tensor, value);
+        break;
+    case ov::element::Type_t::i16:
+        fill<int16_t>(tensor, value);
+        break;
+    case ov::element::Type_t::i8:
+        fill<int8_t>(tensor, value);
+        break;
+    case ov::element::Type_t::u64:
+        fill<uint64_t>(tensor, value);
+        break;
+    case ov::element::Type_t::u32:
+        fill<uint32_t>(tensor, value);
+        break;
+    case ov::element::Type_t::u16:
+        fill<uint16_t>(tensor, value);
+        break;
+    case ov::element::Type_t::u8:
+    case ov::element::Type_t::boolean:
+        fill<uint8_t>(tensor, value);
+        break;
+    default:
+        SPDLOG_DEBUG("Padding is not supported for precision: {}", tensor.get_element_type().get_type_name());
+        return StatusCode::NOT_IMPLEMENTED;
+    }
+    return StatusCode::OK;
+}
+
+static size_t product(const ov::Shape& shape, size_t begin, size_t end) {
+    return std::accumulate(shape.begin() + begin, shape.begin() + end, size_t{1}, std::multiplies<size_t>());
+}
+
+// Copies tensor contents into tensor of the same rank which differs in single dimension, leaving the rest of destination untouched
+static void copyAlongDimension(const ov::Tensor& src, ov::Tensor& dst, size_t dimension) {
+    const ov::Shape& srcShape = src.get_shape();
+    const ov::Shape& dstShape = dst.get_shape();
+    const size_t elementSize = src.get_element_type().size();
+    const size_t outer = product(srcShape, 0, dimension);
+    const size_t srcChunk = product(srcShape, dimension, srcShape.size()) * elementSize;
+    const size_t dstChunk = product(dstShape, dimension, dstShape.size()) * elementSize;
+    const size_t copied = std::min(srcChunk, dstChunk);
+    const char* srcData = static_cast<const char*>(src.data());
+    char* dstData = static_cast<char*>(dst.data());
+    for (size_t i = 0; i < outer; ++i) {
+        std::memcpy(dstData + i * dstChunk, srcData + i * srcChunk, copied);
+    }
+}
+
+static bool isPaddingSupported(const ov::Tensor& tensor, size_t dimension) {
+    const auto& type = tensor.get_element_type();
+    return dimension < tensor.get_shape().size() && type.bitwidth() % 8 == 0;
+}
+
+Status padTensor(const ov::Tensor& tensor, size_t dimension, dimension_value_t paddedSize, double padValue, ov::Tensor& padded) {
+    OVMS_PROFILE_FUNCTION();
+    if (!isPaddingSupported(tensor, dimension) || static_cast<dimension_value_t>(tensor.get_shape()[dimension]) > paddedSize) {
+        SPDLOG_DEBUG("Cannot pad tensor with shape: {} in dimension: {} to size: {}", ov::PartialShape(tensor.get_shape()).to_string(), dimension, paddedSize);
+        return StatusCode::INVALID_SHAPE;
+    }
+    ov::Shape paddedShape = tensor.get_shape();
+    paddedShape[dimension] = paddedSize;
+    padded = ov::Tensor(tensor.get_element_type(), paddedShape);
+    auto status = fillTensor(padded, padValue);
+    if (!status.ok()) {
+        return status;
+    }
+    copyAlongDimension(tensor, padded, dimension);
+    return StatusCode::OK;
+}
+
+Status trimTensor(const ov::Tensor& tensor, size_t dimension, dimension_value_t size, ov::Tensor& trimmed) {
+    OVMS_PROFILE_FUNCTION();
+    if (!isPaddingSupported(tensor, dimension) || static_cast<dimension_value_t>(tensor.get_shape()[dimension]) < size) {
+        SPDLOG_DEBUG("Cannot trim tensor with shape: {} in dimension: {} to size: {}", ov::PartialShape(tensor.get_shape()).to_string(), dimension, size);
+        return StatusCode::INTERNAL_ERROR;
+    }
+    ov::Shape trimmedShape = tensor.get_shape();
+    trimmedShape[dimension] = size;
+    trimmed = ov::Tensor(tensor.get_element_type(), trimmedShape);
+    copyAlongDimension(tensor, trimmed, dimension);
+    return StatusCode::OK;
+}
+
+Shape getTrimmedOutputShape(const Shape& shape, const std::string& outputName, const shape_buckets_map_t& shapeBuckets) {
+    Shape trimmedShape = shape;
+    for (const auto& [inputName, buckets] : shapeBuckets) {
+        auto it = buckets.outputs.find(outputName);
+        if (it == buckets.outputs.end()) {
+            continue;
+        }
+        const size_t dimension = it->second;
+        if (dimension < trimmedShape.size() && trimmedShape[dimension].isStatic()) {
+            trimmedShape[dimension] = Dimension(1, trimmedShape[dimension].getStaticValue());
+        }
+    }
+    return trimmedShape;
+}
+
+template <>
+Status InputSink<BucketedInferRequest&>::give(const std::string& name, ov::Tensor& tensor) {
+    OVMS_PROFILE_FUNCTION();
+    auto it = requester.inputsPadding.find(name);
+    InputSink<ov::InferRequest&> sink(requester.inferRequest);
+    if (it == requester.inputsPadding.end()) {
+        return sink.give(name, tensor);
+    }
+    const auto& padding = it->second;
+    if (padding.dimension < tensor.get_shape().size() && static_cast<dimension_value_t>(tensor.get_shape()[padding.dimension]) == padding.paddedSize) {
+        return sink.give(name, tensor);
+    }
+    ov::Tensor padded;
+    auto status = padTensor(tensor, padding.dimension, padding.paddedSize, padding.padValue, padded);
+    if (!status.ok()) {
+        return status;
+    }
+    const dimension_value_t size = tensor.get_shape()[padding.dimension];
+    for (const auto& [outputName, outputDimension] : padding.outputs) {
+        auto [trimmingIt, inserted] = requester.outputsTrimming.emplace(outputName, OutputTrimming{outputDimension, size});
+        if (!inserted) {
+            // Output listed for several padded inputs is trimmed to the longest of them
+            trimmingIt->second.size = std::max(trimmingIt->second.size, size);
+        }
+    }
+    return sink.give(name, padded);
+}
+
+template <>
+Status OutputGetter<BucketedInferRequest&>::get(const std::string& name, ov::Tensor& tensor) {
+    OVMS_PROFILE_FUNCTION();
+    OutputGetter<ov::InferRequest&> getter(outputSource.inferRequest);
+    auto status = getter.get(name, tensor);
+    if (!status.ok()) {
+        return status;
+    }
+    auto it = outputSource.outputsTrimming.find(name);
+    if (it == outputSource.outputsTrimming.end()) {
+        return StatusCode::OK;
+    }
+    const auto& trimming = it->second;
+    const auto& shape = tensor.get_shape();
+    if (trimming.dimension >= shape.size() ||
+        static_cast<dimension_value_t>(shape[trimming.dimension]) <= trimming.size) {
+        return StatusCode::OK;
+    }
+    ov::Tensor trimmed;
+    status = trimTensor(tensor, trimming.dimension, trimming.size, trimmed);
+    if (!status.ok()) {
+        return status;
+    }
+    tensor = std::move(trimmed);
+    return StatusCode::OK;
+}
+}  // namespace ovms
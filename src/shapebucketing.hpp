@@ -0,0 +1,106 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <openvino/openvino.hpp>
+
+#include "shape.hpp"
+
+namespace ovms {
+class Status;
+
+/**
+ * @brief Sizes to which selected dimension of model input is padded. Model is compiled for bucket sizes only.
+ */
+struct ShapeBuckets {
+    size_t dimension = 0;
+    std::vector<dimension_value_t> sizes;  // ascending
+    double padValue = 0;
+    std::map<std::string, size_t> outputs;  // outputs trimmed back to request size, with their trimmed dimension
+
+    /**
+     * @brief Finds the smallest bucket which fits dimension of given size
+     */
+    std::optional<dimension_value_t> getBucket(dimension_value_t size) const;
+
+    dimension_value_t getMaxSize() const {
+        return sizes.empty() ? 0 : sizes.back();
+    }
+
+    bool operator==(const ShapeBuckets& rhs) const {
+        return dimension == rhs.dimension && sizes == rhs.sizes && padValue == rhs.padValue && outputs == rhs.outputs;
+    }
+    bool operator!=(const ShapeBuckets& rhs) const {
+        return !(*this == rhs);
+    }
+};
+
+using shape_buckets_map_t = std::map<std::string, ShapeBuckets>;
+
+/**
+ * @brief Padding applied to model input, keyed by model input name
+ */
+struct InputPadding {
+    size_t dimension;
+    dimension_value_t paddedSize;
+    double padValue;
+    std::map<std::string, size_t> outputs;  // keyed by model output name
+};
+
+/**
+ * @brief Output dimension trimmed back to request size of the padded input
+ */
+struct OutputTrimming {
+    size_t dimension;
+    dimension_value_t size;
+};
+
+/**
+ * @brief Creates copy of tensor with given dimension extended to paddedSize and filled with padValue
+ */
+Status padTensor(const ov::Tensor& tensor, size_t dimension, dimension_value_t paddedSize, double padValue, ov::Tensor& padded);
+
+/**
+ * @brief Creates copy of tensor with given dimension cut to size
+ */
+Status trimTensor(const ov::Tensor& tensor, size_t dimension, dimension_value_t size, ov::Tensor& trimmed);
+
+/**
+ * @brief Dimensions of outputs configured in shape buckets are reported as ranges, since outputs are trimmed to request size
+ *
+ * @param outputName output name as used in model config
+ */
+Shape getTrimmedOutputShape(const Shape& shape, const std::string& outputName, const shape_buckets_map_t& shapeBuckets);
+
+/**
+ * @brief Infer request of model with shape buckets. Inputs are padded to bucket sizes when given to the request
+ * and outputs are trimmed back to request sizes when taken from it.
+ */
+struct BucketedInferRequest {
+    ov::InferRequest& inferRequest;
+    const std::map<std::string, InputPadding>& inputsPadding;
+    std::map<std::string, OutputTrimming> outputsTrimming;
+
+    BucketedInferRequest(ov::InferRequest& inferRequest, const std::map<std::string, InputPadding>& inputsPadding) :
+        inferRequest(inferRequest),
+        inputsPadding(inputsPadding) {}
+};
+}  // namespace ovms
@@ -0,0 +1,101 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "sharedweights.hpp"
+
+#include <utility>
+
+#include <openssl/md5.h>
+
+#include "logging.hpp"
+
+namespace ovms {
+
+SharedWeights::SharedWeights(std::vector<uint8_t>&& buffer) :
+    buffer(std::move(buffer)) {}
+
+const std::string& SharedWeights::getHash() const {
+    std::call_once(hashFlag, [this]() {
+        unsigned char result[MD5_DIGEST_LENGTH];
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+        MD5(buffer.data(), buffer.size(), result);
+#pragma GCC diagnostic pop
+        hash = std::string(reinterpret_cast<char*>(result), MD5_DIGEST_LENGTH);
+    });
+    return hash;
+}
+
+ov::Tensor SharedWeights::getTensor() const {
+    return ov::Tensor(ov::element::u8, ov::Shape{buffer.size()}, const_cast<uint8_t*>(buffer.data()));
+}
+
+SharedWeightsRegistry& SharedWeightsRegistry::instance() {
+    static SharedWeightsRegistry instance;
+    return instance;
+}
+
+void SharedWeightsRegistry::removeExpired() {
+    for (auto it = entries.begin(); it != entries.end();) {
+        if (it->second.expired()) {
+            it = entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+std::shared_ptr<const SharedWeights> SharedWeightsRegistry::adopt(std::vector<uint8_t>&& buffer) {
+    auto weights = std::make_shared<const SharedWeights>(std::move(buffer));
+    std::vector<std::shared_ptr<const SharedWeights>> candidates;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        removeExpired();
+        auto range = entries.equal_range(weights->getSize());
+        for (auto it = range.first; it != range.second; ++it) {
+            auto candidate = it->second.lock();
+            if (candidate) {
+                candidates.emplace_back(std::move(candidate));
+            }
+        }
+    }
+    // Hashing is done without holding the lock so that parallel model loading is not serialized
+    for (auto& candidate : candidates) {
+        if (candidate->getHash() == weights->getHash()) {
+            SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Reusing already loaded model weights with identical content. Size: {} bytes", weights->getSize());
+            return candidate;
+        }
+    }
+    std::lock_guard<std::mutex> lock(mtx);
+    entries.emplace(weights->getSize(), weights);
+    return weights;
+}
+
+size_t SharedWeightsRegistry::getUniqueWeightsCount() {
+    std::lock_guard<std::mutex> lock(mtx);
+    removeExpired();
+    return entries.size();
+}
+
+size_t SharedWeightsRegistry::getUniqueWeightsBytes() {
+    std::lock_guard<std::mutex> lock(mtx);
+    removeExpired();
+    size_t bytes = 0;
+    for (const auto& [size, weights] : entries) {
+        bytes += size;
+    }
+    return bytes;
+}
+}  // namespace ovms
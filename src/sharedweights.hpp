@@ -0,0 +1,80 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <openvino/runtime/tensor.hpp>
+
+namespace ovms {
+
+/**
+ * @brief Read-only model weights buffer returned by custom loader, shared by all model instances with identical weights.
+ * Only custom loader buffers are deduplicated, weights of IR files read from disk are not tracked here.
+ */
+class SharedWeights {
+    const std::vector<uint8_t> buffer;
+    mutable std::once_flag hashFlag;
+    mutable std::string hash;
+
+public:
+    SharedWeights(std::vector<uint8_t>&& buffer);
+    SharedWeights(const SharedWeights&) = delete;
+    SharedWeights& operator=(const SharedWeights&) = delete;
+
+    const uint8_t* getData() const { return buffer.data(); }
+    size_t getSize() const { return buffer.size(); }
+
+    /**
+     * @brief MD5 of the content. Calculated on first use only.
+     */
+    const std::string& getHash() const;
+
+    /**
+     * @brief Tensor referencing shared memory. It does not own the memory so SharedWeights has to outlive ov::Model created with it.
+     */
+    ov::Tensor getTensor() const;
+};
+
+/**
+ * @brief Deduplicates custom loader weights across model instances.
+ * Weights are identified by content hash when another weights buffer of the same size is in use,
+ * so content is hashed only when there is a chance to share it.
+ * Entries are released when the last model instance using them is unloaded.
+ */
+class SharedWeightsRegistry {
+    std::mutex mtx;
+    std::multimap<size_t, std::weak_ptr<const SharedWeights>> entries;
+
+    void removeExpired();
+
+public:
+    static SharedWeightsRegistry& instance();
+
+    /**
+     * @brief Takes ownership of weights buffer or returns already used weights with the same content.
+     */
+    std::shared_ptr<const SharedWeights> adopt(std::vector<uint8_t>&& buffer);
+
+    size_t getUniqueWeightsCount();
+    size_t getUniqueWeightsBytes();
+};
+}  // namespace ovms
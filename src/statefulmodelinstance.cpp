@@ -131,6 +131,23 @@ Status StatefulModelInstance::loadModelImpl(const ModelConfig& config, const Dyn
     return ModelInstance::loadModelImpl(config, parameter);
 }
 
+void StatefulModelInstance::setMemoryGauges(bool enabled) {
+    ModelInstance::setMemoryGauges(enabled);
+    auto& memorySequenceState = this->getMetricReporter().memorySequenceState;
+    if (enabled && memorySequenceState && sequenceManager) {
+        // Gauge keeps sequence manager alive until it is detached
+        memorySequenceState->setValueProvider([sequenceManager = this->sequenceManager]() { return static_cast<double>(sequenceManager->getMemoryStateSize()); });
+    }
+}
+
+ModelMemoryUsage StatefulModelInstance::getMemoryUsage() const {
+    ModelMemoryUsage usage = ModelInstance::getMemoryUsage();
+    if (sequenceManager) {
+        usage.sequenceState = sequenceManager->getMemoryStateSize();
+    }
+    return usage;
+}
+
 Status StatefulModelInstance::loadOVCompiledModel(const ModelConfig& config) {
     if (performLowLatencyTransformation) {
         SPDLOG_LOGGER_DEBUG(modelmanager_logger, "[Model: {} version: {}] Performing Low Latency Transformation on the model", getName(), getVersion());
@@ -75,6 +75,8 @@ public:
 
     void cleanupFailedLoad() override;
 
+    ModelMemoryUsage getMemoryUsage() const override;
+
 protected:
     std::shared_ptr<SequenceManager> sequenceManager;
 
@@ -86,6 +88,8 @@ protected:
 
     Status loadOVCompiledModel(const ModelConfig& config) override;
 
+    void setMemoryGauges(bool enabled) override;
+
 public:
     template <typename RequestType>
     static const Status extractSpecialKeys(const RequestType* request, SequenceProcessingSpec& sequenceProcessingSpec);
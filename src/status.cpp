@@ -46,6 +46,7 @@ const std::unordered_map<const StatusCode, const std::string> Status::statusMess
     {StatusCode::ANONYMOUS_FIXED_SHAPE_NOT_ALLOWED, "Anonymous fixed shape is invalid for models with multiple inputs"},
     {StatusCode::ANONYMOUS_FIXED_LAYOUT_NOT_ALLOWED, "Anonymous fixed layout is invalid for models with multiple inputs"},
     {StatusCode::CANNOT_COMPILE_MODEL_INTO_TARGET_DEVICE, "Cannot compile model into target device"},
+    {StatusCode::MODEL_MEMORY_LIMIT_EXCEEDED, "Model memory usage exceeds configured memory limit"},
     {StatusCode::MODEL_MISSING, "Model with requested name and/or version is not found"},
     {StatusCode::MODEL_CONFIG_INVALID, "Model config is invalid"},
     {StatusCode::MODEL_NAME_MISSING, "Model with requested name is not found"},
@@ -100,6 +101,7 @@ const std::unordered_map<const StatusCode, const std::string> Status::statusMess
     {StatusCode::INVALID_DEVICE_ID, "Invalid input buffer device id"},
     {StatusCode::INVALID_STRING_INPUT, "Invalid string input"},
     {StatusCode::INVALID_STRING_MAX_SIZE_EXCEEDED, "Maximum 2D array after string conversion exceeded 1GB"},
+    {StatusCode::INVALID_PRIORITY, "Invalid request priority. Allowed values: LOW, MEDIUM, HIGH"},
     {StatusCode::INVALID_INPUT_FORMAT, "Inputs inside buffer does not match expected format."},
     {StatusCode::INVALID_PRECISION, "Invalid input precision"},
     {StatusCode::INVALID_VALUE_COUNT, "Invalid number of values in tensor proto container"},
@@ -113,6 +115,9 @@ const std::unordered_map<const StatusCode, const std::string> Status::statusMess
 
     // Inference
     {StatusCode::OV_INTERNAL_INFERENCE_ERROR, "Internal inference error"},
+    {StatusCode::INFER_QUEUE_OVERLOADED, "Model is overloaded, too many requests are waiting for inference"},
+    {StatusCode::REQUEST_DEADLINE_EXCEEDED, "Request deadline exceeded"},
+    {StatusCode::REQUEST_CANCELLED, "Request cancelled by client"},
 
     // Serialization
     {StatusCode::OV_UNSUPPORTED_SERIALIZATION_PRECISION, "Unsupported serialization precision"},
@@ -152,6 +157,7 @@ const std::unordered_map<const StatusCode, const std::string> Status::statusMess
     {StatusCode::REST_BINARY_DATA_SIZE_PARAMETER_INVALID, "binary_data_size parameter is invalid and cannot be parsed"},
     {StatusCode::REST_BINARY_BUFFER_EXCEEDED, "Received buffer size is smaller than binary_data_size parameter indicates"},
     {StatusCode::REST_INFERENCE_HEADER_CONTENT_LENGTH_INVALID, "Inference-Header-Content-Length header is invalid and couldn't be parsed"},
+    {StatusCode::REST_REQUEST_TIMEOUT_INVALID, "Request-Timeout-Ms header is invalid and couldn't be parsed"},
     {StatusCode::REST_CONTENTS_FIELD_NOT_EMPTY, "Request contains values both in binary data and in content value"},
 
     // Pipeline validation errors
@@ -319,5 +325,8 @@ const std::unordered_map<const StatusCode, const std::string> Status::statusMess
     {StatusCode::SERVER_ALREADY_STARTED, "Server has already started"},
     {StatusCode::SERVER_ALREADY_STARTING, "Server is already starting"},
     {StatusCode::MODULE_ALREADY_INSERTED, "Module already inserted"},
+
+    // Streaming
+    {StatusCode::STREAM_CLOSED_BEFORE_FIRST_REQUEST, "Client disconnected before sending first streaming request"},
 };
 }  // namespace ovms
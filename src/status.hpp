@@ -331,6 +331,19 @@ enum class StatusCode {
     SERVER_ALREADY_STARTING,
     MODULE_ALREADY_INSERTED,
 
+    // Streaming
+    STREAM_CLOSED_BEFORE_FIRST_REQUEST,
+
+    // Request scheduling
+    INVALID_PRIORITY,             /*!< Invalid request priority parameter */
+    INFER_QUEUE_OVERLOADED,       /*!< Request rejected by admission control of model infer requests queue */
+    REQUEST_DEADLINE_EXCEEDED,    /*!< Processing stopped since request deadline passed */
+    REQUEST_CANCELLED,            /*!< Processing stopped since client cancelled the request */
+    REST_REQUEST_TIMEOUT_INVALID, /*!< Request-Timeout-Ms header is invalid and cannot be parsed*/
+
+    // Model resources
+    MODEL_MEMORY_LIMIT_EXCEEDED, /*!< Model version memory usage exceeds memory_limit_mb */
+
     STATUS_CODE_END
 };
 
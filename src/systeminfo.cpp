@@ -15,19 +15,168 @@
 //*****************************************************************************
 #include "systeminfo.hpp"
 
+#include <algorithm>
+#include <filesystem>
 #include <fstream>
 #include <sstream>
 #include <string>
 #include <thread>
 
 #include <openvino/core/parallel.hpp>
+#include <pthread.h>
+#include <unistd.h>
 
 #include "logging.hpp"
 #include "status.hpp"
+#include "stringutils.hpp"
 
 namespace ovms {
 uint16_t getCoreCount() {
     // return parallel_get_num_threads();
     return std::thread::hardware_concurrency();
 }
+
+Status parseCoreList(const std::string& coreList, cpu_cores_t& cores) {
+    cores.clear();
+    std::string list = coreList;
+    erase_spaces(list);
+    if (list.empty()) {
+        return StatusCode::OK;
+    }
+    for (const auto& range : tokenize(list, ',')) {
+        auto bounds = tokenize(range, '-');
+        if (bounds.empty() || bounds.size() > 2) {
+            return Status(StatusCode::MODEL_CONFIG_INVALID, "Invalid core list: " + coreList);
+        }
+        auto first = stou32(bounds[0]);
+        auto last = bounds.size() == 2 ? stou32(bounds[1]) : first;
+        if (!first.has_value() || !last.has_value() || first.value() > last.value() || last.value() >= CPU_SETSIZE) {
+            return Status(StatusCode::MODEL_CONFIG_INVALID, "Invalid core list: " + coreList);
+        }
+        for (uint32_t core = first.value(); core <= last.value(); ++core) {
+            cores.push_back(static_cast<uint16_t>(core));
+        }
+    }
+    std::sort(cores.begin(), cores.end());
+    cores.erase(std::unique(cores.begin(), cores.end()), cores.end());
+    return StatusCode::OK;
+}
+
+std::string coreListToString(const cpu_cores_t& cores) {
+    std::stringstream ss;
+    for (size_t i = 0; i < cores.size();) {
+        size_t j = i;
+        while (j + 1 < cores.size() && cores[j + 1] == cores[j] + 1) {
+            ++j;
+        }
+        if (i > 0) {
+            ss << ",";
+        }
+        ss << cores[i];
+        if (j > i) {
+            ss << "-" << cores[j];
+        }
+        i = j + 1;
+    }
+    return ss.str();
+}
+
+static cpu_cores_t getProcessCores() {
+    cpu_cores_t cores;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) != 0) {
+        for (uint16_t core = 0; core < std::max<uint16_t>(getCoreCount(), 1); ++core) {
+            cores.push_back(core);
+        }
+        return cores;
+    }
+    for (uint16_t core = 0; core < CPU_SETSIZE; ++core) {
+        if (CPU_ISSET(core, &set)) {
+            cores.push_back(core);
+        }
+    }
+    return cores;
+}
+
+numa_topology_t getNumaTopology(const std::string& sysfsNodesPath) {
+    numa_topology_t topology;
+    const cpu_cores_t processCores = getProcessCores();
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(sysfsNodesPath, ec)) {
+        const std::string name = entry.path().filename().string();
+        if (name.rfind("node", 0) != 0) {
+            continue;
+        }
+        auto node = stou32(name.substr(4));
+        if (!node.has_value()) {
+            continue;
+        }
+        std::ifstream file(entry.path() / "cpulist");
+        std::string list;
+        std::getline(file, list);
+        cpu_cores_t nodeCores;
+        if (!parseCoreList(list, nodeCores).ok()) {
+            SPDLOG_LOGGER_WARN(modelmanager_logger, "Failed to parse cores of NUMA node: {}; list: {}", node.value(), list);
+            continue;
+        }
+        // Cores excluded from the process by cpuset are not usable for placement
+        cpu_cores_t availableCores;
+        std::set_intersection(nodeCores.begin(), nodeCores.end(), processCores.begin(), processCores.end(), std::back_inserter(availableCores));
+        if (!availableCores.empty()) {
+            topology[static_cast<uint16_t>(node.value())] = std::move(availableCores);
+        }
+    }
+    if (topology.empty()) {
+        topology[0] = processCores;
+    }
+    return topology;
+}
+
+std::string numaTopologyToString(const numa_topology_t& topology) {
+    std::stringstream ss;
+    for (const auto& [node, cores] : topology) {
+        if (ss.tellp() > 0) {
+            ss << "; ";
+        }
+        ss << "node " << node << ": cores " << coreListToString(cores);
+    }
+    return ss.str();
+}
+
+size_t getProcessResidentMemory() {
+    std::ifstream statm("/proc/self/statm");
+    size_t totalPages = 0;
+    size_t residentPages = 0;
+    if (!(statm >> totalPages >> residentPages)) {
+        return 0;
+    }
+    const long pageSize = sysconf(_SC_PAGESIZE);
+    return pageSize > 0 ? residentPages * static_cast<size_t>(pageSize) : 0;
+}
+
+CpuAffinityGuard::CpuAffinityGuard(const cpu_cores_t& cores) {
+    if (cores.empty()) {
+        return;
+    }
+    CPU_ZERO(&previous);
+    if (pthread_getaffinity_np(pthread_self(), sizeof(previous), &previous) != 0) {
+        return;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (auto core : cores) {
+        CPU_SET(core, &set);
+    }
+    applied = (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0);
+    if (!applied) {
+        SPDLOG_LOGGER_WARN(modelmanager_logger, "Failed to set thread affinity to cores: {}", coreListToString(cores));
+    }
+}
+
+CpuAffinityGuard::~CpuAffinityGuard() {
+    if (applied) {
+        pthread_setaffinity_np(pthread_self(), sizeof(previous), &previous);
+    }
+}
 }  // namespace ovms
@@ -14,12 +14,65 @@
 // limitations under the License.
 //*****************************************************************************
 #pragma once
+#include <stddef.h>
 #include <stdint.h>
 
+#include <map>
+#include <string>
+#include <vector>
+
+#include <sched.h>
+
 namespace ovms {
+class Status;
+
+using cpu_cores_t = std::vector<uint16_t>;
+using numa_topology_t = std::map<uint16_t, cpu_cores_t>;
+
 /**
  * @brief Get cpu core count on system. This can be limited by the container environment. In case of failure reading system constraints it will return total number of available cores. If it won't work the function will return 1
  * @return uint16_t Available number of cores in the system
  */
 uint16_t getCoreCount();
+
+/**
+ * @brief Parses list of cores in Linux cpulist format, e.g. "0-3,8,10-11". Resulting cores are sorted and unique.
+ */
+Status parseCoreList(const std::string& coreList, cpu_cores_t& cores);
+
+/**
+ * @brief Formats cores in Linux cpulist format
+ */
+std::string coreListToString(const cpu_cores_t& cores);
+
+/**
+ * @brief Reads NUMA nodes with cores available to the process from sysfs.
+ * In case topology is not exposed all available cores are reported as node 0.
+ */
+numa_topology_t getNumaTopology(const std::string& sysfsNodesPath = "/sys/devices/system/node");
+
+/**
+ * @brief Describes NUMA topology of the host for logging
+ */
+std::string numaTopologyToString(const numa_topology_t& topology);
+
+/**
+ * @brief Reads resident memory of the process in bytes from procfs. Returns 0 when it is not available.
+ */
+size_t getProcessResidentMemory();
+
+/**
+ * @brief Restricts calling thread to given cores for the guard lifetime.
+ * Memory first touched by the thread, e.g. buffers of infer requests created in the scope, is placed on the NUMA node of these cores.
+ */
+class CpuAffinityGuard {
+    cpu_set_t previous;
+    bool applied = false;
+
+public:
+    CpuAffinityGuard(const cpu_cores_t& cores);
+    ~CpuAffinityGuard();
+    CpuAffinityGuard(const CpuAffinityGuard&) = delete;
+    CpuAffinityGuard& operator=(const CpuAffinityGuard&) = delete;
+};
 }  // namespace ovms
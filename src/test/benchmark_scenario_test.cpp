@@ -0,0 +1,116 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../benchmark/benchmark_scenario.hpp"
+#include "../benchmark/latency_histogram.hpp"
+
+using namespace ovms::benchmark;
+
+TEST(LatencyHistogram, ExactBelowSubBucketCount) {
+    LatencyHistogram histogram;
+    for (uint64_t i = 1; i <= 1000; i++) {
+        histogram.record(i);
+    }
+    EXPECT_EQ(histogram.getCount(), 1000);
+    EXPECT_EQ(histogram.getMin(), 1);
+    EXPECT_EQ(histogram.getMax(), 1000);
+    EXPECT_DOUBLE_EQ(histogram.getMean(), 500.5);
+    EXPECT_EQ(histogram.getValueAtPercentile(50), 500);
+    EXPECT_EQ(histogram.getValueAtPercentile(99), 990);
+    EXPECT_EQ(histogram.getValueAtPercentile(100), 1000);
+}
+
+TEST(LatencyHistogram, RelativeErrorOfLargeValues) {
+    LatencyHistogram histogram;
+    for (uint64_t value : {5'000ULL, 123'456ULL, 60'000'000ULL, 3'600'000'000ULL}) {
+        LatencyHistogram single;
+        single.record(value);
+        single.record(1);
+        uint64_t reported = single.getValueAtPercentile(50);
+        EXPECT_EQ(reported, 1);
+        reported = single.getValueAtPercentile(100);
+        EXPECT_EQ(reported, value);
+        histogram.merge(single);
+    }
+    EXPECT_EQ(histogram.getCount(), 8);
+    uint64_t p75 = histogram.getValueAtPercentile(75);
+    EXPECT_GE(p75, 123'456ULL);
+    EXPECT_LE(p75, 123'456ULL * 1001 / 1000);
+}
+
+TEST(BenchmarkScenario, ParseInputs) {
+    auto inputs = parseInputs("a[1,3,224,224];b[1,10]");
+    ASSERT_EQ(inputs.size(), 2);
+    EXPECT_EQ(inputs[0].name, "a");
+    EXPECT_EQ(inputs[0].shape, signed_shape_t({1, 3, 224, 224}));
+    EXPECT_EQ(inputs[1].name, "b");
+    EXPECT_EQ(inputs[1].shape, signed_shape_t({1, 10}));
+    EXPECT_EQ(parseInputs("a[1,3],b[2]").size(), 2);
+    EXPECT_THROW(parseInputs("a[1,0]"), std::invalid_argument);
+    EXPECT_THROW(parseInputs("[1,2]"), std::invalid_argument);
+    EXPECT_THROW(parseInputs("a1,2]"), std::invalid_argument);
+}
+
+TEST(BenchmarkScenario, ParseScenario) {
+    auto scenario = parseScenario(R"({
+        "name": "mixed",
+        "config_path": "/ovms/src/test/c_api/config_dummy_dag.json",
+        "warmup_seconds": 1,
+        "duration_seconds": 5,
+        "seed": 7,
+        "streams": [
+            {"servable_name": "dummy", "inputs": [{"name": "b", "shape": [1, 10]}], "arrival": "POISSON", "rate": 100, "concurrency": 4},
+            {"servable_name": "pipeline1Dummy", "inputs": [{"name": "b", "shape": [1, 10], "datatype": "FP32"}], "mode": "RESET_REQUEST"}
+        ]
+    })");
+    EXPECT_EQ(scenario.name, "mixed");
+    EXPECT_EQ(scenario.seed, 7);
+    EXPECT_DOUBLE_EQ(scenario.durationSeconds, 5);
+    ASSERT_EQ(scenario.streams.size(), 2);
+    EXPECT_EQ(scenario.streams[0].arrival, ArrivalMode::POISSON);
+    EXPECT_EQ(scenario.streams[0].concurrency, 4);
+    EXPECT_EQ(scenario.streams[1].arrival, ArrivalMode::CLOSED);
+    EXPECT_EQ(scenario.streams[1].mode, WorkloadMode::RESET_REQUEST);
+    EXPECT_EQ(scenario.streams[1].inputs[0].datatype, OVMS_DATATYPE_FP32);
+}
+
+TEST(BenchmarkScenario, InvalidScenario) {
+    EXPECT_THROW(parseScenario("{"), std::invalid_argument);
+    EXPECT_THROW(parseScenario(R"({"streams": []})"), std::invalid_argument);
+    // open loop requires rate and duration
+    EXPECT_THROW(parseScenario(R"({"duration_seconds": 1, "streams": [{"servable_name": "dummy", "inputs": [{"name": "b", "shape": [1, 10]}], "arrival": "CONSTANT"}]})"), std::invalid_argument);
+    EXPECT_THROW(parseScenario(R"({"streams": [{"servable_name": "dummy", "inputs": [{"name": "b", "shape": [1, 10]}], "arrival": "CONSTANT", "rate": 10}]})"), std::invalid_argument);
+    EXPECT_THROW(parseScenario(R"({"streams": [{"servable_name": "dummy", "inputs": [{"name": "b", "shape": [1, 10], "datatype": "FP33"}], "niter": 10}]})"), std::invalid_argument);
+}
+
+TEST(BenchmarkScenario, ArrivalSchedule) {
+    auto constant = createArrivalSchedule(ArrivalMode::CONSTANT, 100, 2, 0);
+    ASSERT_EQ(constant.size(), 200);
+    EXPECT_EQ(constant[1] - constant[0], 10'000);
+    auto poisson = createArrivalSchedule(ArrivalMode::POISSON, 1000, 10, 42);
+    EXPECT_TRUE(std::is_sorted(poisson.begin(), poisson.end()));
+    // Number of Poisson arrivals stays within 5 standard deviations of expected 10000
+    EXPECT_NEAR(poisson.size(), 10'000, 500);
+    EXPECT_EQ(poisson, createArrivalSchedule(ArrivalMode::POISSON, 1000, 10, 42));
+    EXPECT_TRUE(createArrivalSchedule(ArrivalMode::CLOSED, 1000, 10, 42).empty());
+}
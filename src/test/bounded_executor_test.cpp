@@ -0,0 +1,66 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "../bounded_executor.hpp"
+
+using namespace ovms;
+
+TEST(BoundedExecutor, ExecutesAllSubmittedTasks) {
+    std::atomic<size_t> executed{0};
+    {
+        BoundedExecutor executor(4, 2);
+        EXPECT_EQ(executor.getThreadsCount(), 4);
+        for (size_t i = 0; i < 100; ++i) {
+            executor.submit([&executed]() { ++executed; });
+        }
+    }
+    EXPECT_EQ(executed, 100);
+}
+
+TEST(BoundedExecutor, SubmitBlocksWhenQueueIsFull) {
+    std::mutex mtx;
+    std::condition_variable cv;
+    bool released = false;
+    BoundedExecutor executor(1, 1);
+    auto blockingTask = [&]() {
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait(lock, [&]() { return released; });
+    };
+    // First task occupies the only thread, second one fills the queue
+    executor.submit(blockingTask);
+    executor.submit(blockingTask);
+    std::atomic<bool> thirdSubmitted{false};
+    std::thread producer([&]() {
+        executor.submit([]() {});
+        thirdSubmitted = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_FALSE(thirdSubmitted);
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        released = true;
+    }
+    cv.notify_all();
+    producer.join();
+    EXPECT_TRUE(thirdSubmitted);
+}
@@ -90,9 +90,13 @@ TEST(CAPIConfigTest, MultiModelConfiguration) {
     EXPECT_EQ(serverSettings->grpcMaxThreads, std::nullopt);
     EXPECT_EQ(serverSettings->grpcMemoryQuota, std::nullopt);
     EXPECT_EQ(serverSettings->filesystemPollWaitSeconds, 1);
+    EXPECT_EQ(serverSettings->filesystemEventsEnabled, false);
     EXPECT_EQ(serverSettings->sequenceCleanerPollWaitMinutes, 5);
     EXPECT_EQ(serverSettings->resourcesCleanerPollWaitSeconds, 1);
+    EXPECT_EQ(serverSettings->modelLoadingThreads, 1);
+    EXPECT_EQ(serverSettings->modelLoadingMemoryBudgetMB, 0);
     EXPECT_EQ(serverSettings->cacheDir, "");
+    EXPECT_EQ(serverSettings->precompileStagedVersions, false);
 
     testDefaultSingleModelOptions(modelsSettings);
     EXPECT_EQ(modelsSettings->configPath, "");
@@ -108,10 +112,14 @@ TEST(CAPIConfigTest, MultiModelConfiguration) {
     ASSERT_CAPI_STATUS_NULL(OVMS_ServerSettingsSetGrpcMaxThreads(_serverSettings, 100));
     ASSERT_CAPI_STATUS_NULL(OVMS_ServerSettingsSetGrpcMemoryQuota(_serverSettings, (size_t)1000000));
     ASSERT_CAPI_STATUS_NULL(OVMS_ServerSettingsSetFileSystemPollWaitSeconds(_serverSettings, 2));
+    ASSERT_CAPI_STATUS_NULL(OVMS_ServerSettingsSetFileSystemEventsEnabled(_serverSettings, true));
     ASSERT_CAPI_STATUS_NULL(OVMS_ServerSettingsSetSequenceCleanerPollWaitMinutes(_serverSettings, 3));
     ASSERT_CAPI_STATUS_NULL(OVMS_ServerSettingsSetCustomNodeResourcesCleanerIntervalSeconds(_serverSettings, 4));
+    ASSERT_CAPI_STATUS_NULL(OVMS_ServerSettingsSetModelLoadingThreads(_serverSettings, 5));
+    ASSERT_CAPI_STATUS_NULL(OVMS_ServerSettingsSetModelLoadingMemoryBudgetMB(_serverSettings, 1024));
     ASSERT_CAPI_STATUS_NULL(OVMS_ServerSettingsSetCpuExtensionPath(_serverSettings, "/ovms/src/test"));
     ASSERT_CAPI_STATUS_NULL(OVMS_ServerSettingsSetCacheDir(_serverSettings, "/tmp/cache"));
+    ASSERT_CAPI_STATUS_NULL(OVMS_ServerSettingsSetPrecompileStagedVersions(_serverSettings, true));
     ASSERT_CAPI_STATUS_NULL(OVMS_ServerSettingsSetLogLevel(_serverSettings, OVMS_LOG_INFO));
     ASSERT_CAPI_STATUS_NULL(OVMS_ServerSettingsSetLogLevel(_serverSettings, OVMS_LOG_ERROR));
     ASSERT_CAPI_STATUS_NULL(OVMS_ServerSettingsSetLogLevel(_serverSettings, OVMS_LOG_DEBUG));
@@ -134,12 +142,16 @@ TEST(CAPIConfigTest, MultiModelConfiguration) {
     ASSERT_CAPI_STATUS_NOT_NULL_EXPECT_CODE(OVMS_ServerSettingsSetGrpcMaxThreads(nullptr, 100), StatusCode::NONEXISTENT_PTR);
     ASSERT_CAPI_STATUS_NOT_NULL_EXPECT_CODE(OVMS_ServerSettingsSetGrpcMemoryQuota(nullptr, 1000000), StatusCode::NONEXISTENT_PTR);
     ASSERT_CAPI_STATUS_NOT_NULL_EXPECT_CODE(OVMS_ServerSettingsSetFileSystemPollWaitSeconds(nullptr, 2), StatusCode::NONEXISTENT_PTR);
+    ASSERT_CAPI_STATUS_NOT_NULL_EXPECT_CODE(OVMS_ServerSettingsSetFileSystemEventsEnabled(nullptr, true), StatusCode::NONEXISTENT_PTR);
     ASSERT_CAPI_STATUS_NOT_NULL_EXPECT_CODE(OVMS_ServerSettingsSetSequenceCleanerPollWaitMinutes(nullptr, 3), StatusCode::NONEXISTENT_PTR);
     ASSERT_CAPI_STATUS_NOT_NULL_EXPECT_CODE(OVMS_ServerSettingsSetCustomNodeResourcesCleanerIntervalSeconds(nullptr, 4), StatusCode::NONEXISTENT_PTR);
+    ASSERT_CAPI_STATUS_NOT_NULL_EXPECT_CODE(OVMS_ServerSettingsSetModelLoadingThreads(nullptr, 5), StatusCode::NONEXISTENT_PTR);
+    ASSERT_CAPI_STATUS_NOT_NULL_EXPECT_CODE(OVMS_ServerSettingsSetModelLoadingMemoryBudgetMB(nullptr, 1024), StatusCode::NONEXISTENT_PTR);
     ASSERT_CAPI_STATUS_NOT_NULL_EXPECT_CODE(OVMS_ServerSettingsSetCpuExtensionPath(nullptr, "/ovms/src/test"), StatusCode::NONEXISTENT_PTR);
     ASSERT_CAPI_STATUS_NOT_NULL_EXPECT_CODE(OVMS_ServerSettingsSetCpuExtensionPath(_serverSettings, nullptr), StatusCode::NONEXISTENT_PTR);
     ASSERT_CAPI_STATUS_NOT_NULL_EXPECT_CODE(OVMS_ServerSettingsSetCacheDir(nullptr, "/tmp/cache"), StatusCode::NONEXISTENT_PTR);
     ASSERT_CAPI_STATUS_NOT_NULL_EXPECT_CODE(OVMS_ServerSettingsSetCacheDir(_serverSettings, nullptr), StatusCode::NONEXISTENT_PTR);
+    ASSERT_CAPI_STATUS_NOT_NULL_EXPECT_CODE(OVMS_ServerSettingsSetPrecompileStagedVersions(nullptr, true), StatusCode::NONEXISTENT_PTR);
     ASSERT_CAPI_STATUS_NOT_NULL_EXPECT_CODE(OVMS_ServerSettingsSetLogLevel(nullptr, OVMS_LOG_TRACE), StatusCode::NONEXISTENT_PTR);
     ASSERT_CAPI_STATUS_NOT_NULL_EXPECT_CODE(OVMS_ServerSettingsSetLogPath(nullptr, "/logs"), StatusCode::NONEXISTENT_PTR);
     ASSERT_CAPI_STATUS_NOT_NULL_EXPECT_CODE(OVMS_ServerSettingsSetLogPath(_serverSettings, nullptr), StatusCode::NONEXISTENT_PTR);
@@ -163,9 +175,13 @@ TEST(CAPIConfigTest, MultiModelConfiguration) {
     EXPECT_EQ(serverSettings->grpcMaxThreads, 100);
     EXPECT_EQ(serverSettings->grpcMemoryQuota, (size_t)1000000);
     EXPECT_EQ(serverSettings->filesystemPollWaitSeconds, 2);
+    EXPECT_EQ(serverSettings->filesystemEventsEnabled, true);
     EXPECT_EQ(serverSettings->sequenceCleanerPollWaitMinutes, 3);
     EXPECT_EQ(serverSettings->resourcesCleanerPollWaitSeconds, 4);
+    EXPECT_EQ(serverSettings->modelLoadingThreads, 5);
+    EXPECT_EQ(serverSettings->modelLoadingMemoryBudgetMB, 1024);
     EXPECT_EQ(serverSettings->cacheDir, "/tmp/cache");
+    EXPECT_EQ(serverSettings->precompileStagedVersions, true);
 
     testDefaultSingleModelOptions(modelsSettings);
     EXPECT_EQ(modelsSettings->configPath, "/config");
@@ -187,9 +203,13 @@ TEST(CAPIConfigTest, MultiModelConfiguration) {
     // trace path  // not tested since it is not supported in C-API
     EXPECT_EQ(cfg.grpcChannelArguments(), "grpcargs");
     EXPECT_EQ(cfg.filesystemPollWaitSeconds(), 2);
+    EXPECT_EQ(cfg.filesystemEventsEnabled(), true);
     EXPECT_EQ(cfg.sequenceCleanerPollWaitMinutes(), 3);
     EXPECT_EQ(cfg.resourcesCleanerPollWaitSeconds(), 4);
+    EXPECT_EQ(cfg.modelLoadingThreads(), 5);
+    EXPECT_EQ(cfg.modelLoadingMemoryBudgetMB(), 1024);
     EXPECT_EQ(cfg.cacheDir(), "/tmp/cache");
+    EXPECT_EQ(cfg.precompileStagedVersions(), true);
 
     EXPECT_EQ(cfg.modelName(), "");
     EXPECT_EQ(cfg.modelPath(), "");
@@ -1245,6 +1265,7 @@ public:
         MockModel(const std::string& name, std::shared_ptr<ModelInstance> instance) :
             Model(name, false /*stateful*/, nullptr) {
             modelVersions.insert({instance->getVersion(), instance});
+            publishVersionsSnapshot();
         }
     };
     class MockModelManager : public ModelManager {
@@ -1255,6 +1276,7 @@ public:
             CAPIState::modelInstance = std::make_shared<MockModelInstanceChangingStates>(servableName, 1, ieCore);
             std::shared_ptr<MockModel> model = std::make_shared<MockModel>(servableName, modelInstance);
             models[servableName] = model;
+            publishModelsSnapshot();
         }
     };
     class MockGrpcServerModule : public Module {
@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstring>
 #include <filesystem>
 #include <memory>
 #include <string>
@@ -77,7 +78,7 @@ protected:
         tensorShape->Clear();
         tensorShape->add_dim()->set_size(1);
         tensorShape->add_dim()->set_size(DUMMY_MODEL_INPUT_SIZE);
-        *(tensorProto.mutable_tensor_content()) = std::string(1 * sizeof(float) * DUMMY_MODEL_INPUT_SIZE, '1');
+        *(tensorProto.mutable_tensor_content()) = std::string(1 * tensorflow::DataTypeSize(dataType) * DUMMY_MODEL_INPUT_SIZE, '1');
     }
     TFTensorProto tensorProto;
     const char* tensorName = DUMMY_MODEL_INPUT_NAME;
@@ -298,6 +299,34 @@ TEST_P(DeserializeTFTensorProto, ShouldReturnValidTensor) {
                               << " should return valid tensor ptr";
     EXPECT_EQ(ovElementTypeToOvmsPrecision(tensor.get_element_type()), testedPrecision);
 }
+TEST_F(TensorflowGRPCPredict, ShouldWrapTensorContentMatchingTensorInfo) {
+    ov::Tensor tensor = deserializeTensorProto<ConcreteTensorProtoDeserializator>(tensorProto, tensorMap[tensorName]);
+    ASSERT_TRUE((bool)tensor);
+    EXPECT_EQ(tensor.data(), reinterpret_cast<const void*>(tensorProto.tensor_content().data()));
+}
+
+TEST_F(TensorflowGRPCPredict, ShouldRejectTensorContentOnPrecisionMismatch) {
+    tensorProto.set_dtype(tensorflow::DataType::DT_INT32);
+    ov::Tensor tensor = deserializeTensorProto<ConcreteTensorProtoDeserializator>(tensorProto, tensorMap[tensorName]);
+    EXPECT_FALSE((bool)tensor);
+    EXPECT_EQ(validateTensorContent(tensorProto, tensorMap[tensorName]), ovms::StatusCode::INVALID_PRECISION);
+}
+
+TEST_F(TensorflowGRPCPredict, ShouldRejectTensorContentOnSizeMismatch) {
+    tensorProto.mutable_tensor_content()->pop_back();
+    ov::Tensor tensor = deserializeTensorProto<ConcreteTensorProtoDeserializator>(tensorProto, tensorMap[tensorName]);
+    EXPECT_FALSE((bool)tensor);
+    EXPECT_EQ(validateTensorContent(tensorProto, tensorMap[tensorName]), ovms::StatusCode::INVALID_CONTENT_SIZE);
+}
+
+TEST_F(GRPCPredictRequestNegative, ShouldReturnInvalidContentSizeForTensorContentSizeMismatch) {
+    (*request.mutable_inputs())[tensorName].mutable_tensor_content()->append(sizeof(float), '1');
+    ov::InferRequest inferRequest;
+    InputSink<ov::InferRequest&> inputSink(inferRequest);
+    auto status = deserializePredictRequest<ConcreteTensorProtoDeserializator>(request, tensorMap, inputSink, isPipeline);
+    EXPECT_EQ(status, ovms::StatusCode::INVALID_CONTENT_SIZE) << status.string();
+}
+
 TEST_P(DeserializeCAPITensor, ShouldReturnValidTensor) {
     ovms::Precision testedPrecision = GetParam();
     SetUpTensorProto(getPrecisionAsOVMSDataType(testedPrecision));
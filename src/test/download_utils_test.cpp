@@ -0,0 +1,166 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../download_utils.hpp"
+#include "test_utils.hpp"
+
+using namespace ovms;
+
+static std::string readFile(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    std::stringstream ss;
+    ss << file.rdbuf();
+    return ss.str();
+}
+
+TEST(DownloadUtils, SmallObjectIsNotSplit) {
+    auto ranges = splitIntoDownloadRanges(RANGED_DOWNLOAD_MIN_FILE_SIZE - 1);
+    ASSERT_EQ(ranges.size(), 1);
+    EXPECT_EQ(ranges[0], byte_range_t(0, RANGED_DOWNLOAD_MIN_FILE_SIZE - 2));
+    EXPECT_TRUE(splitIntoDownloadRanges(0).empty());
+}
+
+TEST(DownloadUtils, BigObjectIsSplitIntoRanges) {
+    const uint64_t size = RANGED_DOWNLOAD_MIN_FILE_SIZE + 10;
+    const uint64_t partSize = RANGED_DOWNLOAD_MIN_FILE_SIZE / 2;
+    auto ranges = splitIntoDownloadRanges(size, partSize);
+    ASSERT_EQ(ranges.size(), 3);
+    EXPECT_EQ(ranges[0], byte_range_t(0, partSize - 1));
+    EXPECT_EQ(ranges[1], byte_range_t(partSize, 2 * partSize - 1));
+    EXPECT_EQ(ranges[2], byte_range_t(2 * partSize, size - 1));
+}
+
+TEST(DownloadUtils, RunDownloadTasksRunsAllTasks) {
+    std::atomic<int> counter{0};
+    std::vector<download_task_t> tasks(20, [&counter]() { ++counter; return StatusCode::OK; });
+    EXPECT_EQ(runDownloadTasks(tasks, 4), StatusCode::OK);
+    EXPECT_EQ(counter, 20);
+}
+
+TEST(DownloadUtils, RunDownloadTasksReturnsError) {
+    std::vector<download_task_t> tasks(5, []() { return StatusCode::OK; });
+    tasks.emplace_back([]() { return StatusCode::S3_FAILED_GET_OBJECT; });
+    tasks.emplace_back([]() -> StatusCode { throw std::runtime_error("error"); });
+    auto status = runDownloadTasks(tasks, 1);
+    EXPECT_EQ(status, StatusCode::S3_FAILED_GET_OBJECT);
+    status = runDownloadTasks(tasks, 3);
+    EXPECT_TRUE(status == StatusCode::S3_FAILED_GET_OBJECT || status == StatusCode::FILESYSTEM_ERROR) << Status(status).string();
+}
+
+class DownloadUtilsWithTempDir : public TestWithTempDir {};
+
+TEST_F(DownloadUtilsWithTempDir, RangesWrittenIntoPreallocatedFile) {
+    const std::string path = directoryPath + "/file";
+    ASSERT_EQ(createFileOfSize(path, 8), StatusCode::OK);
+    std::vector<download_task_t> tasks;
+    tasks.emplace_back([&path]() { return writeFileRange(path, 4, "efgh", 4); });
+    tasks.emplace_back([&path]() { return writeFileRange(path, 0, "abcd", 4); });
+    ASSERT_EQ(runDownloadTasks(tasks, 2), StatusCode::OK);
+    EXPECT_EQ(readFile(path), "abcdefgh");
+}
+
+TEST_F(DownloadUtilsWithTempDir, StreamWrittenIntoFile) {
+    const std::string path = directoryPath + "/file";
+    std::istringstream body("content");
+    ASSERT_EQ(writeStreamToFile(body, path, 7, StatusCode::S3_FAILED_GET_OBJECT), StatusCode::OK);
+    EXPECT_EQ(readFile(path), "content");
+    EXPECT_EQ(checkDownloadedFileSize(path, 7), StatusCode::OK);
+    std::istringstream emptyBody("");
+    ASSERT_EQ(writeStreamToFile(emptyBody, path, 0, StatusCode::S3_FAILED_GET_OBJECT), StatusCode::OK);
+    EXPECT_EQ(checkDownloadedFileSize(path, 0), StatusCode::OK);
+}
+
+TEST_F(DownloadUtilsWithTempDir, StreamOfUnexpectedSizeIsRejected) {
+    const std::string path = directoryPath + "/file";
+    std::istringstream truncatedBody("cont");
+    EXPECT_EQ(writeStreamToFile(truncatedBody, path, 7, StatusCode::GCS_FAILED_GET_OBJECT), StatusCode::GCS_FAILED_GET_OBJECT);
+    EXPECT_EQ(checkDownloadedFileSize(path, 7), StatusCode::FILESYSTEM_ERROR);
+    std::istringstream longerBody("content and more");
+    EXPECT_EQ(writeStreamToFile(longerBody, path, 7, StatusCode::GCS_FAILED_GET_OBJECT), StatusCode::GCS_FAILED_GET_OBJECT);
+    std::istringstream body("content");
+    EXPECT_EQ(writeStreamToFile(body, directoryPath + "/missing/file", 7, StatusCode::GCS_FAILED_GET_OBJECT), StatusCode::FILESYSTEM_ERROR);
+    EXPECT_EQ(checkDownloadedFileSize(directoryPath + "/missing/file", 7), StatusCode::FILESYSTEM_ERROR);
+}
+
+TEST_F(DownloadUtilsWithTempDir, CacheHitAfterStore) {
+    DownloadCache cache(directoryPath + "/cache");
+    ASSERT_TRUE(cache.isEnabled());
+    const std::string downloaded = directoryPath + "/downloaded";
+    const std::string fetched = directoryPath + "/fetched";
+    const std::string key = DownloadCache::createKey("s3://bucket/model/1/model.bin", "etag1");
+    EXPECT_FALSE(cache.fetch(key, fetched));
+    std::ofstream(downloaded) << "content";
+    cache.store(key, downloaded);
+    ASSERT_TRUE(cache.fetch(key, fetched));
+    EXPECT_EQ(readFile(fetched), "content");
+}
+
+TEST_F(DownloadUtilsWithTempDir, CacheMissForChangedObjectVersion) {
+    DownloadCache cache(directoryPath + "/cache");
+    const std::string downloaded = directoryPath + "/downloaded";
+    std::ofstream(downloaded) << "content";
+    cache.store(DownloadCache::createKey("s3://bucket/model/1/model.bin", "etag1"), downloaded);
+    EXPECT_FALSE(cache.fetch(DownloadCache::createKey("s3://bucket/model/1/model.bin", "etag2"), directoryPath + "/fetched"));
+}
+
+TEST_F(DownloadUtilsWithTempDir, DisabledCacheStoresNothing) {
+    DownloadCache cache("");
+    ASSERT_FALSE(cache.isEnabled());
+    const std::string downloaded = directoryPath + "/downloaded";
+    std::ofstream(downloaded) << "content";
+    const std::string key = DownloadCache::createKey("s3://bucket/model/1/model.bin", "etag1");
+    cache.store(key, downloaded);
+    EXPECT_FALSE(cache.fetch(key, directoryPath + "/fetched"));
+}
+
+TEST_F(DownloadUtilsWithTempDir, CacheEvictsLeastRecentlyUsedEntries) {
+    DownloadCache cache(directoryPath + "/cache", 15);
+    auto storeFile = [&](const std::string& name, const std::string& content) {
+        const std::string downloaded = directoryPath + "/" + name;
+        std::ofstream(downloaded) << content;
+        cache.store(DownloadCache::createKey("s3://bucket/" + name, "etag"), downloaded);
+        // Entries are ordered by modification time
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    };
+    auto isCached = [&](const std::string& name) {
+        const std::string fetched = directoryPath + "/fetched_" + name;
+        std::filesystem::remove(fetched);
+        return cache.fetch(DownloadCache::createKey("s3://bucket/" + name, "etag"), fetched);
+    };
+    storeFile("a", "aaaaa");
+    storeFile("b", "bbbbb");
+    ASSERT_TRUE(isCached("a"));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    storeFile("c", "cccccc");
+    EXPECT_TRUE(isCached("a"));
+    EXPECT_FALSE(isCached("b"));
+    EXPECT_TRUE(isCached("c"));
+    // Entry bigger than the limit is kept until next one is stored
+    storeFile("d", std::string(20, 'd'));
+    EXPECT_TRUE(isCached("d"));
+    EXPECT_FALSE(isCached("a"));
+    EXPECT_FALSE(isCached("c"));
+}
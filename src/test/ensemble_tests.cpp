@@ -13,15 +13,19 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //*****************************************************************************
+#include <atomic>
+#include <chrono>
 #include <cstdio>
 #include <memory>
 #include <sstream>
+#include <thread>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <stdlib.h>
 
 #include "../dags/dl_node.hpp"
+#include "../dags/dlnodesession.hpp"
 #include "../dags/entry_node.hpp"
 #include "../dags/exit_node.hpp"
 #include "../dags/nodestreamidguard.hpp"
@@ -268,6 +272,94 @@ TYPED_TEST(EnsembleFlowBothApiTest, DummyModel) {
     this->checkDummyResponse(dummySeriallyConnectedCount, 1, pipelineName);
 }
 
+TYPED_TEST(EnsembleFlowBothApiTest, DummyModelDeadlineExceeded) {
+    ConstructorEnabledModelManager managerWithDummyModel;
+    managerWithDummyModel.reloadModelWithVersions(this->config);
+
+    const tensor_map_t inputsInfo{{this->customPipelineInputName, this->dagDummyModelInputTensorInfo}};
+    auto input_node = std::make_unique<EntryNode<typename TypeParam::first_type>>(&this->request, inputsInfo);
+    auto model_node = std::make_unique<DLNode>("dummy_node", this->dummyModelName, this->requestedModelVersion, managerWithDummyModel);
+    const tensor_map_t outputsInfo{{this->customPipelineOutputName, this->dagDummyModelOutputTensorInfo}};
+    std::set<std::string> gatherFromNode = {};
+    std::string pipelineName = "test_pipeline";
+    auto output_node = std::make_unique<ExitNode<typename TypeParam::second_type>>(&this->response, outputsInfo, gatherFromNode, true, pipelineName);
+    Pipeline pipeline(*input_node, *output_node, *this->reporter);
+    pipeline.connect(*input_node, *model_node, {{this->customPipelineInputName, DUMMY_MODEL_INPUT_NAME}});
+    pipeline.connect(*model_node, *output_node, {{DUMMY_MODEL_OUTPUT_NAME, this->customPipelineOutputName}});
+
+    pipeline.push(std::move(input_node));
+    pipeline.push(std::move(model_node));
+    pipeline.push(std::move(output_node));
+
+    ExecutionContext context = DEFAULT_TEST_CONTEXT;
+    context.deadline = std::chrono::steady_clock::now();
+    ASSERT_EQ(pipeline.execute(context), StatusCode::REQUEST_DEADLINE_EXCEEDED);
+}
+
+class DLNodeSessionCountingCancels : public DLNodeSession {
+    std::atomic<int>& cancelsCount;
+
+public:
+    DLNodeSessionCountingCancels(std::atomic<int>& cancelsCount, const NodeSessionMetadata& metadata, const std::string& nodeName, uint32_t inputsCount, const CollapseDetails& collapsingDetails, ModelManager& manager, const std::string& modelName, model_version_t modelVersion) :
+        DLNodeSession(metadata, nodeName, inputsCount, collapsingDetails, manager, modelName, modelVersion),
+        cancelsCount(cancelsCount) {}
+
+    void cancel() override {
+        cancelsCount++;
+        DLNodeSession::cancel();
+    }
+};
+
+class DLNodeCountingCancels : public DLNode {
+    const std::chrono::steady_clock::time_point returnAfter;
+
+public:
+    std::atomic<int> cancelsCount{0};
+
+    DLNodeCountingCancels(const std::string& nodeName, const std::string& modelName, std::optional<model_version_t> modelVersion, ModelManager& modelManager, std::chrono::steady_clock::time_point returnAfter) :
+        DLNode(nodeName, modelName, modelVersion, modelManager),
+        returnAfter(returnAfter) {}
+
+    ovms::Status execute(session_key_t sessionId, PipelineEventQueue& notifyEndQueue) override {
+        auto status = DLNode::execute(sessionId, notifyEndQueue);
+        std::this_thread::sleep_until(returnAfter);
+        return status;
+    }
+
+protected:
+    std::unique_ptr<NodeSession> createNodeSession(const NodeSessionMetadata& metadata, const CollapseDetails& collapsingDetails) override {
+        return std::make_unique<DLNodeSessionCountingCancels>(cancelsCount, metadata, getName(), previous.size(), collapsingDetails,
+            this->modelManager, this->modelName, this->modelVersion.value_or(0));
+    }
+};
+
+TYPED_TEST(EnsembleFlowBothApiTest, DummyModelDeadlineExceededDuringInference) {
+    ConstructorEnabledModelManager managerWithDummyModel;
+    managerWithDummyModel.reloadModelWithVersions(this->config);
+
+    const tensor_map_t inputsInfo{{this->customPipelineInputName, this->dagDummyModelInputTensorInfo}};
+    auto input_node = std::make_unique<EntryNode<typename TypeParam::first_type>>(&this->request, inputsInfo);
+    ExecutionContext context = DEFAULT_TEST_CONTEXT;
+    context.deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(500);
+    // Dummy node returns from execution after the deadline, so the pipeline finds it expired while the dummy node session is not released yet
+    auto model_node = std::make_unique<DLNodeCountingCancels>("dummy_node", this->dummyModelName, this->requestedModelVersion, managerWithDummyModel, context.deadline.value());
+    auto& modelNodeRef = *model_node;
+    const tensor_map_t outputsInfo{{this->customPipelineOutputName, this->dagDummyModelOutputTensorInfo}};
+    std::set<std::string> gatherFromNode = {};
+    std::string pipelineName = "test_pipeline";
+    auto output_node = std::make_unique<ExitNode<typename TypeParam::second_type>>(&this->response, outputsInfo, gatherFromNode, true, pipelineName);
+    Pipeline pipeline(*input_node, *output_node, *this->reporter);
+    pipeline.connect(*input_node, *model_node, {{this->customPipelineInputName, DUMMY_MODEL_INPUT_NAME}});
+    pipeline.connect(*model_node, *output_node, {{DUMMY_MODEL_OUTPUT_NAME, this->customPipelineOutputName}});
+
+    pipeline.push(std::move(input_node));
+    pipeline.push(std::move(model_node));
+    pipeline.push(std::move(output_node));
+
+    ASSERT_EQ(pipeline.execute(context), StatusCode::REQUEST_DEADLINE_EXCEEDED);
+    EXPECT_EQ(modelNodeRef.cancelsCount, 1);
+}
+
 TYPED_TEST(EnsembleFlowBothApiTest, ScalarModel) {
     // Most basic configuration, just process single scalar model request
     // input   scalar    output
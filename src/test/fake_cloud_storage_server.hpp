@@ -0,0 +1,381 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// Minimal HTTP server serving objects of a single bucket over S3 (path style addressing) or GCS (JSON and XML) API,
+// so that cloud file systems can be tested without access to real storage.
+class FakeCloudStorageServer {
+public:
+    enum class Protocol {
+        S3,
+        GCS
+    };
+
+    struct Object {
+        std::string content;
+        uint64_t generation;
+        std::string getETag() const { return "\"etag-" + std::to_string(generation) + "\""; }
+    };
+
+    explicit FakeCloudStorageServer(Protocol protocol) :
+        protocol(protocol) {
+        listenFd = ::socket(AF_INET, SOCK_STREAM, 0);
+        int enable = 1;
+        ::setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = 0;
+        ::bind(listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+        socklen_t length = sizeof(address);
+        ::getsockname(listenFd, reinterpret_cast<sockaddr*>(&address), &length);
+        port = ntohs(address.sin_port);
+        ::listen(listenFd, 64);
+        acceptThread = std::thread([this]() { acceptConnections(); });
+    }
+
+    ~FakeCloudStorageServer() {
+        stopped = true;
+        ::shutdown(listenFd, SHUT_RDWR);
+        ::close(listenFd);
+        acceptThread.join();
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            for (int fd : connectionFds) {
+                ::shutdown(fd, SHUT_RDWR);
+            }
+        }
+        for (auto& thread : connectionThreads) {
+            thread.join();
+        }
+    }
+
+    std::string getEndpoint() const { return "127.0.0.1:" + std::to_string(port); }
+
+    void putObject(const std::string& key, const std::string& content) {
+        std::lock_guard<std::mutex> lock(mtx);
+        objects[key] = Object{content, ++lastGeneration};
+    }
+
+    // Called after object metadata is sent, so that tests can replace object between metadata and data requests
+    void setAfterObjectMetadata(std::function<void(const std::string& key)> callback) {
+        std::lock_guard<std::mutex> lock(mtx);
+        afterObjectMetadata = std::move(callback);
+    }
+
+    // Number of object reads rejected because object version changed
+    size_t getVersionMismatches() const { return versionMismatches; }
+
+private:
+    struct Request {
+        std::string method;
+        std::string path;
+        std::map<std::string, std::string> query;
+        std::map<std::string, std::string> headers;
+    };
+
+    static std::string decode(const std::string& text) {
+        std::string result;
+        for (size_t i = 0; i < text.size(); ++i) {
+            if (text[i] == '%' && i + 2 < text.size()) {
+                result += static_cast<char>(std::stoi(text.substr(i + 1, 2), nullptr, 16));
+                i += 2;
+            } else {
+                result += text[i];
+            }
+        }
+        return result;
+    }
+
+    static bool readRequest(int fd, std::string& buffer, Request& request) {
+        size_t headerEnd;
+        while ((headerEnd = buffer.find("\r\n\r\n")) == std::string::npos) {
+            char data[4096];
+            ssize_t received = ::recv(fd, data, sizeof(data), 0);
+            if (received <= 0) {
+                return false;
+            }
+            buffer.append(data, received);
+        }
+        std::istringstream lines(buffer.substr(0, headerEnd));
+        buffer.erase(0, headerEnd + 4);
+        std::string line, target;
+        std::getline(lines, line);
+        std::istringstream(line) >> request.method >> target;
+        auto queryStart = target.find('?');
+        request.path = target.substr(0, queryStart);
+        if (queryStart != std::string::npos) {
+            std::istringstream params(target.substr(queryStart + 1));
+            std::string param;
+            while (std::getline(params, param, '&')) {
+                auto separator = param.find('=');
+                request.query[decode(param.substr(0, separator))] = separator == std::string::npos ? "" : decode(param.substr(separator + 1));
+            }
+        }
+        while (std::getline(lines, line)) {
+            if (!line.empty() && line.back() == '\r') {
+                line.pop_back();
+            }
+            auto separator = line.find(':');
+            if (separator == std::string::npos) {
+                continue;
+            }
+            std::string name = line.substr(0, separator);
+            std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+            auto valueStart = line.find_first_not_of(' ', separator + 1);
+            request.headers[name] = valueStart == std::string::npos ? "" : line.substr(valueStart);
+        }
+        // Requests sent by file systems have no body
+        return true;
+    }
+
+    static void sendResponse(int fd, int code, const std::string& reason, const std::vector<std::pair<std::string, std::string>>& headers, const std::string& body, size_t contentLength) {
+        std::string response = "HTTP/1.1 " + std::to_string(code) + " " + reason + "\r\n";
+        for (const auto& [name, value] : headers) {
+            response += name + ": " + value + "\r\n";
+        }
+        response += "Content-Length: " + std::to_string(contentLength) + "\r\n\r\n" + body;
+        size_t sent = 0;
+        while (sent < response.size()) {
+            ssize_t result = ::send(fd, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+            if (result <= 0) {
+                return;
+            }
+            sent += result;
+        }
+    }
+
+    static void sendNotFound(int fd) {
+        const std::string body = "{\"error\": {\"code\": 404, \"message\": \"Not Found\"}}";
+        sendResponse(fd, 404, "Not Found", {}, body, body.size());
+    }
+
+    std::optional<Object> getObject(const std::string& key) {
+        std::lock_guard<std::mutex> lock(mtx);
+        auto it = objects.find(key);
+        if (it == objects.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    std::vector<std::pair<std::string, Object>> listObjects(const std::string& prefix) {
+        std::vector<std::pair<std::string, Object>> result;
+        std::lock_guard<std::mutex> lock(mtx);
+        for (const auto& [key, object] : objects) {
+            if (key.rfind(prefix, 0) == 0) {
+                result.emplace_back(key, object);
+            }
+        }
+        return result;
+    }
+
+    void notifyObjectMetadata(const std::string& key) {
+        std::function<void(const std::string&)> callback;
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            callback = afterObjectMetadata;
+        }
+        if (callback) {
+            callback(key);
+        }
+    }
+
+    void sendContent(int fd, const Request& request, const Object& object, std::vector<std::pair<std::string, std::string>> headers) {
+        auto range = request.headers.find("range");
+        if (range == request.headers.end() || object.content.empty()) {
+            sendResponse(fd, 200, "OK", headers, object.content, object.content.size());
+            return;
+        }
+        // bytes=<first>-<last>
+        auto separator = range->second.find('-');
+        const size_t first = std::stoull(range->second.substr(6, separator - 6));
+        const std::string lastText = range->second.substr(separator + 1);
+        const size_t last = std::min<size_t>(lastText.empty() ? object.content.size() - 1 : std::stoull(lastText), object.content.size() - 1);
+        std::string body = object.content.substr(first, last - first + 1);
+        headers.emplace_back("Content-Range", "bytes " + std::to_string(first) + "-" + std::to_string(last) + "/" + std::to_string(object.content.size()));
+        sendResponse(fd, 206, "Partial Content", headers, body, body.size());
+    }
+
+    void handleS3Request(int fd, const Request& request) {
+        const std::string path = decode(request.path);
+        auto keyStart = path.find('/', 1);
+        const std::string bucket = path.substr(1, keyStart == std::string::npos ? std::string::npos : keyStart - 1);
+        const std::string key = keyStart == std::string::npos ? "" : path.substr(keyStart + 1);
+        if (key.empty()) {
+            std::string body;
+            if (request.method == "GET") {
+                const std::string prefix = request.query.count("prefix") ? request.query.at("prefix") : "";
+                body = "<?xml version=\"1.0\" encoding=\"UTF-8\"?><ListBucketResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\"><Name>" + bucket +
+                       "</Name><Prefix>" + prefix + "</Prefix><MaxKeys>1000</MaxKeys><IsTruncated>false</IsTruncated>";
+                for (const auto& [objectKey, object] : listObjects(prefix)) {
+                    body += "<Contents><Key>" + objectKey + "</Key><Size>" + std::to_string(object.content.size()) + "</Size><ETag>" + object.getETag() + "</ETag></Contents>";
+                }
+                body += "</ListBucketResult>";
+            }
+            sendResponse(fd, 200, "OK", {{"Content-Type", "application/xml"}}, body, body.size());
+            return;
+        }
+        auto object = getObject(key);
+        if (!object) {
+            sendResponse(fd, 404, "Not Found", {}, "", 0);
+            return;
+        }
+        if (request.method == "HEAD") {
+            sendResponse(fd, 200, "OK", {{"ETag", object->getETag()}}, "", object->content.size());
+            notifyObjectMetadata(key);
+            return;
+        }
+        auto ifMatch = request.headers.find("if-match");
+        if (ifMatch != request.headers.end() && ifMatch->second != object->getETag()) {
+            ++versionMismatches;
+            sendResponse(fd, 412, "Precondition Failed", {}, "", 0);
+            return;
+        }
+        sendContent(fd, request, *object, {{"ETag", object->getETag()}});
+    }
+
+    static std::string getGcsMetadata(const std::string& bucket, const std::string& key, const Object& object) {
+        return "{\"kind\": \"storage#object\", \"id\": \"" + bucket + "/" + key + "/" + std::to_string(object.generation) +
+               "\", \"name\": \"" + key + "\", \"bucket\": \"" + bucket + "\", \"generation\": \"" + std::to_string(object.generation) +
+               "\", \"metageneration\": \"1\", \"contentType\": \"application/octet-stream\", \"size\": \"" + std::to_string(object.content.size()) + "\"}";
+    }
+
+    void sendGcsMedia(int fd, const Request& request, const std::string& key) {
+        auto object = getObject(key);
+        if (!object) {
+            sendNotFound(fd);
+            return;
+        }
+        auto generation = request.query.find("generation");
+        if (generation != request.query.end() && generation->second != std::to_string(object->generation)) {
+            // Reading generation which is not live anymore fails in the same way as reading deleted object
+            ++versionMismatches;
+            sendNotFound(fd);
+            return;
+        }
+        sendContent(fd, request, *object, {{"x-goog-generation", std::to_string(object->generation)}, {"x-goog-metageneration", "1"}});
+    }
+
+    void handleGcsRequest(int fd, const Request& request) {
+        const std::string jsonPrefix = "/storage/v1/b/";
+        const std::string downloadPrefix = "/download/storage/v1/b/";
+        const std::string xmlPrefix = "/xmlapi/";
+        std::string path = request.path;
+        const bool download = path.rfind(downloadPrefix, 0) == 0;
+        if (download || path.rfind(jsonPrefix, 0) == 0) {
+            path = path.substr(download ? downloadPrefix.size() : jsonPrefix.size());
+            // <bucket>/o for listing, <bucket>/o/<object> for single object
+            auto bucketEnd = path.find('/');
+            const std::string bucket = decode(path.substr(0, bucketEnd));
+            const std::string objectPath = bucketEnd == std::string::npos ? "" : path.substr(bucketEnd + 1);
+            if (objectPath.size() <= 2) {
+                const std::string prefix = request.query.count("prefix") ? request.query.at("prefix") : "";
+                std::string body = "{\"kind\": \"storage#objects\", \"items\": [";
+                bool first = true;
+                for (const auto& [objectKey, object] : listObjects(prefix)) {
+                    body += (first ? "" : ", ") + getGcsMetadata(bucket, objectKey, object);
+                    first = false;
+                }
+                body += "]}";
+                sendResponse(fd, 200, "OK", {{"Content-Type", "application/json"}}, body, body.size());
+                return;
+            }
+            const std::string key = decode(objectPath.substr(2));
+            if (download || (request.query.count("alt") && request.query.at("alt") == "media")) {
+                sendGcsMedia(fd, request, key);
+                return;
+            }
+            auto object = getObject(key);
+            if (!object) {
+                sendNotFound(fd);
+                return;
+            }
+            const std::string body = getGcsMetadata(bucket, key, *object);
+            sendResponse(fd, 200, "OK", {{"Content-Type", "application/json"}}, body, body.size());
+            notifyObjectMetadata(key);
+            return;
+        }
+        // XML API download: /[xmlapi/]<bucket>/<object>
+        if (path.rfind(xmlPrefix, 0) == 0) {
+            path = path.substr(xmlPrefix.size() - 1);
+        }
+        auto keyStart = path.find('/', 1);
+        if (keyStart == std::string::npos) {
+            sendNotFound(fd);
+            return;
+        }
+        sendGcsMedia(fd, request, decode(path.substr(keyStart + 1)));
+    }
+
+    void serveConnection(int fd) {
+        std::string buffer;
+        Request request;
+        while (!stopped && readRequest(fd, buffer, request)) {
+            if (protocol == Protocol::S3) {
+                handleS3Request(fd, request);
+            } else {
+                handleGcsRequest(fd, request);
+            }
+            request = Request();
+        }
+        ::close(fd);
+    }
+
+    void acceptConnections() {
+        while (!stopped) {
+            int fd = ::accept(listenFd, nullptr, nullptr);
+            if (fd < 0) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(mtx);
+            connectionFds.push_back(fd);
+            connectionThreads.emplace_back([this, fd]() { serveConnection(fd); });
+        }
+    }
+
+    const Protocol protocol;
+    int listenFd;
+    uint16_t port;
+    std::atomic<bool> stopped{false};
+    std::atomic<size_t> versionMismatches{0};
+    std::thread acceptThread;
+    std::mutex mtx;
+    std::vector<int> connectionFds;
+    std::vector<std::thread> connectionThreads;
+    std::map<std::string, Object> objects;
+    uint64_t lastGeneration = 0;
+    std::function<void(const std::string& key)> afterObjectMetadata;
+};
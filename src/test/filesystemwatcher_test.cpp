@@ -0,0 +1,67 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "../filesystemwatcher.hpp"
+#include "test_utils.hpp"
+
+using namespace ovms;
+
+class FileSystemWatcherTest : public TestWithTempDir {
+protected:
+    FileSystemWatcher fsWatcher;
+    const std::chrono::milliseconds timeout{1000};
+    const std::chrono::milliseconds debounce{50};
+};
+
+TEST_F(FileSystemWatcherTest, NoChangesTimeout) {
+    ASSERT_TRUE(fsWatcher.isInitialized());
+    ASSERT_TRUE(fsWatcher.setWatchedDirectories({directoryPath}));
+    EXPECT_FALSE(fsWatcher.waitForChanges(std::chrono::milliseconds(10), debounce));
+}
+
+TEST_F(FileSystemWatcherTest, NewVersionDirectoryDetected) {
+    ASSERT_TRUE(fsWatcher.setWatchedDirectories({directoryPath}));
+    std::filesystem::create_directories(directoryPath + "/1");
+    EXPECT_TRUE(fsWatcher.waitForChanges(timeout, debounce));
+    EXPECT_FALSE(fsWatcher.waitForChanges(std::chrono::milliseconds(10), debounce));
+}
+
+TEST_F(FileSystemWatcherTest, FileWrittenInWatchedDirectoryDetected) {
+    std::filesystem::create_directories(directoryPath + "/1");
+    ASSERT_TRUE(fsWatcher.setWatchedDirectories({directoryPath, directoryPath + "/1"}));
+    std::ofstream(directoryPath + "/1/model.xml") << "content";
+    EXPECT_TRUE(fsWatcher.waitForChanges(timeout, debounce));
+}
+
+TEST_F(FileSystemWatcherTest, ChangesInUnwatchedDirectoryIgnored) {
+    std::filesystem::create_directories(directoryPath + "/watched");
+    std::filesystem::create_directories(directoryPath + "/unwatched");
+    ASSERT_TRUE(fsWatcher.setWatchedDirectories({directoryPath + "/watched", directoryPath + "/unwatched"}));
+    ASSERT_TRUE(fsWatcher.setWatchedDirectories({directoryPath + "/watched"}));
+    std::ofstream(directoryPath + "/unwatched/model.xml") << "content";
+    EXPECT_FALSE(fsWatcher.waitForChanges(std::chrono::milliseconds(100), debounce));
+}
+
+TEST_F(FileSystemWatcherTest, NonExistingDirectoryCannotBeWatched) {
+    EXPECT_FALSE(fsWatcher.setWatchedDirectories({directoryPath + "/non_existing"}));
+}
@@ -14,11 +14,17 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <atomic>
+#include <filesystem>
 #include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
 
 #include "spdlog/spdlog.h"
 
 #include "../gcsfilesystem.hpp"
+#include "fake_cloud_storage_server.hpp"
 #include "gtest/gtest.h"
 
 using namespace ovms;
@@ -140,3 +146,50 @@ TEST(DISABLED_GCSFileSystem, file_details) {
     check_file_access(getPrivateFilePath(), fs.get());
     check_dir_access(getPrivateDirPath(), fs.get());
 }
+
+class GCSFileSystemWithFakeServer : public ::testing::Test {
+protected:
+    void SetUp() override {
+        server = std::make_unique<FakeCloudStorageServer>(FakeCloudStorageServer::Protocol::GCS);
+        auto credentials = google::cloud::storage::v1::oauth2::CreateAnonymousCredentials();
+        google::cloud::storage::ClientOptions options(credentials);
+        options.set_endpoint("http://" + server->getEndpoint());
+        fs = std::make_unique<ovms::GCSFileSystem>(options);
+    }
+
+    static std::string readFile(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        std::stringstream ss;
+        ss << file.rdbuf();
+        return ss.str();
+    }
+
+    std::unique_ptr<FakeCloudStorageServer> server;
+    std::unique_ptr<ovms::GCSFileSystem> fs;
+};
+
+TEST_F(GCSFileSystemWithFakeServer, DownloadModelVersion) {
+    server->putObject("model/1/model.xml", "xml");
+    server->putObject("model/1/model.bin", "weights");
+    std::string localPath;
+    ASSERT_EQ(fs->downloadModelVersions("gs://bucket/model", &localPath, {1}), ovms::StatusCode::OK);
+    EXPECT_EQ(readFile(localPath + "/1/model.xml"), "xml");
+    EXPECT_EQ(readFile(localPath + "/1/model.bin"), "weights");
+    std::filesystem::remove_all(localPath);
+}
+
+TEST_F(GCSFileSystemWithFakeServer, DownloadFailsWhenObjectIsReplacedDuringDownload) {
+    server->putObject("model/1/model.xml", "xml");
+    server->putObject("model/1/model.bin", "old weights");
+    std::atomic<bool> replaced{false};
+    server->setAfterObjectMetadata([this, &replaced](const std::string& key) {
+        if (key == "model/1/model.bin" && !replaced.exchange(true)) {
+            server->putObject(key, "new weights");
+        }
+    });
+    std::string localPath;
+    EXPECT_EQ(fs->downloadModelVersions("gs://bucket/model", &localPath, {1}), ovms::StatusCode::GCS_FAILED_GET_OBJECT);
+    EXPECT_TRUE(replaced);
+    EXPECT_GE(server->getVersionMismatches(), 1);
+    std::filesystem::remove_all(localPath);
+}
@@ -1043,6 +1043,28 @@ TEST_F(ConfigStatus, configWithPipelines) {
     EXPECT_EQ(expectedJson, response);
     EXPECT_EQ(status, ovms::StatusCode::OK);
 }
+
+TEST_F(ConfigStatus, configWithMemoryUsage) {
+    ovms::Server& ovmsServer = ovms::Server::instance();
+    TestHelper1 t(*this, configWith2DummyPipelines);
+    auto handler = ovms::HttpRestApiHandler(ovmsServer, 10);
+    std::string response;
+
+    auto status = handler.processConfigStatusRequest(response, t.getManager(), true);
+    ASSERT_EQ(status, ovms::StatusCode::OK);
+    rapidjson::Document doc;
+    ASSERT_FALSE(doc.Parse(response.c_str()).HasParseError()) << response;
+    const auto& modelVersionStatus = doc["dummy"]["model_version_status"][0];
+    EXPECT_STREQ(modelVersionStatus["state"].GetString(), "AVAILABLE");
+    ASSERT_TRUE(modelVersionStatus.HasMember("memory")) << response;
+    const auto& memory = modelVersionStatus["memory"];
+    EXPECT_GT(memory["weights"].GetUint64(), 0);
+    EXPECT_GT(memory["infer_requests"].GetUint64(), 0);
+    EXPECT_EQ(memory["sequence_state"].GetUint64(), 0);
+    EXPECT_EQ(memory["total"].GetUint64(), memory["weights"].GetUint64() + memory["compiled_model_estimate"].GetUint64() + memory["infer_requests"].GetUint64());
+    // Pipelines do not own models memory
+    EXPECT_FALSE(doc["pipeline1Dummy"]["model_version_status"][0].HasMember("memory"));
+}
 #if (MEDIAPIPE_DISABLE == 0)
 TEST_F(ConfigStatus, configWithMediapipe) {
     ovms::Server& ovmsServer = ovms::Server::instance();
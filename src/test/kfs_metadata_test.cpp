@@ -44,9 +44,11 @@ class ModelMetadataResponseBuild : public ::testing::Test {
         MockModel(const std::string& name, std::shared_ptr<ModelInstance> instance) :
             Model(name, false /*stateful*/, nullptr) {
             modelVersions.insert({instance->getVersion(), instance});
+            publishVersionsSnapshot();
         }
         void addOneVersion(model_version_t version, std::shared_ptr<ModelInstance> instance) {
             modelVersions.emplace(version, instance);
+            publishVersionsSnapshot();
         }
     };
 
@@ -13,7 +13,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //*****************************************************************************
+#include <chrono>
 #include <memory>
+#include <set>
 #include <string>
 
 #include <gtest/gtest.h>
@@ -25,6 +27,7 @@
 #include "../servablemanagermodule.hpp"
 #include "../server.hpp"
 #include "../status.hpp"
+#include "../tracer.hpp"
 #include "../version.hpp"
 #include "test_utils.hpp"
 
@@ -162,6 +165,47 @@ TEST_F(HttpRestApiHandlerTest, MetricsParameters) {
     ASSERT_EQ(comp.type, ovms::Metrics);
 }
 
+TEST_F(HttpRestApiHandlerTest, MetricsNamesFilter) {
+    std::string request = "/metrics?name[]=ovms_requests_success&name%5B%5D=ovms_requests_fail&test=test";
+    ovms::HttpRequestComponents comp;
+
+    ASSERT_EQ(handler->parseRequestComponents(comp, "GET", request), StatusCode::OK);
+    ASSERT_EQ(comp.type, ovms::Metrics);
+    EXPECT_EQ(comp.metric_names, (std::set<std::string>{"ovms_requests_success", "ovms_requests_fail"}));
+}
+
+TEST_F(HttpRestApiHandlerTest, TraceParameters) {
+    ovms::HttpRequestComponents comp;
+    ASSERT_EQ(handler->parseRequestComponents(comp, "GET", "/v1/trace"), StatusCode::OK);
+    ASSERT_EQ(comp.type, ovms::Trace);
+    ASSERT_FALSE(comp.trace_seconds.has_value());
+
+    comp = ovms::HttpRequestComponents();
+    ASSERT_EQ(handler->parseRequestComponents(comp, "GET", "/v1/trace?seconds=5"), StatusCode::OK);
+    ASSERT_EQ(comp.type, ovms::Trace);
+    ASSERT_EQ(comp.trace_seconds, 5);
+
+    comp = ovms::HttpRequestComponents();
+    ASSERT_EQ(handler->parseRequestComponents(comp, "GET", "/v1/trace?seconds=abc"), StatusCode::REST_INVALID_URL);
+
+    comp = ovms::HttpRequestComponents();
+    ASSERT_EQ(handler->parseRequestComponents(comp, "POST", "/v1/trace"), StatusCode::OK);
+    ASSERT_EQ(comp.type, ovms::Trace);
+}
+
+TEST_F(HttpRestApiHandlerTest, TraceSetSamplingRate) {
+    ovms::HttpRequestComponents comp;
+    comp.type = ovms::Trace;
+    comp.http_method = "POST";
+    std::string response;
+    ASSERT_EQ(handler->processTrace(comp, response, R"({"sampling_rate": 7})"), StatusCode::OK);
+    EXPECT_EQ(ovms::Tracer::instance().getSamplingRate(), 7);
+    EXPECT_EQ(response, R"({"sampling_rate": 7})");
+    EXPECT_EQ(handler->processTrace(comp, response, R"({"sampling_rate": -1})"), StatusCode::REST_COULD_NOT_PARSE_PARAMETERS);
+    EXPECT_EQ(handler->processTrace(comp, response, "[]"), StatusCode::REST_BODY_IS_NOT_AN_OBJECT);
+    ovms::Tracer::instance().setSamplingRate(0);
+}
+
 TEST_F(HttpRestApiHandlerTest, GetModelMetadataWithLongVersion) {
     std::string request = "/v1/models/dummy/versions/72487667423532349025128558057";
     ovms::HttpRequestComponents comp;
@@ -311,6 +355,27 @@ TEST_F(HttpRestApiHandlerTest, RegexParseInferWithBinaryInputsSizeNotInt) {
     ASSERT_EQ(handler->parseRequestComponents(comp, "POST", request, headers), StatusCode::REST_INFERENCE_HEADER_CONTENT_LENGTH_INVALID);
 }
 
+TEST_F(HttpRestApiHandlerTest, RegexParseInferWithRequestTimeout) {
+    std::string request = "/v2/models/dummy/versions/1/infer";
+    ovms::HttpRequestComponents comp;
+    std::vector<std::pair<std::string, std::string>> headers;
+    headers.emplace_back("Request-Timeout-Ms", "1000");
+    auto before = std::chrono::steady_clock::now();
+    ASSERT_EQ(handler->parseRequestComponents(comp, "POST", request, headers), StatusCode::OK);
+    ASSERT_TRUE(comp.deadline.has_value());
+    EXPECT_GE(comp.deadline.value(), before + std::chrono::milliseconds(1000));
+}
+
+TEST_F(HttpRestApiHandlerTest, RegexParseInferWithRequestTimeoutInvalid) {
+    std::string request = "/v2/models/dummy/versions/1/infer";
+    for (const std::string value : {"0", "-15", "value"}) {
+        ovms::HttpRequestComponents comp;
+        std::vector<std::pair<std::string, std::string>> headers;
+        headers.emplace_back("Request-Timeout-Ms", value);
+        EXPECT_EQ(handler->parseRequestComponents(comp, "POST", request, headers), StatusCode::REST_REQUEST_TIMEOUT_INVALID) << value;
+    }
+}
+
 TEST_F(HttpRestApiHandlerTest, dispatchMetadata) {
     std::string request = "/v2/models/dummy/versions/1";
     ovms::HttpRequestComponents comp;
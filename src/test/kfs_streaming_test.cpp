@@ -0,0 +1,212 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <grpcpp/create_channel.h>
+#include <grpcpp/server_context.h>
+#include <gtest/gtest.h>
+
+#include "../config.hpp"
+#include "../grpcservermodule.hpp"
+#include "../kfs_frontend/kfs_grpc_inference_service.hpp"
+#include "../server.hpp"
+#include "../status.hpp"
+#include "test_utils.hpp"
+
+using namespace ovms;
+
+namespace {
+class FakeServerReaderWriter final : public ::grpc::ServerReaderWriterInterface<::inference::ModelStreamInferResponse, ::inference::ModelInferRequest> {
+    std::mutex readMtx;
+    std::vector<::inference::ModelInferRequest> toRead;
+    size_t readIndex = 0;
+    std::mutex writeMtx;
+    std::vector<::inference::ModelStreamInferResponse> written;
+    size_t failWritesAfter;
+
+public:
+    FakeServerReaderWriter(std::vector<::inference::ModelInferRequest> requests, size_t failWritesAfter = std::numeric_limits<size_t>::max()) :
+        toRead(std::move(requests)),
+        failWritesAfter(failWritesAfter) {}
+    void SendInitialMetadata() override {}
+    bool NextMessageSize(uint32_t* sz) override { return false; }
+    bool Read(::inference::ModelInferRequest* msg) override {
+        std::lock_guard<std::mutex> lock(readMtx);
+        if (readIndex >= toRead.size()) {
+            return false;
+        }
+        *msg = toRead[readIndex++];
+        return true;
+    }
+    bool Write(const ::inference::ModelStreamInferResponse& msg, ::grpc::WriteOptions options) override {
+        std::lock_guard<std::mutex> lock(writeMtx);
+        if (written.size() >= failWritesAfter) {
+            return false;
+        }
+        written.push_back(msg);
+        return true;
+    }
+    const std::vector<::inference::ModelStreamInferResponse>& getWritten() const { return written; }
+};
+
+class ServerShutdownGuard {
+    ovms::Server& ovmsServer;
+
+public:
+    ServerShutdownGuard(ovms::Server& ovmsServer) :
+        ovmsServer(ovmsServer) {}
+    ~ServerShutdownGuard() {
+        ovmsServer.shutdownModules();
+    }
+};
+}  // namespace
+
+class KFSModelStreamInferTest : public ::testing::Test {
+protected:
+    std::unique_ptr<ServerShutdownGuard> serverGuard;
+    KFSInferenceServiceImpl* impl = nullptr;
+    std::string port = "9178";
+    ::grpc::ServerContext serverContext;
+
+    void SetUp() override {
+        randomizePort(port);
+        char* n_argv[] = {(char*)"ovms", (char*)"--model_path", (char*)"/ovms/src/test/dummy", (char*)"--model_name", (char*)"dummy", (char*)"--nireq", (char*)"4", (char*)"--port", (char*)port.c_str(), (char*)"--file_system_poll_wait_seconds", (char*)"0"};
+        int arg_count = 11;
+        ovms::Config::instance().parse(arg_count, n_argv);
+        ovms::Server& server = ovms::Server::instance();
+        auto status = server.startModules(ovms::Config::instance());
+        ASSERT_TRUE(status.ok()) << status.string();
+        serverGuard = std::make_unique<ServerShutdownGuard>(server);
+        const ovms::Module* grpcModule = server.getModule(ovms::GRPC_SERVER_MODULE_NAME);
+        ASSERT_NE(grpcModule, nullptr);
+        impl = &dynamic_cast<const ovms::GRPCServerModule*>(grpcModule)->getKFSGrpcImpl();
+    }
+
+    void TearDown() override {
+        serverGuard.reset();
+    }
+
+    // Sends all requests through gRPC server started with the fixture, then reads responses until server finishes the stream
+    std::vector<::inference::ModelStreamInferResponse> streamThroughGrpc(const std::vector<::inference::ModelInferRequest>& requests, ::grpc::Status& status) {
+        auto channel = ::grpc::CreateChannel("localhost:" + port, ::grpc::InsecureChannelCredentials());
+        auto stub = ::inference::GRPCInferenceService::NewStub(channel);
+        ::grpc::ClientContext context;
+        auto stream = stub->ModelStreamInfer(&context);
+        for (const auto& request : requests) {
+            if (!stream->Write(request)) {
+                break;
+            }
+        }
+        stream->WritesDone();
+        std::vector<::inference::ModelStreamInferResponse> responses;
+        ::inference::ModelStreamInferResponse response;
+        while (stream->Read(&response)) {
+            responses.push_back(response);
+        }
+        status = stream->Finish();
+        return responses;
+    }
+
+    static ::inference::ModelInferRequest prepareDummyRequest(const std::string& id, float value, const std::string& servableName = "dummy") {
+        ::inference::ModelInferRequest request;
+        request.set_model_name(servableName);
+        request.set_id(id);
+        preparePredictRequest(request, {{DUMMY_MODEL_INPUT_NAME, std::tuple<ovms::signed_shape_t, const ovms::Precision>{{1, DUMMY_MODEL_INPUT_SIZE}, ovms::Precision::FP32}}}, std::vector<float>(DUMMY_MODEL_INPUT_SIZE, value));
+        return request;
+    }
+};
+
+TEST_F(KFSModelStreamInferTest, ModelResponsesMatchRequestsById) {
+    const size_t requestsCount = 20;
+    std::vector<::inference::ModelInferRequest> requests;
+    for (size_t i = 0; i < requestsCount; ++i) {
+        requests.push_back(prepareDummyRequest(std::to_string(i), static_cast<float>(i)));
+    }
+    ::grpc::Status status;
+    auto responses = streamThroughGrpc(requests, status);
+    ASSERT_TRUE(status.ok()) << status.error_message();
+    ASSERT_EQ(responses.size(), requestsCount);
+    std::set<std::string> receivedIds;
+    for (const auto& resp : responses) {
+        ASSERT_TRUE(resp.error_message().empty()) << resp.error_message();
+        const auto& inferResponse = resp.infer_response();
+        receivedIds.insert(inferResponse.id());
+        ASSERT_EQ(inferResponse.raw_output_contents_size(), 1);
+        const float* output = reinterpret_cast<const float*>(inferResponse.raw_output_contents(0).data());
+        float expected = std::stof(inferResponse.id()) + DUMMY_ADDITION_VALUE;
+        for (int j = 0; j < DUMMY_MODEL_OUTPUT_SIZE; ++j) {
+            EXPECT_EQ(output[j], expected);
+        }
+    }
+    EXPECT_EQ(receivedIds.size(), requestsCount);
+}
+
+TEST_F(KFSModelStreamInferTest, ErrorInSubsequentRequestDoesNotStopStream) {
+    std::vector<::inference::ModelInferRequest> requests{
+        prepareDummyRequest("0", 1.0),
+        prepareDummyRequest("1", 2.0, "non_existing"),
+        prepareDummyRequest("2", 3.0)};
+    ::grpc::Status status;
+    auto responses = streamThroughGrpc(requests, status);
+    ASSERT_TRUE(status.ok()) << status.error_message();
+    ASSERT_EQ(responses.size(), 3);
+#if (MEDIAPIPE_DISABLE == 0)
+    const Status expectedStatus = StatusCode::MEDIAPIPE_DEFINITION_NAME_MISSING;
+#else
+    const Status expectedStatus = StatusCode::PIPELINE_DEFINITION_NAME_MISSING;
+#endif
+    size_t errors = 0;
+    for (const auto& resp : responses) {
+        if (!resp.error_message().empty()) {
+            EXPECT_EQ(resp.error_message(), expectedStatus.string());
+            ++errors;
+        }
+    }
+    EXPECT_EQ(errors, 1);
+}
+
+TEST_F(KFSModelStreamInferTest, FirstRequestForMissingServable) {
+    std::vector<::inference::ModelInferRequest> requests{prepareDummyRequest("0", 1.0, "non_existing")};
+    ::grpc::Status status;
+    auto responses = streamThroughGrpc(requests, status);
+    EXPECT_EQ(status.error_code(), ::grpc::StatusCode::NOT_FOUND);
+#if (MEDIAPIPE_DISABLE == 0)
+    EXPECT_EQ(status.error_message(), Status(StatusCode::MEDIAPIPE_DEFINITION_NAME_MISSING).string());
+#else
+    EXPECT_EQ(status.error_message(), Status(StatusCode::PIPELINE_DEFINITION_NAME_MISSING).string());
+#endif
+    EXPECT_EQ(responses.size(), 0);
+}
+
+TEST_F(KFSModelStreamInferTest, ClientDisconnectedDuringWrite) {
+    std::vector<::inference::ModelInferRequest> requests;
+    for (size_t i = 0; i < 10; ++i) {
+        requests.push_back(prepareDummyRequest(std::to_string(i), 1.0));
+    }
+    FakeServerReaderWriter stream(requests, 2);
+    ASSERT_EQ(impl->ModelStreamInferImpl(&serverContext, &stream), StatusCode::OK);
+    EXPECT_EQ(stream.getWritten().size(), 2);
+}
+
+TEST_F(KFSModelStreamInferTest, ClientDisconnectedBeforeFirstRequest) {
+    FakeServerReaderWriter stream({});
+    EXPECT_EQ(impl->ModelStreamInferImpl(&serverContext, &stream), StatusCode::STREAM_CLOSED_BEFORE_FIRST_REQUEST);
+}
@@ -0,0 +1,35 @@
+#*****************************************************************************
+# Copyright 2023 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#*****************************************************************************
+import numpy as np
+from pyovms import Tensor
+class OvmsPythonModel:
+
+    def execute(self, inputs: list, kwargs: dict = {}):
+        raise Exception("execute should not be called when execute_batch is available")
+
+    def execute_batch(self, batch: list):
+        # Increment every element of every input in every input set of the batch.
+        # Size of the batch is returned with each input set, so that the caller can check whether input sets were batched.
+        results = []
+        for inputs in batch:
+            outputs = []
+            for input in inputs:
+                output_npy = np.array(input) + 1
+                output_name = input.name.replace("input", "output")
+                outputs.append(Tensor(output_name, output_npy.astype(np.float32)))
+            outputs.append(Tensor("batch_size", np.array([len(batch)], dtype=np.float32)))
+            results.append(outputs)
+        return results
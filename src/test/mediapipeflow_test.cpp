@@ -44,6 +44,7 @@
 #include "../mediapipe_internal/mediapipegraphexecutor.hpp"
 #include "../metric_config.hpp"
 #include "../metric_module.hpp"
+#include "../metric_registry.hpp"
 #include "../model_service.hpp"
 #include "../precision.hpp"
 #include "../servablemanagermodule.hpp"
@@ -292,6 +293,24 @@ TEST_F(MediapipeTensorTest, DummyInfer) {
     checkDummyResponse("out", requestData, request, response, dummysInTheGraph, 1, modelName);
 }
 
+// Incorrect KServe proto to mediapipe::Tensor conversion
+TEST_F(MediapipeTensorTest, SendDummyInferMoreDataThanExpected) {
+    const std::string modelName{"mpTensorDummy"};
+    const ovms::Module* grpcModule = server.getModule(ovms::GRPC_SERVER_MODULE_NAME);
+    KFSInferenceServiceImpl& impl = dynamic_cast<const ovms::GRPCServerModule*>(grpcModule)->getKFSGrpcImpl();
+    ::KFSRequest request;
+    ::KFSResponse response;
+    request.Clear();
+    response.Clear();
+    const size_t numElements = 50000;
+    inputs_info_t inputsMeta{{"in", {{1, numElements}, precision}}};
+    std::vector<float> requestData(numElements);
+    preparePredictRequest(request, inputsMeta, requestData);
+    request.mutable_model_name()->assign(modelName);
+    request.mutable_inputs(0)->set_shape(1, 1);  // change only shape [1,numElements] to [1,1], keep data
+    ASSERT_EQ(impl.ModelInfer(nullptr, &request, &response).error_code(), grpc::StatusCode::INVALID_ARGUMENT);
+}
+
 TEST_F(MediapipeTfLiteTensorTest, DummyInfer) {
     GTEST_SKIP() << "OVMS calculator doesn't handle TfLite on output. Only vector of TfLite"
                  << "OVMS deserialization & serialization of TfLiteTensors is not finised as well";
@@ -1403,7 +1422,7 @@ TEST_P(MediapipeFlowAddTest, InferStreamDisconnectionBeforeFirstRequest) {
         });
     EXPECT_CALL(stream, Write(::testing::_, ::testing::_)).Times(0);
     auto status = impl.ModelStreamInferImpl(nullptr, &stream);
-    ASSERT_EQ(status, StatusCode::MEDIAPIPE_UNINITIALIZED_STREAM_CLOSURE) << status.string();
+    ASSERT_EQ(status, StatusCode::STREAM_CLOSED_BEFORE_FIRST_REQUEST) << status.string();
 }
 
 TEST_F(MediapipeFlowTest, InferWithParams) {
@@ -1560,6 +1579,7 @@ public:
         join();
         spdlog::info("Destructor of modelmanager(Enabled one). Models #:{}", models.size());
         models.clear();
+        publishModelsSnapshot();
         spdlog::info("Destructor of modelmanager(Enabled one). Models #:{}", models.size());
     }
 };
@@ -2641,6 +2661,64 @@ TEST_F(MediapipeConfigChanges, AddModelToConfigThenUnloadThenAddToSubconfig) {
     checkStatus<KFSRequest, KFSResponse>(modelManager, StatusCode::OK);
 }
 
+TEST_F(MediapipeConfigChanges, CalculatorExecutionTimeMetric) {
+    std::string configFileContent = std::string{R"(
+{
+    "monitoring": {
+        "metrics": {
+            "enable": true,
+            "metrics_list": [")"} +
+                                    METRIC_NAME_NODE_EXECUTION_TIME + R"("]
+        }
+    },
+    "model_config_list": [
+        {"config": {
+                "name": "dummy",
+                "base_path": "/ovms/src/test/dummy"
+        }
+        }
+    ],
+    "mediapipe_config_list": [
+    {
+        "name":"mediapipeGraph",
+        "graph_path":"XYZ"
+    }
+    ]
+}
+)";
+    std::string graphPbtxtFileContent = pbtxtContent;
+    std::string configFilePath = directoryPath + "/config.json";
+    std::string graphFilePath = directoryPath + "/graph.pbtxt";
+
+    const std::string modelPathToReplace{"XYZ"};
+    configFileContent.replace(configFileContent.find(modelPathToReplace), modelPathToReplace.size(), graphFilePath);
+    // Profiles of named nodes are reported with the node name
+    const std::string inferenceCalculator{"calculator: \"OpenVINOInferenceCalculator\""};
+    graphPbtxtFileContent.replace(graphPbtxtFileContent.find(inferenceCalculator), inferenceCalculator.size(), "name: \"dummyInference\"\n  " + inferenceCalculator);
+
+    char* n_argv[] = {(char*)"ovms", (char*)"--config_path", (char*)"/unused", (char*)"--rest_port", (char*)"8080"};  // Workaround to have rest_port parsed in order to enable metrics
+    int arg_count = 5;
+    ovms::Config::instance().parse(arg_count, n_argv);
+    createConfigFileWithContent(configFileContent, configFilePath);
+    createConfigFileWithContent(graphPbtxtFileContent, graphFilePath);
+    ConstructorEnabledModelManager modelManager;
+    ASSERT_EQ(modelManager.loadConfig(configFilePath), StatusCode::OK);
+
+    const int numberOfRequests = 3;
+    for (int i = 0; i < numberOfRequests; i++) {
+        std::shared_ptr<MediapipeGraphExecutor> executor;
+        KFSRequest request;
+        KFSResponse response;
+        preparePredictRequest(request, {{"in", {DUMMY_MODEL_SHAPE, Precision::FP32}}});
+        request.mutable_model_name()->assign(mgdName);
+        ASSERT_EQ(modelManager.createPipeline(executor, mgdName, &request, &response), StatusCode::OK);
+        ServableMetricReporter* reporter = nullptr;
+        ASSERT_EQ(executor->infer(&request, &response, DEFAULT_TEST_CONTEXT, reporter), StatusCode::OK);
+    }
+
+    EXPECT_THAT(modelManager.getMetricRegistry()->collect(), HasSubstr(METRIC_NAME_NODE_EXECUTION_TIME + std::string{"_count{name=\""} + mgdName + std::string{"\",node=\"dummyInference\",version=\"1\"} "} + std::to_string(numberOfRequests)));
+}
+
 TEST(MediapipeStreamTypes, Recognition) {
     using ovms::mediapipe_packet_type_enum;
     using ovms::MediapipeGraphDefinition;
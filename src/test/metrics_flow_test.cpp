@@ -203,6 +203,14 @@ TEST_F(MetricFlowTest, GrpcPredict) {
 
     EXPECT_THAT(server.collect(), HasSubstr(METRIC_NAME_INFER_REQ_QUEUE_SIZE + std::string{"{name=\""} + modelName + std::string{"\",version=\"1\"} "} + std::to_string(2)));
     EXPECT_THAT(server.collect(), Not(HasSubstr(METRIC_NAME_INFER_REQ_QUEUE_SIZE + std::string{"{name=\""} + dagName + std::string{"\",version=\"1\"} "})));
+
+    // Validation is measured for failed requests too, DAG nodes do not go through single model stages
+    EXPECT_THAT(server.collect(), HasSubstr(METRIC_NAME_VALIDATION_TIME + std::string{"_count{name=\""} + modelName + std::string{"\",version=\"1\"} "} + std::to_string(numberOfSuccessRequests + numberOfFailedRequests)));
+    EXPECT_THAT(server.collect(), HasSubstr(METRIC_NAME_DESERIALIZATION_TIME + std::string{"_count{name=\""} + modelName + std::string{"\",version=\"1\"} "} + std::to_string(numberOfSuccessRequests)));
+    EXPECT_THAT(server.collect(), HasSubstr(METRIC_NAME_SERIALIZATION_TIME + std::string{"_count{name=\""} + modelName + std::string{"\",version=\"1\"} "} + std::to_string(numberOfSuccessRequests)));
+
+    EXPECT_THAT(server.collect(), HasSubstr(METRIC_NAME_NODE_EXECUTION_TIME + std::string{"_count{name=\""} + dagName + std::string{"\",node=\"dummy-node\",version=\"1\"} "} + std::to_string(dynamicBatch * numberOfSuccessRequests)));
+    EXPECT_THAT(server.collect(), HasSubstr(METRIC_NAME_NODE_WAIT_FOR_INFER_REQ_TIME + std::string{"_count{name=\""} + dagName + std::string{"\",node=\"dummy-node\",version=\"1\"} "} + std::to_string(dynamicBatch * numberOfSuccessRequests)));
 }
 
 TEST_F(MetricFlowTest, GrpcGetModelMetadata) {
@@ -564,6 +572,11 @@ std::string MetricFlowTest::prepareConfigContent() {
            R"(",")" + METRIC_NAME_STREAMS +
            R"(",")" + METRIC_NAME_INFERENCE_TIME +
            R"(",")" + METRIC_NAME_WAIT_FOR_INFER_REQ_TIME +
+           R"(",")" + METRIC_NAME_VALIDATION_TIME +
+           R"(",")" + METRIC_NAME_DESERIALIZATION_TIME +
+           R"(",")" + METRIC_NAME_SERIALIZATION_TIME +
+           R"(",")" + METRIC_NAME_NODE_EXECUTION_TIME +
+           R"(",")" + METRIC_NAME_NODE_WAIT_FOR_INFER_REQ_TIME +
            R"("]
             }
         },
@@ -13,8 +13,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //*****************************************************************************
+#include <atomic>
 #include <future>
 #include <memory>
+#include <string>
 #include <thread>
 #include <utility>
 #include <vector>
@@ -37,6 +39,42 @@ TEST(Metrics, RegistryEmpty) {
     EXPECT_EQ(registry.collect().size(), 0);
 }
 
+TEST(Metrics, CollectFilteredFamilies) {
+    MetricRegistry registry;
+    auto counter = registry.createFamily<MetricCounter>("counter", "desc")->addMetric({{"label", "value"}});
+    auto gauge = registry.createFamily<MetricGauge>("gauge", "desc")->addMetric({{"label", "value"}});
+    auto histogram = registry.createFamily<MetricHistogram>("histogram", "desc")->addMetric({{"label", "value"}}, {1.0});
+    std::string content = registry.collect({"counter", "histogram"});
+    EXPECT_THAT(content, HasSubstr("counter{label=\"value\"} 0\n"));
+    EXPECT_THAT(content, HasSubstr("histogram_count{label=\"value\"} 0\n"));
+    EXPECT_THAT(content, Not(HasSubstr("gauge")));
+    EXPECT_EQ(registry.collect({"unknown"}), "");
+}
+
+TEST(Metrics, CollectFilteredRemovedFamily) {
+    MetricRegistry registry;
+    auto family = registry.createFamily<MetricCounter>("name", "desc");
+    auto metric = family->addMetric({{"label", "value"}});
+    EXPECT_THAT(registry.collect({"name"}), HasSubstr("name{label=\"value\"} 0\n"));
+    EXPECT_TRUE(registry.remove(family));
+    EXPECT_EQ(registry.collect({"name"}), "");
+}
+
+TEST(Metrics, CollectReflectsChangedValues) {
+    MetricRegistry registry;
+    auto counter = registry.createFamily<MetricCounter>("counter", "desc")->addMetric({{"label", "value"}});
+    auto gauge = registry.createFamily<MetricGauge>("gauge", "desc")->addMetric({{"label", "value"}});
+    EXPECT_THAT(registry.collect(), HasSubstr("counter{label=\"value\"} 0\n"));
+    counter->increment();
+    std::string content = registry.collect();
+    EXPECT_THAT(content, HasSubstr("counter{label=\"value\"} 1\n"));
+    EXPECT_THAT(content, HasSubstr("gauge{label=\"value\"} 0\n"));
+    gauge->set(5);
+    content = registry.collect();
+    EXPECT_THAT(content, HasSubstr("counter{label=\"value\"} 1\n"));
+    EXPECT_THAT(content, HasSubstr("gauge{label=\"value\"} 5\n"));
+}
+
 TEST(MetricsCounter, IncrementDefault) {
     MetricRegistry registry;
     auto metric = registry.createFamily<MetricCounter>("name", "desc")->addMetric({{"label", "value"}});
@@ -182,6 +220,26 @@ TEST(MetricsCounter, RevertingFamilyResetsValue) {
     EXPECT_THAT(registry.collect(), HasSubstr("name{label=\"value\"} 0\n"));
 }
 
+TEST(MetricsCounter, ValueOfDestroyedMetricIsCollected) {
+    MetricRegistry registry;
+    auto family = registry.createFamily<MetricCounter>("name", "desc");
+    auto metric = family->addMetric({{"label", "value"}});
+    metric->increment(3);
+    metric.reset();
+    EXPECT_THAT(registry.collect(), HasSubstr("name{label=\"value\"} 3\n"));
+    EXPECT_THAT(registry.collect(), HasSubstr("name{label=\"value\"} 3\n"));
+}
+
+TEST(MetricsCounter, SameLabelsShareValue) {
+    MetricRegistry registry;
+    auto family = registry.createFamily<MetricCounter>("name", "desc");
+    auto metric1 = family->addMetric({{"label", "value"}});
+    auto metric2 = family->addMetric({{"label", "value"}});
+    metric1->increment(2);
+    metric2->increment(5);
+    EXPECT_THAT(registry.collect(), HasSubstr("name{label=\"value\"} 7\n"));
+}
+
 TEST(MetricsCounter, CorrectOrderOfTextRepresentation) {
     MetricRegistry registry;
     registry.createFamily<MetricCounter>("family1", "desc")->addMetric({{"label", "value"}})->increment();
@@ -346,6 +404,19 @@ TEST(MetricsGauge, Set) {
     EXPECT_THAT(registry.collect(), HasSubstr("name{label=\"value\"} -13.57\n"));
 }
 
+TEST(MetricsGauge, ValueProviderIsEvaluatedOnCollect) {
+    MetricRegistry registry;
+    auto metric = registry.createFamily<MetricGauge>("name", "desc")->addMetric({{"label", "value"}});
+    double value = 3;
+    metric->setValueProvider([&value]() { return value; });
+    EXPECT_THAT(registry.collect(), HasSubstr("name{label=\"value\"} 3\n"));
+    value = 7;
+    EXPECT_THAT(registry.collect(), HasSubstr("name{label=\"value\"} 7\n"));
+    metric->setValueProvider(nullptr);
+    value = 9;
+    EXPECT_THAT(registry.collect(), HasSubstr("name{label=\"value\"} 7\n"));
+}
+
 TEST(MetricsGauge, SetRemovedMetric) {
     MetricRegistry registry;
     auto family = registry.createFamily<MetricGauge>("name", "desc");
@@ -969,3 +1040,36 @@ TEST(MetricsManyOps, MultipleThreads) {
         }
     }
 }
+
+TEST(MetricsManyOps, CollectWhileRecording) {
+    const int numberOfWorkers = 8;
+    const int numberOfOperations = 10000;
+    MetricRegistry registry;
+    auto counter = registry.createFamily<MetricCounter>("counter", "desc")->addMetric();
+    auto histogram = registry.createFamily<MetricHistogram>("histogram", "desc")->addMetric({}, {1.0});
+
+    std::atomic<bool> finished{false};
+    std::thread collector([&registry, &finished]() {
+        while (!finished) {
+            registry.collect();
+        }
+    });
+    std::vector<std::thread> workers;
+    for (int i = 0; i < numberOfWorkers; i++) {
+        workers.emplace_back([&counter, &histogram]() {
+            for (int j = 0; j < numberOfOperations; j++) {
+                counter->increment();
+                histogram->observe(j % 2 ? 0.5 : 2.0);
+            }
+        });
+    }
+    std::for_each(workers.begin(), workers.end(), [](auto& thread) { thread.join(); });
+    finished = true;
+    collector.join();
+
+    std::string content = registry.collect();
+    EXPECT_THAT(content, HasSubstr("counter 80000\n"));
+    EXPECT_THAT(content, HasSubstr("histogram_bucket{le=\"1\"} 40000\n"));
+    EXPECT_THAT(content, HasSubstr("histogram_bucket{le=\"+Inf\"} 80000\n"));
+    EXPECT_THAT(content, HasSubstr("histogram_sum 100000\n"));
+}
@@ -22,6 +22,7 @@
 #include "../modelconfig.hpp"
 #include "../modelinstance.hpp"
 #include "../modelmanager.hpp"
+#include "../modelprecompiler.hpp"
 #include "test_utils.hpp"
 
 using namespace ovms;
@@ -155,6 +156,92 @@ TEST_F(ModelCacheTest, FlowTestOfflineModifications) {
     ASSERT_EQ(currentCacheFileCount, previousCacheFileCount);
 }
 
+class ModelManagerWithPrecompiler : public ConstructorEnabledModelManager {
+public:
+    ModelManagerWithPrecompiler(const std::string& modelCacheDirectory) :
+        ConstructorEnabledModelManager(modelCacheDirectory) {
+        precompiler = std::make_unique<ModelPrecompiler>(*ieCore);
+    }
+    ModelPrecompiler& getPrecompiler() {
+        return *precompiler;
+    }
+};
+
+TEST_F(ModelCacheTest, PrecompiledModelIsLoadedFromCache) {
+    ov::Core ieCore;
+    ModelPrecompiler precompiler(ieCore);
+    ASSERT_TRUE(precompiler.schedule(dummyModelConfigWithCache));
+    ASSERT_TRUE(precompiler.waitUntilIdle(std::chrono::seconds(30)));
+    EXPECT_EQ(precompiler.getPrecompiledCount(), 1);
+    size_t currentCacheFileCount = this->getCachedFileCount();
+    ASSERT_GT(currentCacheFileCount, 0);
+
+    // Same version with unchanged config is not compiled again
+    EXPECT_FALSE(precompiler.schedule(dummyModelConfigWithCache));
+
+    ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, ieCore);
+    ASSERT_EQ(modelInstance.loadModel(dummyModelConfigWithCache), StatusCode::OK);
+    EXPECT_TRUE(modelInstance.isLoadedFromCache());
+    EXPECT_EQ(this->getCachedFileCount(), currentCacheFileCount);
+}
+
+TEST_F(ModelCacheTest, CompileIntoCacheDoesNotLoadModel) {
+    ov::Core ieCore;
+    ModelInstance precompiledInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, ieCore);
+    bool loadedFromCache = true;
+    ASSERT_EQ(precompiledInstance.compileIntoCache(dummyModelConfigWithCache, loadedFromCache), StatusCode::OK);
+    EXPECT_FALSE(loadedFromCache);
+    EXPECT_NE(precompiledInstance.getStatus().getState(), ModelVersionState::AVAILABLE);
+    size_t currentCacheFileCount = this->getCachedFileCount();
+    ASSERT_GT(currentCacheFileCount, 0);
+
+    ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, ieCore);
+    ASSERT_EQ(modelInstance.compileIntoCache(dummyModelConfigWithCache, loadedFromCache), StatusCode::OK);
+    EXPECT_TRUE(loadedFromCache);
+    EXPECT_EQ(this->getCachedFileCount(), currentCacheFileCount);
+}
+
+TEST_F(ModelCacheTest, PrecompilationNotPossibleWithoutCache) {
+    ModelConfig config = DUMMY_MODEL_CONFIG;
+    EXPECT_FALSE(ModelPrecompiler::isPrecompilationPossible(config));
+    EXPECT_TRUE(ModelPrecompiler::isPrecompilationPossible(dummyModelConfigWithCache));
+    config = dummyModelConfigWithCache;
+    config.setBatchingMode(Mode::AUTO);
+    EXPECT_FALSE(ModelPrecompiler::isPrecompilationPossible(config));
+    config.setAllowCache(true);
+    EXPECT_TRUE(ModelPrecompiler::isPrecompilationPossible(config));
+    config = dummyModelConfigWithCache;
+    config.setBasePath("s3://bucket/model");
+    EXPECT_FALSE(ModelPrecompiler::isPrecompilationPossible(config));
+}
+
+TEST(ModelPrecompiler, StagedVersionsAreNewerThanServed) {
+    EXPECT_EQ(ModelPrecompiler::getStagedVersions({1, 2, 3, 4}, {2}), model_versions_t({3, 4}));
+    EXPECT_EQ(ModelPrecompiler::getStagedVersions({1, 2, 3}, {1, 3}), model_versions_t({}));
+    EXPECT_EQ(ModelPrecompiler::getStagedVersions({1, 2, 3}, {}), model_versions_t({}));
+}
+
+TEST_F(ModelCacheTest, StagedVersionIsPrecompiledAndLoadedFromCache) {
+    const std::string modelPath = this->directoryPath + "/repository/dummy";
+    std::filesystem::create_directories(modelPath);
+    std::filesystem::copy(dummy_model_location + "/1", modelPath + "/1", std::filesystem::copy_options::recursive);
+    std::filesystem::copy(dummy_model_location + "/1", modelPath + "/2", std::filesystem::copy_options::recursive);
+    ModelConfig config = dummyModelConfigWithCache;
+    config.setBasePath(modelPath);
+    ASSERT_EQ(config.parseModelVersionPolicy(R"({"specific": {"versions":[1]}})"), StatusCode::OK);
+
+    ModelManagerWithPrecompiler manager(modelCacheDirectory);
+    ASSERT_EQ(manager.reloadModelWithVersions(config), StatusCode::OK_RELOADED);
+    ASSERT_TRUE(manager.getPrecompiler().waitUntilIdle(std::chrono::seconds(30)));
+    EXPECT_EQ(manager.getPrecompiler().getPrecompiledCount(), 1);
+
+    ASSERT_EQ(config.parseModelVersionPolicy(R"({"latest": {"num_versions":1}})"), StatusCode::OK);
+    ASSERT_EQ(manager.reloadModelWithVersions(config), StatusCode::OK_RELOADED);
+    auto instance = manager.findModelInstance("dummy", 2);
+    ASSERT_NE(instance, nullptr);
+    EXPECT_TRUE(instance->isLoadedFromCache());
+}
+
 TEST_F(ModelCacheTest, BatchSizeChangeImpactsCache) {
     this->prepareDummyCachedRun();
     size_t currentCacheFileCount = this->getCachedFileCount();
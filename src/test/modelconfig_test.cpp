@@ -1057,6 +1057,27 @@ TEST(ModelConfig, ConfigParseNodeWithValidShapeFormatArray) {
     EXPECT_EQ(shapes["input"].shape, (ovms::Shape{1, 3, 600, 600}));
 }
 
+TEST(ModelConfig, ConfigParseNodeWithMemoryLimit) {
+    std::string config = R"#(
+        {
+            "name": "alpha",
+            "base_path": "/tmp/models/dummy1",
+            "memory_limit_mb": 512
+        }
+    )#";
+
+    rapidjson::Document configJson;
+    rapidjson::ParseResult parsingSucceeded = configJson.Parse(config.c_str());
+    ASSERT_EQ(parsingSucceeded, true);
+    ovms::ModelConfig modelConfig;
+    ASSERT_EQ(modelConfig.parseNode(configJson), ovms::StatusCode::OK);
+    EXPECT_EQ(modelConfig.getMemoryLimitMb(), 512);
+
+    ovms::ModelConfig changed = modelConfig;
+    changed.setMemoryLimitMb(0);
+    EXPECT_TRUE(modelConfig.isReloadRequired(changed));
+}
+
 static std::string config_low_latency_no_stateful = R"#(
     {
     "model_config_list": [
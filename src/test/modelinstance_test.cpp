@@ -16,14 +16,20 @@
 #include <cstdio>
 #include <filesystem>
 #include <fstream>
+#include <iterator>
+#include <set>
+#include <sstream>
+#include <string>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <sched.h>
 #include <stdlib.h>
 
 #include "../get_model_metadata_impl.hpp"
 #include "../modelinstance.hpp"
 #include "../modelinstanceunloadguard.hpp"
+#include "../systeminfo.hpp"
 #include "test_utils.hpp"
 
 using testing::Return;
@@ -570,6 +576,127 @@ TEST_F(TestLoadModel, SuccessfulLoad) {
     EXPECT_EQ(ovms::ModelVersionState::AVAILABLE, modelInstance.getStatus().getState());
 }
 
+TEST_F(TestLoadModel, MemoryUsageReportedUntilUnload) {
+    ovms::ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore);
+    ASSERT_EQ(modelInstance.loadModel(DUMMY_MODEL_CONFIG), ovms::StatusCode::OK);
+    auto usage = modelInstance.getMemoryUsage();
+    EXPECT_GT(usage.weights, 0);
+    // IR weights read from repository are not shared
+    EXPECT_EQ(usage.sharedWeights, 0);
+    // Input and output of 1x10 fp32 for each infer request
+    EXPECT_GE(usage.inferRequests, modelInstance.getInferRequestsQueue().size() * 2 * DUMMY_MODEL_INPUT_SIZE * sizeof(float));
+    EXPECT_EQ(usage.sequenceState, 0);
+    EXPECT_EQ(usage.total(), usage.weights + usage.compiledModel + usage.inferRequests);
+    modelInstance.retireModel();
+    EXPECT_EQ(modelInstance.getMemoryUsage().total(), 0);
+}
+
+class MockModelInstanceAllocatingDuringCompilation : public ovms::ModelInstance {
+    std::vector<char> buffer;
+
+public:
+    MockModelInstanceAllocatingDuringCompilation(ov::Core& ieCore) :
+        ModelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, ieCore) {}
+
+protected:
+    void loadCompiledModelPtr(const ovms::plugin_config_t& pluginConfig) override {
+        ModelInstance::loadCompiledModelPtr(pluginConfig);
+        // Touched pages are counted in resident memory as if compiled model used them
+        buffer.assign(64 * 1024 * 1024, 1);
+    }
+};
+
+TEST_F(TestLoadModel, CompiledModelEstimateNotCheckedAgainstMemoryLimit) {
+    MockModelInstanceAllocatingDuringCompilation modelInstance(*ieCore);
+    auto config = DUMMY_MODEL_CONFIG;
+    config.setMemoryLimitMb(16);
+    ASSERT_EQ(modelInstance.loadModel(config), ovms::StatusCode::OK);
+    EXPECT_EQ(ovms::ModelVersionState::AVAILABLE, modelInstance.getStatus().getState()) << modelInstance.getStatus().getStateString();
+    modelInstance.retireModel();
+}
+
+TEST_F(TestLoadModel, UnSuccessfulLoadWhenMemoryLimitExceeded) {
+    ovms::ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore);
+    auto config = DUMMY_MODEL_CONFIG;
+    // Input and output of 30000x10 fp32 take over 2 MB for single infer request
+    config.setBatchSize(30000);
+    config.setNireq(1);
+    config.setMemoryLimitMb(1);
+    EXPECT_EQ(modelInstance.loadModel(config), ovms::StatusCode::MODEL_MEMORY_LIMIT_EXCEEDED);
+    EXPECT_NE(ovms::ModelVersionState::AVAILABLE, modelInstance.getStatus().getState()) << modelInstance.getStatus().getStateString();
+}
+
+static std::set<pid_t> getProcessThreads() {
+    std::set<pid_t> threads;
+    for (const auto& entry : std::filesystem::directory_iterator("/proc/self/task")) {
+        threads.insert(std::stoi(entry.path().filename().string()));
+    }
+    return threads;
+}
+
+static ovms::cpu_cores_t getThreadAffinity(pid_t tid) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    ovms::cpu_cores_t cores;
+    if (sched_getaffinity(tid, sizeof(set), &set) != 0) {
+        return cores;
+    }
+    for (uint16_t core = 0; core < CPU_SETSIZE; ++core) {
+        if (CPU_ISSET(core, &set)) {
+            cores.push_back(core);
+        }
+    }
+    return cores;
+}
+
+// Core the thread was last executed on, 39th field of /proc/<pid>/task/<tid>/stat
+static int getThreadLastCore(pid_t tid) {
+    std::ifstream statFile("/proc/self/task/" + std::to_string(tid) + "/stat");
+    std::string stat((std::istreambuf_iterator<char>(statFile)), std::istreambuf_iterator<char>());
+    // Thread name in parentheses may contain spaces
+    std::istringstream fields(stat.substr(stat.rfind(')') + 2));
+    std::string field;
+    for (int i = 3; i <= 39 && (fields >> field); ++i) {
+    }
+    return std::stoi(field);
+}
+
+TEST_F(TestLoadModel, InferenceThreadsRunOnPlacementCores) {
+    const ovms::cpu_cores_t availableCores = getThreadAffinity(0);
+    if (availableCores.size() < 2) {
+        GTEST_SKIP() << "Placement can be verified with at least 2 cores available";
+    }
+    const ovms::cpu_cores_t placementCores{availableCores.back()};
+    auto config = DUMMY_MODEL_CONFIG;
+    config.setCpuCores(placementCores);
+    config.setNireq(2);
+    const auto threadsBeforeLoad = getProcessThreads();
+    ovms::ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore);
+    ASSERT_EQ(modelInstance.loadModel(config), ovms::StatusCode::OK);
+    // Calling thread is bound to placement cores only during load
+    EXPECT_EQ(getThreadAffinity(0), availableCores);
+    auto& queue = modelInstance.getInferRequestsQueue();
+    for (int i = 0; i < 10; ++i) {
+        const int streamId = queue.getIdleStream().get();
+        auto& inferRequest = queue.getInferRequest(streamId);
+        inferRequest.start_async();
+        inferRequest.wait();
+        queue.returnStream(streamId);
+    }
+    std::set<pid_t> inferenceThreads;
+    for (pid_t tid : getProcessThreads()) {
+        if (threadsBeforeLoad.count(tid) == 0) {
+            inferenceThreads.insert(tid);
+        }
+    }
+    ASSERT_FALSE(inferenceThreads.empty());
+    for (pid_t tid : inferenceThreads) {
+        EXPECT_EQ(getThreadAffinity(tid), placementCores) << "thread: " << tid;
+        EXPECT_EQ(getThreadLastCore(tid), placementCores[0]) << "thread: " << tid;
+    }
+    modelInstance.retireModel();
+}
+
 TEST_F(TestLoadModel, UnSuccessfulLoadWhenNireqTooHigh) {
     ovms::ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore);
     auto config = DUMMY_MODEL_CONFIG;
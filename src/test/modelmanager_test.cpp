@@ -998,6 +998,38 @@ TEST_F(ModelManagerWatcher, ConfigReloadingShouldAddNewModel) {
     modelMock.reset();
 }
 
+class MockModelManagerWithFileSystemEvents : public MockModelManager {
+public:
+    MockModelManagerWithFileSystemEvents() {
+        // polling interval long enough to make sure changes are detected by filesystem events
+        this->watcherIntervalMillisec = 60000;
+        this->filesystemEventsEnabled = true;
+    }
+};
+
+TEST_F(ModelManagerWatcher, ConfigReloadingWithFileSystemEventsShouldAddNewModel) {
+    std::string fileToReload = this->getFilePath("/ovms_config_file2.json");
+    createConfigFileWithContent(getConfig1Model(this->getFilePath("/models/dummy1")), fileToReload);
+    modelMock = std::make_shared<MockModel>();
+    MockModelManagerWithFileSystemEvents manager;
+    EXPECT_CALL(*modelMock, addVersion(_, _, _, _))
+        .WillRepeatedly(Return(ovms::Status(ovms::StatusCode::OK)));
+
+    auto status = manager.startFromFile(fileToReload);
+    manager.startWatcher(true);
+    EXPECT_EQ(manager.getModels().size(), 1);
+    EXPECT_EQ(status, ovms::StatusCode::OK);
+    createConfigFileWithContent(getConfig2Models(this->getFilePath("/models/dummy1"), this->getFilePath("/models/dummy2")), fileToReload);
+    auto start = std::chrono::steady_clock::now();
+    while ((manager.getModels().size() != 2) &&
+           (std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count() < 5000)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(manager.getModels().size(), 2);
+    manager.join();
+    modelMock.reset();
+}
+
 TEST_F(ModelManagerWatcher, ConfigReloadingShouldAddNewModelRelativePath) {
     std::string fileToReload = this->getFilePath("/ovms_config_file2.json");
     createConfigFileWithContent(relative_config_1_model, fileToReload);
@@ -1454,6 +1486,49 @@ TEST_F(ModelManager, ConfigReloadingWithTwoModelsWithTheSameNameRelativePath) {
     modelMock.reset();
 }
 
+class ModelManagerWithModelLoadingThreads : public ConstructorEnabledModelManager {
+public:
+    ModelManagerWithModelLoadingThreads(uint32_t threads, uint64_t memoryBudgetBytes = 0) {
+        this->modelLoadingThreads = threads;
+        this->modelLoadingMemoryBudgetBytes = memoryBudgetBytes;
+    }
+};
+
+static const char* configWithFourDummyModels = R"({
+   "model_config_list": [
+    {"config": {"name": "dummy_1", "base_path": "/ovms/src/test/dummy"}},
+    {"config": {"name": "dummy_2", "base_path": "/ovms/src/test/dummy"}},
+    {"config": {"name": "dummy_3", "base_path": "/ovms/src/test/dummy"}},
+    {"config": {"name": "dummy_4", "base_path": "/ovms/src/test/dummy"}}]})";
+
+TEST_F(ModelManager, ParallelModelLoadingLoadsAllModels) {
+    std::string configFile = this->getFilePath("/ovms_config_file.json");
+    createConfigFileWithContent(configWithFourDummyModels, configFile);
+    ModelManagerWithModelLoadingThreads manager(4);
+    ASSERT_EQ(manager.startFromFile(configFile), ovms::StatusCode::OK);
+    ASSERT_EQ(manager.getModels().size(), 4);
+    for (const auto& name : {"dummy_1", "dummy_2", "dummy_3", "dummy_4"}) {
+        auto model = manager.findModelByName(name);
+        ASSERT_NE(model, nullptr) << name;
+        ASSERT_NE(model->getDefaultModelInstance(), nullptr) << name;
+        EXPECT_EQ(model->getDefaultModelInstance()->getStatus().getState(), ovms::ModelVersionState::AVAILABLE) << name;
+    }
+}
+
+TEST_F(ModelManager, ParallelModelLoadingWithMemoryBudgetSmallerThanModelLoadsAllModels) {
+    std::string configFile = this->getFilePath("/ovms_config_file.json");
+    createConfigFileWithContent(configWithFourDummyModels, configFile);
+    ModelManagerWithModelLoadingThreads manager(4, 1);
+    ASSERT_EQ(manager.startFromFile(configFile), ovms::StatusCode::OK);
+    ASSERT_EQ(manager.getModels().size(), 4);
+    for (const auto& name : {"dummy_1", "dummy_2", "dummy_3", "dummy_4"}) {
+        auto model = manager.findModelByName(name);
+        ASSERT_NE(model, nullptr) << name;
+        ASSERT_NE(model->getDefaultModelInstance(), nullptr) << name;
+        EXPECT_EQ(model->getDefaultModelInstance()->getStatus().getState(), ovms::ModelVersionState::AVAILABLE) << name;
+    }
+}
+
 class MockModelManagerWithModelInstancesJustChangingStates : public ovms::ModelManager {
 public:
     std::shared_ptr<ovms::Model> modelFactory(const std::string& name, const bool isStateful) override {
@@ -325,14 +325,17 @@ TEST(OvmsConfigTest, positiveMulti) {
         "--file_system_poll_wait_seconds", "2",
         "--sequence_cleaner_poll_wait_minutes", "7",
         "--custom_node_resources_cleaner_interval_seconds", "8",
+        "--model_loading_threads", "3",
+        "--model_loading_memory_budget_mb", "2048",
         "--cpu_extension", "/ovms",
         "--cache_dir", "/tmp/model_cache",
+        "--precompile_staged_versions",
         "--log_path", "/tmp/log_path",
         "--log_level", "ERROR",
         "--grpc_max_threads", "100",
         "--grpc_memory_quota", "1000000",
         "--config_path", "/config.json"};
-    int arg_count = 35;
+    int arg_count = 40;
     ConstructorEnabledConfig config;
     config.parse(arg_count, n_argv);
 
@@ -346,8 +349,11 @@ TEST(OvmsConfigTest, positiveMulti) {
     EXPECT_EQ(config.filesystemPollWaitSeconds(), 2);
     EXPECT_EQ(config.sequenceCleanerPollWaitMinutes(), 7);
     EXPECT_EQ(config.resourcesCleanerPollWaitSeconds(), 8);
+    EXPECT_EQ(config.modelLoadingThreads(), 3);
+    EXPECT_EQ(config.modelLoadingMemoryBudgetMB(), 2048);
     EXPECT_EQ(config.cpuExtensionLibraryPath(), "/ovms");
     EXPECT_EQ(config.cacheDir(), "/tmp/model_cache");
+    EXPECT_EQ(config.precompileStagedVersions(), true);
     EXPECT_EQ(config.logPath(), "/tmp/log_path");
     EXPECT_EQ(config.logLevel(), "ERROR");
     EXPECT_EQ(config.configPath(), "/config.json");
@@ -20,7 +20,9 @@
 #include <filesystem>
 #include <fstream>
 #include <future>
+#include <numeric>
 #include <thread>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -34,6 +36,9 @@
 #include "../capi_frontend/inferencetensor.hpp"
 #include "../deserialization.hpp"
 #include "../executingstreamidguard.hpp"
+#include "../execution_context.hpp"
+#include "../grpc_utils.hpp"
+#include "../http_server.hpp"
 #include "../kfs_frontend/kfs_utils.hpp"
 #include "../modelinstance.hpp"
 #include "../modelinstanceunloadguard.hpp"
@@ -543,6 +548,74 @@ TYPED_TEST(TestPredict, SuccesfullOnDummyModel) {
     this->performPredict(config.getName(), config.getVersion(), request);
 }
 
+TYPED_TEST(TestPredict, StopsProcessingWhenClientDoesNotWait) {
+    typename TypeParam::first_type request;
+    Preparer<typename TypeParam::first_type> preparer;
+    preparer.preparePredictRequest(request,
+        {{DUMMY_MODEL_INPUT_NAME,
+            std::tuple<ovms::signed_shape_t, ovms::Precision>{{1, 10}, ovms::Precision::FP32}}});
+    ovms::ModelConfig config = DUMMY_MODEL_CONFIG;
+    config.setBatchSize(1);
+    ASSERT_EQ(this->manager.reloadModelWithVersions(config), ovms::StatusCode::OK_RELOADED);
+    std::shared_ptr<ovms::ModelInstance> modelInstance;
+    std::unique_ptr<ovms::ModelInstanceUnloadGuard> modelInstanceUnloadGuard;
+    ASSERT_EQ(this->manager.getModelInstance(config.getName(), config.getVersion(), modelInstance, modelInstanceUnloadGuard), ovms::StatusCode::OK);
+
+    ovms::ExecutionContext executionContext = DEFAULT_TEST_CONTEXT;
+    executionContext.deadline = std::chrono::steady_clock::now() + std::chrono::minutes(1);
+    typename TypeParam::second_type response;
+    EXPECT_EQ(modelInstance->infer(&request, &response, modelInstanceUnloadGuard, &executionContext), ovms::StatusCode::OK);
+
+    executionContext.deadline = std::chrono::steady_clock::now();
+    typename TypeParam::second_type expiredResponse;
+    EXPECT_EQ(modelInstance->infer(&request, &expiredResponse, modelInstanceUnloadGuard, &executionContext), ovms::StatusCode::REQUEST_DEADLINE_EXCEEDED);
+
+    executionContext.deadline.reset();
+    executionContext.cancellationCheck = []() { return true; };
+    typename TypeParam::second_type cancelledResponse;
+    EXPECT_EQ(modelInstance->infer(&request, &cancelledResponse, modelInstanceUnloadGuard, &executionContext), ovms::StatusCode::REQUEST_CANCELLED);
+}
+
+TYPED_TEST(TestPredict, RejectsRequestWhenTooManyRequestsAreWaiting) {
+    typename TypeParam::first_type request;
+    Preparer<typename TypeParam::first_type> preparer;
+    preparer.preparePredictRequest(request,
+        {{DUMMY_MODEL_INPUT_NAME,
+            std::tuple<ovms::signed_shape_t, ovms::Precision>{{1, 10}, ovms::Precision::FP32}}});
+    ovms::ModelConfig config = DUMMY_MODEL_CONFIG;
+    config.setBatchSize(1);
+    config.setNireq(1);
+    config.setMaxWaitingRequests(1);
+    ASSERT_EQ(this->manager.reloadModelWithVersions(config), ovms::StatusCode::OK_RELOADED);
+    std::shared_ptr<ovms::ModelInstance> modelInstance;
+    std::unique_ptr<ovms::ModelInstanceUnloadGuard> modelInstanceUnloadGuard;
+    ASSERT_EQ(this->manager.getModelInstance(config.getName(), config.getVersion(), modelInstance, modelInstanceUnloadGuard), ovms::StatusCode::OK);
+
+    // Only infer request is busy and one request is already waiting for it
+    auto& queue = modelInstance->getInferRequestsQueue();
+    const int streamId = queue.getIdleStream().get();
+    auto waitingRequest = queue.getIdleStream();
+    ASSERT_EQ(queue.getWaitersCount(), 1);
+    typename TypeParam::second_type response;
+    auto status = modelInstance->infer(&request, &response, modelInstanceUnloadGuard);
+    EXPECT_EQ(status, ovms::StatusCode::INFER_QUEUE_OVERLOADED);
+    EXPECT_EQ(ovms::grpc(status).error_code(), grpc::StatusCode::RESOURCE_EXHAUSTED);
+    EXPECT_EQ(ovms::http(status), tensorflow::serving::net_http::HTTPStatusCode::SERVICE_UNAV);
+
+    // Admission limits are applied to loaded version without reload
+    config.setMaxWaitingRequests(2);
+    ASSERT_EQ(this->manager.reloadModelWithVersions(config), ovms::StatusCode::OK);
+    std::shared_ptr<ovms::ModelInstance> sameModelInstance;
+    std::unique_ptr<ovms::ModelInstanceUnloadGuard> sameModelInstanceUnloadGuard;
+    ASSERT_EQ(this->manager.getModelInstance(config.getName(), config.getVersion(), sameModelInstance, sameModelInstanceUnloadGuard), ovms::StatusCode::OK);
+    EXPECT_EQ(sameModelInstance, modelInstance);
+    EXPECT_EQ(modelInstance->admitRequest(queue), ovms::StatusCode::OK);
+
+    queue.returnStream(streamId);
+    queue.returnStream(waitingRequest.get());
+    EXPECT_EQ(modelInstance->infer(&request, &response, modelInstanceUnloadGuard), ovms::StatusCode::OK);
+}
+
 static const char* oneDummyWithMappedInputConfig = R"(
 {
     "model_config_list": [
@@ -1119,6 +1192,149 @@ TYPED_TEST(TestPredict, ChangeBatchSizeViaRequestAndConfigChange) {
     this->checkOutputShape(response, {3, 10});
 }
 
+TYPED_TEST(TestPredict, ReshapeViaRequestServedByShapeVariants) {
+    using namespace ovms;
+    ModelConfig config = DUMMY_MODEL_CONFIG;
+    config.setBatchingParams("");
+    config.parseShapeParameter("auto");
+    config.setMaxShapeVariants(2);
+    ASSERT_EQ(this->manager.reloadModelWithVersions(config), ovms::StatusCode::OK_RELOADED);
+    std::shared_ptr<ovms::ModelInstance> modelInstance;
+    std::unique_ptr<ModelInstanceUnloadGuard> modelInstanceUnloadGuard;
+    ASSERT_EQ(this->manager.getModelInstance(config.getName(), config.getVersion(), modelInstance, modelInstanceUnloadGuard), ovms::StatusCode::OK);
+    modelInstanceUnloadGuard.reset();
+
+    typename TypeParam::second_type response;
+    ASSERT_EQ(this->performInferenceWithShape(response, {1, 12}), ovms::StatusCode::OK);
+    this->checkOutputShape(response, {1, 12});
+    EXPECT_EQ(modelInstance->getShapeVariantsCount(), 1);
+    // Model is not reloaded, initial shape is still served without compilation
+    EXPECT_EQ(modelInstance->getInputsInfo().at(DUMMY_MODEL_INPUT_NAME)->getShape(), Shape({1, 10}));
+    ASSERT_EQ(this->performInferenceWithShape(response, {1, 10}), ovms::StatusCode::OK);
+    this->checkOutputShape(response, {1, 10});
+    ASSERT_EQ(this->performInferenceWithShape(response, {1, 12}), ovms::StatusCode::OK);
+    EXPECT_EQ(modelInstance->getShapeVariantsCount(), 1);
+
+    ASSERT_EQ(this->performInferenceWithShape(response, {1, 13}), ovms::StatusCode::OK);
+    this->checkOutputShape(response, {1, 13});
+    EXPECT_EQ(modelInstance->getShapeVariantsCount(), 2);
+    // Least recently used variant is evicted over the limit
+    ASSERT_EQ(this->performInferenceWithShape(response, {1, 14}), ovms::StatusCode::OK);
+    this->checkOutputShape(response, {1, 14});
+    EXPECT_EQ(modelInstance->getShapeVariantsCount(), 2);
+    ASSERT_EQ(this->performInferenceWithShape(response, {1, 12}), ovms::StatusCode::OK);
+    this->checkOutputShape(response, {1, 12});
+    EXPECT_EQ(modelInstance->getShapeVariantsCount(), 2);
+
+    // Config change drops compiled variants
+    config.setMaxShapeVariants(1);
+    ASSERT_EQ(this->manager.reloadModelWithVersions(config), ovms::StatusCode::OK_RELOADED);
+    EXPECT_EQ(modelInstance->getShapeVariantsCount(), 0);
+}
+
+TYPED_TEST(TestPredict, ChangeBatchSizeViaRequestServedByShapeVariants) {
+    using namespace ovms;
+    ModelConfig config = DUMMY_MODEL_CONFIG;
+    config.setBatchingParams("auto");
+    config.setMaxShapeVariants(1);
+    ASSERT_EQ(this->manager.reloadModelWithVersions(config), ovms::StatusCode::OK_RELOADED);
+    std::shared_ptr<ovms::ModelInstance> modelInstance;
+    std::unique_ptr<ModelInstanceUnloadGuard> modelInstanceUnloadGuard;
+    ASSERT_EQ(this->manager.getModelInstance(config.getName(), config.getVersion(), modelInstance, modelInstanceUnloadGuard), ovms::StatusCode::OK);
+    modelInstanceUnloadGuard.reset();
+
+    typename TypeParam::second_type response;
+    ASSERT_EQ(this->performInferenceWithBatchSize(response, 3), ovms::StatusCode::OK);
+    this->checkOutputShape(response, {3, 10});
+    EXPECT_EQ(modelInstance->getShapeVariantsCount(), 1);
+    ASSERT_EQ(this->performInferenceWithBatchSize(response, 1), ovms::StatusCode::OK);
+    this->checkOutputShape(response, {1, 10});
+    EXPECT_EQ(modelInstance->getBatchSize().value(), Dimension(1));
+}
+
+TYPED_TEST(TestPredict, ShapeBucketsPadRequestsAndTrimResponses) {
+    using namespace ovms;
+    ModelConfig config = DUMMY_MODEL_CONFIG;
+    config.setBatchingParams("");
+    ShapeBuckets buckets;
+    buckets.dimension = 1;
+    buckets.sizes = {4, 8, 12};
+    buckets.outputs = {{DUMMY_MODEL_OUTPUT_NAME, 1}};
+    config.setShapeBuckets({{DUMMY_MODEL_INPUT_NAME, buckets}});
+    ASSERT_EQ(this->manager.reloadModelWithVersions(config), ovms::StatusCode::OK_RELOADED);
+    std::shared_ptr<ovms::ModelInstance> modelInstance;
+    std::unique_ptr<ModelInstanceUnloadGuard> modelInstanceUnloadGuard;
+    ASSERT_EQ(this->manager.getModelInstance(config.getName(), config.getVersion(), modelInstance, modelInstanceUnloadGuard), ovms::StatusCode::OK);
+    modelInstanceUnloadGuard.reset();
+    // Model is compiled for the largest bucket
+    EXPECT_EQ(modelInstance->getInputsInfo().at(DUMMY_MODEL_INPUT_NAME)->getShape(), Shape({1, 12}));
+    EXPECT_EQ(modelInstance->getOutputsInfo().at(DUMMY_MODEL_OUTPUT_NAME)->getShape(), Shape({1, Dimension(1, 12)}));
+
+    typename TypeParam::second_type response;
+    // Dummy model adds 1 to input, padded values must not leak into trimmed response
+    auto inferAndCheck = [this, &response](size_t size) {
+        std::vector<float> data(size);
+        std::iota(data.begin(), data.end(), 1.0f);
+        typename TypeParam::first_type request;
+        preparePredictRequest(request,
+            {{DUMMY_MODEL_INPUT_NAME, std::tuple<ovms::signed_shape_t, ovms::Precision>{{1, static_cast<int64_t>(size)}, ovms::Precision::FP32}}}, data);
+        ASSERT_EQ(this->performInferenceWithRequest(request, response), ovms::StatusCode::OK);
+        this->checkOutputShape(response, {1, static_cast<int64_t>(size)});
+        std::vector<float> expected(size);
+        std::iota(expected.begin(), expected.end(), 2.0f);
+        this->checkOutputValues(response, expected, DUMMY_MODEL_OUTPUT_NAME);
+    };
+    inferAndCheck(10);
+    EXPECT_EQ(modelInstance->getShapeVariantsCount(), 0);
+    inferAndCheck(3);
+    EXPECT_EQ(modelInstance->getShapeVariantsCount(), 1);
+    inferAndCheck(4);
+    EXPECT_EQ(modelInstance->getShapeVariantsCount(), 1);
+    inferAndCheck(7);
+    EXPECT_EQ(modelInstance->getShapeVariantsCount(), 2);
+    // Sizes over the largest bucket are rejected by validation
+    EXPECT_EQ(this->performInferenceWithShape(response, {1, 13}), ovms::StatusCode::INVALID_SHAPE);
+    EXPECT_EQ(this->performInferenceWithShape(response, {2, 4}), ovms::StatusCode::INVALID_BATCH_SIZE);
+}
+
+TYPED_TEST(TestPredict, ShapeBucketsDoNotTrimOutputsNotConfigured) {
+    using namespace ovms;
+    ModelConfig config = DUMMY_MODEL_CONFIG;
+    config.setBatchingParams("");
+    ShapeBuckets buckets;
+    buckets.dimension = 1;
+    buckets.sizes = {4, 8};
+    config.setShapeBuckets({{DUMMY_MODEL_INPUT_NAME, buckets}});
+    ASSERT_EQ(this->manager.reloadModelWithVersions(config), ovms::StatusCode::OK_RELOADED);
+    std::shared_ptr<ovms::ModelInstance> modelInstance;
+    std::unique_ptr<ModelInstanceUnloadGuard> modelInstanceUnloadGuard;
+    ASSERT_EQ(this->manager.getModelInstance(config.getName(), config.getVersion(), modelInstance, modelInstanceUnloadGuard), ovms::StatusCode::OK);
+    modelInstanceUnloadGuard.reset();
+    EXPECT_EQ(modelInstance->getOutputsInfo().at(DUMMY_MODEL_OUTPUT_NAME)->getShape(), Shape({1, 8}));
+
+    // Output has the bucket size in padded dimension, but it is returned as computed for padded input
+    std::vector<float> data{1, 2, 3};
+    typename TypeParam::first_type request;
+    preparePredictRequest(request,
+        {{DUMMY_MODEL_INPUT_NAME, std::tuple<ovms::signed_shape_t, ovms::Precision>{{1, 3}, ovms::Precision::FP32}}}, data);
+    typename TypeParam::second_type response;
+    ASSERT_EQ(this->performInferenceWithRequest(request, response), ovms::StatusCode::OK);
+    this->checkOutputShape(response, {1, 4});
+    this->checkOutputValues(response, {2, 3, 4, 1}, DUMMY_MODEL_OUTPUT_NAME);
+}
+
+TYPED_TEST(TestPredict, ShapeBucketsNotAllowedWithShapeAuto) {
+    using namespace ovms;
+    ModelConfig config = DUMMY_MODEL_CONFIG;
+    config.setBatchingParams("");
+    config.parseShapeParameter("auto");
+    ShapeBuckets buckets;
+    buckets.dimension = 1;
+    buckets.sizes = {4, 8};
+    config.setShapeBuckets({{DUMMY_MODEL_INPUT_NAME, buckets}});
+    EXPECT_EQ(this->manager.reloadModelWithVersions(config), ovms::StatusCode::MODEL_CONFIG_INVALID);
+}
+
 /*
  * Scenario - perform inference with NHWC input layout changed via this->config.json.
  *
@@ -13,8 +13,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //*****************************************************************************
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
+#include <future>
 #include <set>
 #include <sstream>
 #include <string>
@@ -1001,6 +1003,120 @@ TEST_F(PythonFlowTest, PythonCalculatorTestSingleInSingleOut) {
     checkDummyResponse("output", data, req, res, 1 /* expect +1 */, 1, "mediaDummy");
 }
 
+TEST_F(PythonFlowTest, PythonCalculatorTestExecuteBatchConcurrentRequests) {
+    ConstructorEnabledModelManager manager{"", getPythonBackend()};
+    std::string testPbtxt = R"(
+    input_stream: "OVMS_PY_TENSOR:input"
+    output_stream: "OVMS_PY_TENSOR:output"
+    output_stream: "OVMS_PY_TENSOR_BATCH_SIZE:batch_size"
+        node {
+            name: "pythonNode"
+            calculator: "PythonExecutorCalculator"
+            input_side_packet: "PYTHON_NODE_RESOURCES:py"
+            input_stream: "INPUT:input"
+            output_stream: "OUTPUT:output"
+            output_stream: "BATCH_SIZE:batch_size"
+            node_options: {
+                [type.googleapis.com / mediapipe.PythonExecutorCalculatorOptions]: {
+                    handler_path: "/ovms/src/test/mediapipe/python/scripts/symmetric_increment_batch.py"
+                    max_batch_size: 4
+                    batch_timeout_us: 500000
+                }
+            }
+        }
+    )";
+    ovms::MediapipeGraphConfig mgc{"mediaDummy", "", ""};
+    DummyMediapipeGraphDefinition mediapipeDummy("mediaDummy", mgc, testPbtxt, getPythonBackend());
+    mediapipeDummy.inputConfig = testPbtxt;
+    ASSERT_EQ(mediapipeDummy.validate(manager), StatusCode::OK);
+
+    const size_t requestsCount = 8;
+    std::vector<std::shared_ptr<MediapipeGraphExecutor>> pipelines(requestsCount);
+    for (auto& pipeline : pipelines) {
+        ASSERT_EQ(mediapipeDummy.create(pipeline, nullptr, nullptr), StatusCode::OK);
+    }
+    // Requests are released together, so that all of them are submitted within the batch timeout
+    std::promise<void> startSignal;
+    std::shared_future<void> start = startSignal.get_future().share();
+    std::vector<float> batchSizes(requestsCount, 0);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < requestsCount; ++i) {
+        threads.emplace_back([&pipelines, &batchSizes, start, i, this]() {
+            KFSRequest req;
+            KFSResponse res;
+            const std::vector<float> data(DUMMY_MODEL_OUTPUT_SIZE, static_cast<float>(i));
+            req.set_model_name("mediaDummy");
+            prepareKFSInferInputTensor(req, "input", std::tuple<ovms::signed_shape_t, const ovms::Precision>{{1, DUMMY_MODEL_OUTPUT_SIZE}, ovms::Precision::FP32}, data, false);
+            ServableMetricReporter* smr{nullptr};
+            start.wait();
+            ASSERT_EQ(pipelines[i]->infer(&req, &res, this->defaultExecutionContext, smr), StatusCode::OK);
+            checkDummyResponse("output", data, req, res, 1 /* expect +1 */, 1, "mediaDummy", 2);
+            auto it = std::find_if(res.outputs().begin(), res.outputs().end(), [](const ::KFSResponse::InferOutputTensor& tensor) {
+                return tensor.name() == "batch_size";
+            });
+            ASSERT_NE(it, res.outputs().end());
+            const std::string& content = res.raw_output_contents(it - res.outputs().begin());
+            ASSERT_EQ(content.size(), sizeof(float));
+            batchSizes[i] = *reinterpret_cast<const float*>(content.data());
+        });
+    }
+    startSignal.set_value();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (float batchSize : batchSizes) {
+        EXPECT_GE(batchSize, 1);
+        EXPECT_LE(batchSize, 4);
+    }
+    // At least some of the concurrent requests have to be executed in a single execute_batch call
+    EXPECT_GT(*std::max_element(batchSizes.begin(), batchSizes.end()), 1);
+}
+
+TEST_F(PythonFlowTest, PythonCalculatorTestWorkerProcessesConcurrentRequests) {
+    ConstructorEnabledModelManager manager{"", getPythonBackend()};
+    std::string testPbtxt = R"(
+    input_stream: "OVMS_PY_TENSOR:input"
+    output_stream: "OVMS_PY_TENSOR:output"
+        node {
+            name: "pythonNode"
+            calculator: "PythonExecutorCalculator"
+            input_side_packet: "PYTHON_NODE_RESOURCES:py"
+            input_stream: "INPUT:input"
+            output_stream: "OUTPUT:output"
+            node_options: {
+                [type.googleapis.com / mediapipe.PythonExecutorCalculatorOptions]: {
+                    handler_path: "/ovms/src/test/mediapipe/python/scripts/symmetric_increment.py"
+                    worker_processes: 2
+                }
+            }
+        }
+    )";
+    ovms::MediapipeGraphConfig mgc{"mediaDummy", "", ""};
+    DummyMediapipeGraphDefinition mediapipeDummy("mediaDummy", mgc, testPbtxt, getPythonBackend());
+    mediapipeDummy.inputConfig = testPbtxt;
+    ASSERT_EQ(mediapipeDummy.validate(manager), StatusCode::OK);
+
+    const size_t requestsCount = 8;
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < requestsCount; ++i) {
+        threads.emplace_back([&mediapipeDummy, i, this]() {
+            std::shared_ptr<MediapipeGraphExecutor> pipeline;
+            ASSERT_EQ(mediapipeDummy.create(pipeline, nullptr, nullptr), StatusCode::OK);
+            KFSRequest req;
+            KFSResponse res;
+            const std::vector<float> data(DUMMY_MODEL_OUTPUT_SIZE, static_cast<float>(i));
+            req.set_model_name("mediaDummy");
+            prepareKFSInferInputTensor(req, "input", std::tuple<ovms::signed_shape_t, const ovms::Precision>{{1, DUMMY_MODEL_OUTPUT_SIZE}, ovms::Precision::FP32}, data, false);
+            ServableMetricReporter* smr{nullptr};
+            ASSERT_EQ(pipeline->infer(&req, &res, this->defaultExecutionContext, smr), StatusCode::OK);
+            checkDummyResponse("output", data, req, res, 1 /* expect +1 */, 1, "mediaDummy");
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
 TEST_F(PythonFlowTest, PythonCalculatorTestReturnCustomDatatype) {
     ConstructorEnabledModelManager manager{"", getPythonBackend()};
     std::string testPbtxt = R"(
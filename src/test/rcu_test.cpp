@@ -0,0 +1,139 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../rcu.hpp"
+
+using namespace ovms;
+
+TEST(RcuSnapshot, ReadPublishedData) {
+    RcuSnapshot<std::map<std::string, int>> snapshot;
+    {
+        RcuReadGuard guard;
+        EXPECT_TRUE(snapshot.read(guard).empty());
+    }
+    snapshot.publish(std::make_unique<const std::map<std::string, int>>(std::map<std::string, int>{{"dummy", 1}}));
+    RcuReadGuard guard;
+    EXPECT_EQ(snapshot.read(guard).at("dummy"), 1);
+}
+
+TEST(RcuSnapshot, NestedGuards) {
+    RcuSnapshot<int> snapshot;
+    snapshot.publish(std::make_unique<const int>(1));
+    RcuReadGuard outer;
+    {
+        RcuReadGuard inner;
+        EXPECT_EQ(snapshot.read(inner), 1);
+    }
+    EXPECT_EQ(snapshot.read(outer), 1);
+}
+
+TEST(RcuSnapshot, PublishWaitsForReaders) {
+    RcuSnapshot<int> snapshot;
+    snapshot.publish(std::make_unique<const int>(1));
+    std::promise<void> readStarted;
+    std::promise<void> finishRead;
+    std::atomic<int> valueRead{0};
+    std::thread reader([&]() {
+        RcuReadGuard guard;
+        const int& value = snapshot.read(guard);
+        readStarted.set_value();
+        finishRead.get_future().wait();
+        // Previous snapshot still has to be valid here
+        valueRead = value;
+    });
+    readStarted.get_future().wait();
+    auto publishFuture = std::async(std::launch::async, [&snapshot]() {
+        snapshot.publish(std::make_unique<const int>(2));
+    });
+    EXPECT_EQ(publishFuture.wait_for(std::chrono::milliseconds(100)), std::future_status::timeout);
+    finishRead.set_value();
+    publishFuture.get();
+    reader.join();
+    EXPECT_EQ(valueRead, 1);
+    RcuReadGuard guard;
+    EXPECT_EQ(snapshot.read(guard), 2);
+}
+
+TEST(RcuSnapshot, NewReadersAreNotBlockedByWaitingWriter) {
+    RcuSnapshot<int> snapshot;
+    snapshot.publish(std::make_unique<const int>(1));
+    std::promise<void> readStarted;
+    std::promise<void> finishRead;
+    std::thread reader([&]() {
+        RcuReadGuard guard;
+        snapshot.read(guard);
+        readStarted.set_value();
+        finishRead.get_future().wait();
+    });
+    readStarted.get_future().wait();
+    auto publishFuture = std::async(std::launch::async, [&snapshot]() {
+        snapshot.publish(std::make_unique<const int>(2));
+    });
+    ASSERT_EQ(publishFuture.wait_for(std::chrono::milliseconds(100)), std::future_status::timeout);
+    // Thread reading for the first time needs to acquire reader slot while writer waits
+    auto newReaderFuture = std::async(std::launch::async, [&snapshot]() {
+        RcuReadGuard guard;
+        return snapshot.read(guard);
+    });
+    EXPECT_EQ(newReaderFuture.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_EQ(newReaderFuture.get(), 2);
+    finishRead.set_value();
+    publishFuture.get();
+    reader.join();
+}
+
+TEST(RcuSnapshot, ConcurrentReadersAndWriter) {
+    struct Data {
+        int first = 0;
+        int second = 0;
+    };
+    RcuSnapshot<Data> snapshot;
+    std::atomic<bool> stop{false};
+    std::atomic<int> inconsistentReads{0};
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; i++) {
+        readers.emplace_back([&]() {
+            while (!stop) {
+                RcuReadGuard guard;
+                const auto& data = snapshot.read(guard);
+                if (data.first != data.second) {
+                    inconsistentReads++;
+                }
+            }
+        });
+    }
+    for (int i = 1; i <= 1000; i++) {
+        auto data = std::make_unique<Data>();
+        data->first = i;
+        data->second = i;
+        snapshot.publish(std::move(data));
+    }
+    stop = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(inconsistentReads, 0);
+}
@@ -0,0 +1,157 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <rapidjson/document.h>
+
+#include "../kfs_frontend/kfs_grpc_inference_service.hpp"
+#include "../modelconfig.hpp"
+#include "../prediction_service_utils.hpp"
+#include "../queue.hpp"
+#include "../requestpriority.hpp"
+#include "../status.hpp"
+
+using namespace ovms;
+using testing::ElementsAre;
+
+TEST(RequestPriority, FromString) {
+    EXPECT_EQ(requestPriorityFromString("LOW"), RequestPriority::LOW);
+    EXPECT_EQ(requestPriorityFromString("medium"), RequestPriority::MEDIUM);
+    EXPECT_EQ(requestPriorityFromString("High"), RequestPriority::HIGH);
+    EXPECT_FALSE(requestPriorityFromString("URGENT").has_value());
+    EXPECT_EQ(toString(RequestPriority::HIGH), "HIGH");
+}
+
+static std::vector<RequestPriority> getAdmissionOrder(Queue<int>& queue, int stream, std::vector<std::pair<RequestPriority, std::future<int>>>& waiting) {
+    std::vector<RequestPriority> order;
+    for (size_t i = 0; i < waiting.size(); i++) {
+        queue.returnStream(stream);
+        for (auto& [priority, future] : waiting) {
+            if (future.valid() && future.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+                stream = future.get();
+                order.push_back(priority);
+                break;
+            }
+        }
+    }
+    return order;
+}
+
+TEST(RequestPriority, HigherPriorityAdmittedFirst) {
+    Queue<int> queue(1);
+    int stream = queue.getIdleStream().get();
+    std::vector<std::pair<RequestPriority, std::future<int>>> waiting;
+    waiting.emplace_back(RequestPriority::LOW, queue.getIdleStream(RequestPriority::LOW));
+    waiting.emplace_back(RequestPriority::MEDIUM, queue.getIdleStream(RequestPriority::MEDIUM));
+    waiting.emplace_back(RequestPriority::HIGH, queue.getIdleStream(RequestPriority::HIGH));
+    EXPECT_THAT(getAdmissionOrder(queue, stream, waiting), ElementsAre(RequestPriority::HIGH, RequestPriority::MEDIUM, RequestPriority::LOW));
+}
+
+TEST(RequestPriority, LowPriorityIsNotStarved) {
+    Queue<int> queue(1);
+    int stream = queue.getIdleStream().get();
+    std::vector<std::pair<RequestPriority, std::future<int>>> waiting;
+    waiting.emplace_back(RequestPriority::LOW, queue.getIdleStream(RequestPriority::LOW));
+    for (int i = 0; i < 20; i++) {
+        waiting.emplace_back(RequestPriority::HIGH, queue.getIdleStream(RequestPriority::HIGH));
+    }
+    auto order = getAdmissionOrder(queue, stream, waiting);
+    ASSERT_EQ(order.size(), waiting.size());
+    auto lowPosition = std::find(order.begin(), order.end(), RequestPriority::LOW) - order.begin();
+    // Weights of HIGH and LOW classes give LOW request one of every 10 released streams
+    EXPECT_LT(lowPosition, 10);
+    EXPECT_GT(lowPosition, 0);
+}
+
+TEST(RequestPriority, KFSRequestParameter) {
+    ::KFSRequest request;
+    RequestPriority priority = RequestPriority::LOW;
+    ASSERT_EQ(getRequestPriority(&request, priority), StatusCode::OK);
+    EXPECT_EQ(priority, RequestPriority::LOW);
+    (*request.mutable_parameters())[PRIORITY_PARAMETER_NAME].set_string_param("HIGH");
+    ASSERT_EQ(getRequestPriority(&request, priority), StatusCode::OK);
+    EXPECT_EQ(priority, RequestPriority::HIGH);
+    (*request.mutable_parameters())[PRIORITY_PARAMETER_NAME].set_string_param("URGENT");
+    EXPECT_EQ(getRequestPriority(&request, priority), StatusCode::INVALID_PRIORITY);
+    (*request.mutable_parameters())[PRIORITY_PARAMETER_NAME].set_int64_param(2);
+    EXPECT_EQ(getRequestPriority(&request, priority), StatusCode::INVALID_PRIORITY);
+}
+
+TEST(RequestPriority, ParseConfig) {
+    const char* json = R"({
+        "name": "model",
+        "base_path": "/tmp/model",
+        "priority": "HIGH"
+    })";
+    rapidjson::Document document;
+    ASSERT_FALSE(document.Parse(json).HasParseError());
+    ModelConfig config;
+    ASSERT_EQ(config.parseNode(document), StatusCode::OK);
+    EXPECT_EQ(config.getPriority(), RequestPriority::HIGH);
+
+    ModelConfig changed = config;
+    changed.setPriority(RequestPriority::LOW);
+    EXPECT_TRUE(config.isReloadRequired(changed));
+}
+
+TEST(RequestPriority, QueueReportsWaitingRequests) {
+    Queue<int> queue(1);
+    int stream = queue.getIdleStream().get();
+    EXPECT_EQ(queue.getWaitersCount(), 0);
+    EXPECT_EQ(queue.getOldestWaiterAge().count(), 0);
+    auto first = queue.getIdleStream(RequestPriority::LOW);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    auto second = queue.getIdleStream(RequestPriority::HIGH);
+    EXPECT_EQ(queue.getWaitersCount(), 2);
+    // Oldest waiter is reported regardless of its priority class
+    EXPECT_GE(queue.getOldestWaiterAge(), std::chrono::milliseconds(10));
+    queue.returnStream(stream);
+    stream = second.get();
+    EXPECT_EQ(queue.getWaitersCount(), 1);
+    queue.returnStream(stream);
+    first.get();
+    EXPECT_EQ(queue.getWaitersCount(), 0);
+    EXPECT_EQ(queue.getOldestWaiterAge().count(), 0);
+}
+
+TEST(RequestPriority, ParseAdmissionControlConfig) {
+    const char* json = R"({
+        "name": "model",
+        "base_path": "/tmp/model",
+        "max_waiting_requests": 16,
+        "max_queue_wait_ms": 250
+    })";
+    rapidjson::Document document;
+    ASSERT_FALSE(document.Parse(json).HasParseError());
+    ModelConfig config;
+    ASSERT_EQ(config.parseNode(document), StatusCode::OK);
+    EXPECT_EQ(config.getMaxWaitingRequests(), 16);
+    EXPECT_EQ(config.getMaxQueueWaitMs(), 250);
+
+    // Admission control limits are applied to loaded model versions without reload
+    ModelConfig changed = config;
+    changed.setMaxQueueWaitMs(0);
+    changed.setMaxWaitingRequests(0);
+    EXPECT_FALSE(config.isReloadRequired(changed));
+}
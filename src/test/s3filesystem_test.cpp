@@ -0,0 +1,141 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <atomic>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../modelmanager.hpp"
+#include "../s3filesystem.hpp"
+#include "fake_cloud_storage_server.hpp"
+
+using namespace ovms;
+
+namespace {
+class S3FileSystemTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        server = std::make_unique<FakeCloudStorageServer>(FakeCloudStorageServer::Protocol::S3);
+        setEnv("S3_ENDPOINT", server->getEndpoint());
+        setEnv("AWS_ACCESS_KEY_ID", "key");
+        setEnv("AWS_SECRET_ACCESS_KEY", "secret");
+        setEnv("AWS_REGION", "us-east-1");
+        setEnv("AWS_EC2_METADATA_DISABLED", "true");
+        unsetEnv("AWS_PROFILE");
+    }
+
+    void TearDown() override {
+        for (const auto& [name, value] : previousEnv) {
+            if (value) {
+                ::setenv(name.c_str(), value->c_str(), 1);
+            } else {
+                ::unsetenv(name.c_str());
+            }
+        }
+        server.reset();
+    }
+
+    void setEnv(const std::string& name, const std::string& value) {
+        rememberEnv(name);
+        ::setenv(name.c_str(), value.c_str(), 1);
+    }
+
+    void unsetEnv(const std::string& name) {
+        rememberEnv(name);
+        ::unsetenv(name.c_str());
+    }
+
+    void rememberEnv(const std::string& name) {
+        const char* value = std::getenv(name.c_str());
+        previousEnv.emplace(name, value ? std::optional<std::string>(value) : std::nullopt);
+    }
+
+    static std::string readFile(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        std::stringstream ss;
+        ss << file.rdbuf();
+        return ss.str();
+    }
+
+    std::unique_ptr<FakeCloudStorageServer> server;
+    std::map<std::string, std::optional<std::string>> previousEnv;
+};
+}  // namespace
+
+TEST_F(S3FileSystemTest, ReadTextFile) {
+    server->putObject("config.json", "{}");
+    auto fs = ModelManager::getFilesystem("s3://bucket/config.json");
+    std::string contents;
+    ASSERT_EQ(fs->readTextFile("s3://bucket/config.json", &contents), StatusCode::OK);
+    EXPECT_EQ(contents, "{}");
+}
+
+TEST_F(S3FileSystemTest, ConcurrentModelDownloadsWhileFileSystemsAreDestroyed) {
+    const size_t modelsCount = 8;
+    for (size_t i = 0; i < modelsCount; ++i) {
+        const std::string prefix = "model" + std::to_string(i) + "/1/";
+        server->putObject(prefix + "model.xml", "xml" + std::to_string(i));
+        server->putObject(prefix + "model.bin", std::string(1000 + i, 'a' + i));
+    }
+    // Each load uses and destroys its own file system, like parallel model loading in model manager
+    for (size_t round = 0; round < 3; ++round) {
+        std::vector<std::thread> loaders;
+        std::vector<StatusCode> statuses(modelsCount, StatusCode::UNKNOWN_ERROR);
+        std::vector<std::string> localPaths(modelsCount);
+        for (size_t i = 0; i < modelsCount; ++i) {
+            loaders.emplace_back([&, i]() {
+                const std::string basePath = "s3://bucket/model" + std::to_string(i);
+                auto fs = ModelManager::getFilesystem(basePath);
+                statuses[i] = fs->downloadModelVersions(basePath, &localPaths[i], {1});
+            });
+        }
+        for (auto& loader : loaders) {
+            loader.join();
+        }
+        for (size_t i = 0; i < modelsCount; ++i) {
+            ASSERT_EQ(statuses[i], StatusCode::OK) << "model" << i;
+            EXPECT_EQ(readFile(localPaths[i] + "/1/model.xml"), "xml" + std::to_string(i));
+            EXPECT_EQ(readFile(localPaths[i] + "/1/model.bin"), std::string(1000 + i, 'a' + i));
+            std::filesystem::remove_all(localPaths[i]);
+        }
+    }
+}
+
+TEST_F(S3FileSystemTest, DownloadFailsWhenObjectIsReplacedDuringDownload) {
+    server->putObject("model/1/model.xml", "xml");
+    server->putObject("model/1/model.bin", "old weights");
+    std::atomic<bool> replaced{false};
+    server->setAfterObjectMetadata([this, &replaced](const std::string& key) {
+        if (key == "model/1/model.bin" && !replaced.exchange(true)) {
+            server->putObject(key, "new weights");
+        }
+    });
+    auto fs = ModelManager::getFilesystem("s3://bucket/model");
+    std::string localPath;
+    EXPECT_EQ(fs->downloadModelVersions("s3://bucket/model", &localPath, {1}), StatusCode::S3_FAILED_GET_OBJECT);
+    EXPECT_TRUE(replaced);
+    EXPECT_EQ(server->getVersionMismatches(), 1);
+    std::filesystem::remove_all(localPath);
+}
@@ -0,0 +1,113 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <openvino/openvino.hpp>
+#include <rapidjson/document.h>
+
+#include "../modelconfig.hpp"
+#include "../shapebucketing.hpp"
+#include "../status.hpp"
+
+using namespace ovms;
+
+TEST(ShapeBuckets, GetBucket) {
+    ShapeBuckets buckets;
+    buckets.sizes = {32, 64, 128};
+    EXPECT_EQ(buckets.getBucket(1), 32);
+    EXPECT_EQ(buckets.getBucket(32), 32);
+    EXPECT_EQ(buckets.getBucket(33), 64);
+    EXPECT_EQ(buckets.getBucket(128), 128);
+    EXPECT_FALSE(buckets.getBucket(129).has_value());
+    EXPECT_EQ(buckets.getMaxSize(), 128);
+}
+
+TEST(ShapeBuckets, PadTensorInInnerDimension) {
+    std::vector<float> data{1, 2, 3, 4, 5, 6};
+    ov::Tensor tensor(ov::element::f32, ov::Shape{2, 3}, data.data());
+    ov::Tensor padded;
+    ASSERT_EQ(padTensor(tensor, 1, 4, -1, padded), StatusCode::OK);
+    ASSERT_EQ(padded.get_shape(), ov::Shape({2, 4}));
+    std::vector<float> expected{1, 2, 3, -1, 4, 5, 6, -1};
+    EXPECT_EQ(std::vector<float>(padded.data<float>(), padded.data<float>() + padded.get_size()), expected);
+}
+
+TEST(ShapeBuckets, PadTensorInMiddleDimension) {
+    std::vector<int64_t> data{1, 2, 3, 4, 5, 6, 7, 8};
+    ov::Tensor tensor(ov::element::i64, ov::Shape{2, 2, 2}, data.data());
+    ov::Tensor padded;
+    ASSERT_EQ(padTensor(tensor, 1, 3, 0, padded), StatusCode::OK);
+    ASSERT_EQ(padded.get_shape(), ov::Shape({2, 3, 2}));
+    std::vector<int64_t> expected{1, 2, 3, 4, 0, 0, 5, 6, 7, 8, 0, 0};
+    EXPECT_EQ(std::vector<int64_t>(padded.data<int64_t>(), padded.data<int64_t>() + padded.get_size()), expected);
+}
+
+TEST(ShapeBuckets, PadTensorFailsForSmallerBucket) {
+    std::vector<float> data{1, 2, 3, 4, 5, 6};
+    ov::Tensor tensor(ov::element::f32, ov::Shape{2, 3}, data.data());
+    ov::Tensor padded;
+    EXPECT_EQ(padTensor(tensor, 1, 2, 0, padded), StatusCode::INVALID_SHAPE);
+    EXPECT_EQ(padTensor(tensor, 2, 4, 0, padded), StatusCode::INVALID_SHAPE);
+}
+
+TEST(ShapeBuckets, TrimTensor) {
+    std::vector<float> data{1, 2, 3, -1, 4, 5, 6, -1};
+    ov::Tensor tensor(ov::element::f32, ov::Shape{2, 4}, data.data());
+    ov::Tensor trimmed;
+    ASSERT_EQ(trimTensor(tensor, 1, 3, trimmed), StatusCode::OK);
+    ASSERT_EQ(trimmed.get_shape(), ov::Shape({2, 3}));
+    std::vector<float> expected{1, 2, 3, 4, 5, 6};
+    EXPECT_EQ(std::vector<float>(trimmed.data<float>(), trimmed.data<float>() + trimmed.get_size()), expected);
+}
+
+TEST(ShapeBuckets, TrimmedOutputShape) {
+    ShapeBuckets buckets;
+    buckets.dimension = 1;
+    buckets.sizes = {128};
+    buckets.outputs = {{"hidden", 1}, {"pooled", 0}};
+    const shape_buckets_map_t shapeBuckets{{"input_ids", buckets}};
+    EXPECT_EQ(getTrimmedOutputShape(Shape{1, 128, 768}, "hidden", shapeBuckets), Shape({1, Dimension(1, 128), 768}));
+    EXPECT_EQ(getTrimmedOutputShape(Shape{128, 128}, "pooled", shapeBuckets), Shape({Dimension(1, 128), 128}));
+    // Outputs not configured as bucketed are not trimmed, even when dimension size equals the bucket size
+    EXPECT_EQ(getTrimmedOutputShape(Shape{1, 128}, "logits", shapeBuckets), Shape({1, 128}));
+}
+
+TEST(ShapeBuckets, ParseConfig) {
+    const char* json = R"({
+        "name": "model",
+        "base_path": "/tmp/model",
+        "shape_buckets": {"input_ids": {"dim": 1, "sizes": [128, 32, 64, 32], "pad_value": 2, "outputs": {"hidden": 1}}}
+    })";
+    rapidjson::Document document;
+    ASSERT_FALSE(document.Parse(json).HasParseError());
+    ModelConfig config;
+    ASSERT_EQ(config.parseNode(document), StatusCode::OK);
+    ASSERT_EQ(config.getShapeBuckets().count("input_ids"), 1);
+    const auto& buckets = config.getShapeBuckets().at("input_ids");
+    EXPECT_EQ(buckets.dimension, 1);
+    EXPECT_EQ(buckets.sizes, std::vector<dimension_value_t>({32, 64, 128}));
+    EXPECT_EQ(buckets.padValue, 2);
+    EXPECT_EQ(buckets.outputs, (std::map<std::string, size_t>{{"hidden", 1}}));
+
+    ModelConfig changed = config;
+    auto changedBuckets = config.getShapeBuckets();
+    changedBuckets["input_ids"].sizes.push_back(256);
+    changed.setShapeBuckets(changedBuckets);
+    EXPECT_TRUE(config.isReloadRequired(changed));
+}
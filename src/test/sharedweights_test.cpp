@@ -0,0 +1,69 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../sharedweights.hpp"
+
+using namespace ovms;
+
+class SharedWeightsRegistryTest : public ::testing::Test {
+protected:
+    SharedWeightsRegistry registry;
+
+    static std::vector<uint8_t> createWeights(const std::string& content) {
+        return std::vector<uint8_t>(content.begin(), content.end());
+    }
+};
+
+TEST_F(SharedWeightsRegistryTest, AdoptedBufferContent) {
+    auto weights = registry.adopt(createWeights("weights"));
+    ASSERT_NE(weights, nullptr);
+    ASSERT_EQ(weights->getSize(), 7);
+    EXPECT_EQ(std::memcmp(weights->getData(), "weights", 7), 0);
+    auto tensor = weights->getTensor();
+    EXPECT_EQ(tensor.get_byte_size(), 7);
+    EXPECT_EQ(tensor.data(), weights->getData());
+}
+
+TEST_F(SharedWeightsRegistryTest, IdenticalContentShared) {
+    auto first = registry.adopt(createWeights("weights"));
+    auto second = registry.adopt(createWeights("weights"));
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(registry.getUniqueWeightsCount(), 1);
+    EXPECT_EQ(registry.getUniqueWeightsBytes(), 7);
+}
+
+TEST_F(SharedWeightsRegistryTest, DifferentContentOfSameSizeNotShared) {
+    auto first = registry.adopt(createWeights("weights"));
+    auto second = registry.adopt(createWeights("WEIGHTS"));
+    EXPECT_NE(first, second);
+    EXPECT_EQ(registry.getUniqueWeightsCount(), 2);
+    EXPECT_EQ(registry.getUniqueWeightsBytes(), 14);
+}
+
+TEST_F(SharedWeightsRegistryTest, WeightsReleasedWhenNotUsed) {
+    auto first = registry.adopt(createWeights("weights"));
+    auto second = registry.adopt(createWeights("other weights"));
+    first.reset();
+    EXPECT_EQ(registry.getUniqueWeightsCount(), 1);
+    second.reset();
+    EXPECT_EQ(registry.getUniqueWeightsCount(), 0);
+    EXPECT_EQ(registry.getUniqueWeightsBytes(), 0);
+}
@@ -742,6 +742,32 @@ TEST_F(StatefulModelInstanceTempDir, statefulInferManagerMutexTest) {
     cleanerThread.join();
 }
 
+TEST_F(StatefulModelInstanceTempDir, statefulInferReportsSequenceStateMemory) {
+    ConstructorEnabledModelManager manager;
+    std::unique_ptr<ovms::ModelInstanceUnloadGuard> unload_guard;
+    SetUpConfig(modelStatefulConfig);
+    createConfigFileWithContent(ovmsConfig, configFilePath);
+    auto status = manager.loadConfig(configFilePath);
+    ASSERT_TRUE(status.ok());
+    auto modelInstance = manager.findModelInstance(dummyModelName);
+    auto statefulMockedModelInstance = std::static_pointer_cast<MockedStatefulModelInstance>(modelInstance);
+    EXPECT_EQ(statefulMockedModelInstance->getMemoryUsage().sequenceState, 0);
+
+    tensorflow::serving::PredictRequest request;
+    preparePredictRequest(request, modelInput);
+    setRequestSequenceId(&request, 1);
+    setRequestSequenceControl(&request, ovms::SEQUENCE_START);
+    tensorflow::serving::PredictResponse response;
+    ASSERT_EQ(statefulMockedModelInstance->infer(&request, &response, unload_guard, nullptr, nullptr, nullptr), ovms::StatusCode::OK);
+    const size_t oneSequenceState = statefulMockedModelInstance->getMemoryUsage().sequenceState;
+    EXPECT_GT(oneSequenceState, 0);
+
+    setRequestSequenceId(&request, 2);
+    response.Clear();
+    ASSERT_EQ(statefulMockedModelInstance->infer(&request, &response, unload_guard, nullptr, nullptr, nullptr), ovms::StatusCode::OK);
+    EXPECT_EQ(statefulMockedModelInstance->getMemoryUsage().sequenceState, 2 * oneSequenceState);
+}
+
 TEST_F(StatefulModelInstanceTempDir, statefulInferMultipleThreadsSequenceTimeout) {
     ConstructorEnabledModelManager manager;
     std::unique_ptr<ovms::ModelInstanceUnloadGuard> unload_guard;
@@ -13,8 +13,11 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //*****************************************************************************
+#include <atomic>
 #include <chrono>
+#include <future>
 #include <mutex>
+#include <thread>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -402,6 +405,94 @@ node {
     ASSERT_EQ(executor.inferStream(this->firstRequest, this->stream), StatusCode::OK);
 }
 
+TEST_F(StreamingTest, SingleStreamSend3Receive3SingleRequestInFlight) {
+    const std::string pbTxt{R"(
+input_stream: "in"
+output_stream: "out"
+node {
+  calculator: "AddOneSingleStreamTestCalculator"
+  input_stream: "in"
+  output_stream: "out"
+}
+    )"};
+    ::mediapipe::CalculatorGraphConfig config;
+    ASSERT_TRUE(::google::protobuf::TextFormat::ParseFromString(pbTxt, &config));
+
+    // Next request is read only after graph released previous one
+    MediapipeGraphExecutor executor{
+        this->name, this->version, config,
+        {{"in", mediapipe_packet_type_enum::OVTENSOR}},
+        {{"out", mediapipe_packet_type_enum::OVTENSOR}},
+        {"in"}, {"out"}, {}, nullptr, 1};
+
+    prepareRequest(this->firstRequest, {{"in", 3.5f}});
+    EXPECT_CALL(this->stream, Read(_))
+        .WillOnce(Receive({{"in", 7.2f}}))
+        .WillOnce(Receive({{"in", 102.4f}}))
+        .WillOnce(Disconnect());
+
+    EXPECT_CALL(this->stream, Write(_, _))
+        .WillOnce(SendWithTimestamp({{"out", 4.5f}}, 0))
+        .WillOnce(SendWithTimestamp({{"out", 8.2f}}, 1))
+        .WillOnce(SendWithTimestamp({{"out", 103.4f}}, 2));
+
+    ASSERT_EQ(executor.inferStream(this->firstRequest, this->stream), StatusCode::OK);
+}
+
+TEST_F(StreamingTest, SlowClientPausesReading) {
+    const std::string pbTxt{R"(
+input_stream: "in"
+output_stream: "out"
+node {
+  calculator: "AddOneSingleStreamTestCalculator"
+  input_stream: "in"
+  output_stream: "out"
+}
+    )"};
+    ::mediapipe::CalculatorGraphConfig config;
+    ASSERT_TRUE(::google::protobuf::TextFormat::ParseFromString(pbTxt, &config));
+
+    // Single request in flight and single response waiting to be written
+    MediapipeGraphExecutor executor{
+        this->name, this->version, config,
+        {{"in", mediapipe_packet_type_enum::OVTENSOR}},
+        {{"out", mediapipe_packet_type_enum::OVTENSOR}},
+        {"in"}, {"out"}, {}, nullptr, 1};
+
+    const int requestsCount = 20;
+    std::atomic<int> readsCount{0};
+    std::atomic<int> writesCount{0};
+    std::promise<void> clientReceiving;
+    std::shared_future<void> clientReceivingFuture = clientReceiving.get_future().share();
+    prepareRequest(this->firstRequest, {{"in", 0.0f}});
+    EXPECT_CALL(this->stream, Read(_))
+        .WillRepeatedly([&readsCount](::inference::ModelInferRequest* req) {
+            if (readsCount >= requestsCount) {
+                return false;
+            }
+            prepareRequest(*req, {{"in", static_cast<float>(++readsCount)}});
+            return true;
+        });
+    EXPECT_CALL(this->stream, Write(_, _))
+        .WillRepeatedly([&writesCount, clientReceivingFuture](const ::inference::ModelStreamInferResponse& msg, ::grpc::WriteOptions options) {
+            clientReceivingFuture.wait();
+            ++writesCount;
+            return true;
+        });
+
+    int readsBeforeClientReceived = 0;
+    std::thread client([&]() {
+        std::this_thread::sleep_for(300ms);
+        readsBeforeClientReceived = readsCount;
+        clientReceiving.set_value();
+    });
+    ASSERT_EQ(executor.inferStream(this->firstRequest, this->stream), StatusCode::OK);
+    client.join();
+    EXPECT_LE(readsBeforeClientReceived, 3);
+    EXPECT_EQ(readsCount, requestsCount);
+    EXPECT_EQ(writesCount, requestsCount + 1);
+}
+
 class StreamingWithOVMSCalculatorsTest : public StreamingTest {
 protected:
     ovms::Server& server = ovms::Server::instance();
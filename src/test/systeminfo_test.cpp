@@ -14,17 +14,28 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <filesystem>
+#include <fstream>
+#include <string>
 #include <thread>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <pthread.h>
+#include <sched.h>
 #include <unistd.h>
 
 #include "../status.hpp"
 #include "../systeminfo.hpp"
 
 using namespace testing;
+using ovms::coreListToString;
+using ovms::cpu_cores_t;
+using ovms::CpuAffinityGuard;
 using ovms::getCoreCount;
+using ovms::getNumaTopology;
+using ovms::numaTopologyToString;
+using ovms::parseCoreList;
 using ovms::StatusCode;
 
 TEST(SystemInfo, getCoreCount) {
@@ -32,3 +43,75 @@ TEST(SystemInfo, getCoreCount) {
     EXPECT_GE(cpuCount, 1);
     EXPECT_LE(cpuCount, std::thread::hardware_concurrency());
 }
+
+TEST(SystemInfo, parseCoreList) {
+    cpu_cores_t cores;
+    ASSERT_EQ(parseCoreList("0-3, 8,10-11", cores), StatusCode::OK);
+    EXPECT_THAT(cores, ElementsAre(0, 1, 2, 3, 8, 10, 11));
+    EXPECT_EQ(coreListToString(cores), "0-3,8,10-11");
+    ASSERT_EQ(parseCoreList("5,1,5", cores), StatusCode::OK);
+    EXPECT_THAT(cores, ElementsAre(1, 5));
+}
+
+TEST(SystemInfo, parseCoreListInvalid) {
+    cpu_cores_t cores;
+    EXPECT_EQ(parseCoreList("3-1", cores), StatusCode::MODEL_CONFIG_INVALID);
+    EXPECT_EQ(parseCoreList("a", cores), StatusCode::MODEL_CONFIG_INVALID);
+    EXPECT_EQ(parseCoreList("1-2-3", cores), StatusCode::MODEL_CONFIG_INVALID);
+    EXPECT_EQ(parseCoreList("100000", cores), StatusCode::MODEL_CONFIG_INVALID);
+}
+
+static cpu_cores_t getProcessCores() {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    sched_getaffinity(0, sizeof(set), &set);
+    cpu_cores_t cores;
+    for (uint16_t core = 0; core < CPU_SETSIZE; core++) {
+        if (CPU_ISSET(core, &set)) {
+            cores.push_back(core);
+        }
+    }
+    return cores;
+}
+
+TEST(SystemInfo, getNumaTopologyFromSysfs) {
+    const std::string directory = "/tmp/ovms_systeminfo_test_nodes";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory + "/node0");
+    std::filesystem::create_directories(directory + "/node1");
+    const cpu_cores_t processCores = getProcessCores();
+    ASSERT_FALSE(processCores.empty());
+    std::ofstream(directory + "/node0/cpulist") << coreListToString(processCores) << std::endl;
+    std::ofstream(directory + "/node1/cpulist") << "" << std::endl;
+    auto topology = getNumaTopology(directory);
+    std::filesystem::remove_all(directory);
+    // Nodes without cores available for the process are skipped
+    ASSERT_EQ(topology.size(), 1);
+    EXPECT_EQ(topology.at(0), processCores);
+    EXPECT_EQ(numaTopologyToString(topology), "node 0: cores " + coreListToString(processCores));
+}
+
+TEST(SystemInfo, getNumaTopologyFallsBackToSingleNode) {
+    auto topology = getNumaTopology("/tmp/ovms_systeminfo_test_not_existing");
+    ASSERT_EQ(topology.size(), 1);
+    EXPECT_EQ(topology.at(0), getProcessCores());
+}
+
+TEST(SystemInfo, CpuAffinityGuardRestoresAffinity) {
+    const cpu_cores_t processCores = getProcessCores();
+    cpu_set_t before;
+    CPU_ZERO(&before);
+    pthread_getaffinity_np(pthread_self(), sizeof(before), &before);
+    {
+        CpuAffinityGuard guard({processCores.front()});
+        cpu_set_t inside;
+        CPU_ZERO(&inside);
+        pthread_getaffinity_np(pthread_self(), sizeof(inside), &inside);
+        EXPECT_EQ(CPU_COUNT(&inside), 1);
+        EXPECT_TRUE(CPU_ISSET(processCores.front(), &inside));
+    }
+    cpu_set_t after;
+    CPU_ZERO(&after);
+    pthread_getaffinity_np(pthread_self(), sizeof(after), &after);
+    EXPECT_TRUE(CPU_EQUAL(&before, &after));
+}
@@ -618,6 +618,7 @@ public:
         join();
         spdlog::info("Destructor of modelmanager(Enabled one). Models #:{}", models.size());
         models.clear();
+        publishModelsSnapshot();
         spdlog::info("Destructor of modelmanager(Enabled one). Models #:{}", models.size());
     }
     ovms::Status loadConfig(const std::string& jsonFilename) {
@@ -0,0 +1,180 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <rapidjson/document.h>
+
+#include "../tracer.hpp"
+
+using namespace ovms;
+
+TEST(TraceRingBuffer, KeepsMostRecentEvents) {
+    TraceRingBuffer buffer(1);
+    const uint64_t eventsCount = TraceRingBuffer::CAPACITY + 10;
+    for (uint64_t i = 0; i < eventsCount; ++i) {
+        TraceEvent event;
+        event.name = "event";
+        event.startNs = i;
+        event.requestId = 1;
+        buffer.push(event);
+    }
+    std::vector<TraceEvent> events;
+    buffer.collect(0, events);
+    ASSERT_EQ(events.size(), TraceRingBuffer::CAPACITY);
+    EXPECT_EQ(events.front().startNs, eventsCount - TraceRingBuffer::CAPACITY);
+    EXPECT_EQ(events.back().startNs, eventsCount - 1);
+}
+
+TEST(TraceRingBuffer, CollectSkipsEventsEndedBeforeWindow) {
+    TraceRingBuffer buffer(1);
+    TraceEvent event;
+    event.startNs = 100;
+    event.durationNs = 50;
+    buffer.push(event);
+    event.startNs = 200;
+    buffer.push(event);
+    std::vector<TraceEvent> events;
+    buffer.collect(160, events);
+    ASSERT_EQ(events.size(), 1);
+    EXPECT_EQ(events[0].startNs, 200);
+}
+
+class TracerTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        Tracer::instance().setSamplingRate(0);
+        Tracer::setCurrentRequestId(0);
+    }
+};
+
+TEST_F(TracerTest, DisabledByDefault) {
+    EXPECT_EQ(Tracer::instance().getSamplingRate(), 0);
+    EXPECT_EQ(Tracer::instance().sampleRequest(), 0);
+    TraceRequestGuard guard;
+    EXPECT_EQ(Tracer::getCurrentRequestId(), 0);
+}
+
+TEST_F(TracerTest, SamplesOneInNRequests) {
+    const uint32_t rate = 4;
+    Tracer::instance().setSamplingRate(rate);
+    uint32_t sampled = 0;
+    for (uint32_t i = 0; i < rate * 10; ++i) {
+        if (Tracer::instance().sampleRequest()) {
+            ++sampled;
+        }
+    }
+    EXPECT_EQ(sampled, 10);
+}
+
+TEST_F(TracerTest, RequestGuardRestoresPreviousRequest) {
+    Tracer::instance().setSamplingRate(1);
+    {
+        TraceRequestGuard outer;
+        const uint64_t requestId = Tracer::getCurrentRequestId();
+        ASSERT_NE(requestId, 0);
+        {
+            // Nested frontend keeps request of the outer one
+            TraceRequestGuard inner;
+            EXPECT_EQ(Tracer::getCurrentRequestId(), requestId);
+        }
+        {
+            TraceRequestGuard continued(requestId + 1000);
+            EXPECT_EQ(Tracer::getCurrentRequestId(), requestId + 1000);
+        }
+        EXPECT_EQ(Tracer::getCurrentRequestId(), requestId);
+    }
+    EXPECT_EQ(Tracer::getCurrentRequestId(), 0);
+}
+
+TEST_F(TracerTest, NotSampledRequestIsNotRecorded) {
+    Tracer::instance().setSamplingRate(0);
+    {
+        TraceRequestGuard guard;
+        TraceScope scope("TracerTest_NotSampled");
+    }
+    EXPECT_EQ(Tracer::instance().dump().find("TracerTest_NotSampled"), std::string::npos);
+}
+
+TEST_F(TracerTest, DumpConnectsRequestEventsAcrossThreads) {
+    Tracer::instance().setSamplingRate(1);
+    uint64_t requestId = 0;
+    {
+        TraceRequestGuard guard;
+        requestId = Tracer::getCurrentRequestId();
+        TraceScope scope("TracerTest_Frontend");
+        traceEvent('b', "TracerTest_Async", 42);
+        std::thread worker([requestId]() {
+            TraceRequestGuard continued(requestId);
+            TraceScope scope("TracerTest_Callback");
+            traceEvent('e', "TracerTest_Async", 42);
+        });
+        worker.join();
+    }
+    ASSERT_NE(requestId, 0);
+
+    rapidjson::Document doc;
+    doc.Parse(Tracer::instance().dump().c_str());
+    ASSERT_FALSE(doc.HasParseError());
+    ASSERT_TRUE(doc.HasMember("traceEvents"));
+    ASSERT_TRUE(doc["traceEvents"].IsArray());
+    std::set<std::string> names;
+    std::set<std::string> flowPhases;
+    std::set<uint64_t> threads;
+    for (const auto& event : doc["traceEvents"].GetArray()) {
+        const std::string name = event["name"].GetString();
+        const std::string phase = event["ph"].GetString();
+        if (name == "request") {
+            if (event["id"].GetUint64() == requestId) {
+                flowPhases.insert(phase);
+            }
+            continue;
+        }
+        if (name.rfind("TracerTest_", 0) != 0 || event["args"]["request_id"].GetUint64() != requestId) {
+            continue;
+        }
+        names.insert(name + ":" + phase);
+        threads.insert(event["tid"].GetUint64());
+        if (phase == "b" || phase == "e") {
+            EXPECT_EQ(event["id"].GetUint64(), 42);
+        }
+    }
+    EXPECT_EQ(names, (std::set<std::string>{"TracerTest_Frontend:X", "TracerTest_Callback:X", "TracerTest_Async:b", "TracerTest_Async:e"}));
+    EXPECT_EQ(threads.size(), 2);
+    EXPECT_EQ(flowPhases, (std::set<std::string>{"s", "f"}));
+}
+
+TEST_F(TracerTest, BuffersOfExitedThreadsAreReused) {
+    Tracer::instance().setSamplingRate(1);
+    auto recordInNewThread = [](const char* name) {
+        std::thread worker([name]() {
+            TraceRequestGuard guard;
+            TraceScope scope(name);
+        });
+        worker.join();
+    };
+    recordInNewThread("TracerTest_FirstThread");
+    const size_t buffersCount = Tracer::instance().getThreadBuffersCount();
+    for (size_t i = 0; i < 100; ++i) {
+        recordInNewThread("TracerTest_NextThread");
+    }
+    EXPECT_EQ(Tracer::instance().getThreadBuffersCount(), buffersCount);
+    // Events of exited thread are still dumped after its buffer is reused
+    EXPECT_NE(Tracer::instance().dump().find("TracerTest_FirstThread"), std::string::npos);
+}
@@ -0,0 +1,245 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "tracer.hpp"
+
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <utility>
+
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include "logging.hpp"
+
+namespace ovms {
+
+static_assert((TraceRingBuffer::CAPACITY & (TraceRingBuffer::CAPACITY - 1)) == 0, "Trace ring buffer capacity has to be power of 2");
+
+/**
+ * @brief Returns ring buffer of the thread to the tracer when thread exits
+ */
+struct ThreadBufferHolder {
+    TraceRingBuffer* buffer = nullptr;
+
+    ~ThreadBufferHolder() {
+        if (buffer != nullptr) {
+            Tracer::instance().releaseThreadBuffer(buffer);
+        }
+    }
+};
+
+static thread_local uint64_t currentRequestId = 0;
+static thread_local ThreadBufferHolder threadBuffer;
+
+TraceRingBuffer::TraceRingBuffer(uint32_t threadId) :
+    threadId(threadId),
+    slots(std::make_unique<Slot[]>(CAPACITY)) {}
+
+void TraceRingBuffer::push(const TraceEvent& event) {
+    const uint64_t index = head.load(std::memory_order_relaxed);
+    Slot& slot = slots[index & (CAPACITY - 1)];
+    // Odd sequence marks slot being written, readers skip it
+    slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.event = event;
+    slot.event.threadId = threadId;
+    slot.sequence.store(2 * index + 2, std::memory_order_release);
+    head.store(index + 1, std::memory_order_release);
+}
+
+void TraceRingBuffer::collect(uint64_t sinceNs, std::vector<TraceEvent>& events) const {
+    const uint64_t end = head.load(std::memory_order_acquire);
+    const uint64_t begin = end > CAPACITY ? end - CAPACITY : 0;
+    for (uint64_t index = begin; index < end; ++index) {
+        const Slot& slot = slots[index & (CAPACITY - 1)];
+        const uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence != 2 * index + 2) {
+            continue;
+        }
+        TraceEvent event = slot.event;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) != sequence) {
+            continue;
+        }
+        if (event.startNs + event.durationNs >= sinceNs) {
+            events.push_back(event);
+        }
+    }
+}
+
+Tracer& Tracer::instance() {
+    static Tracer tracer;
+    return tracer;
+}
+
+void Tracer::setSamplingRate(uint32_t samplingRate) {
+    SPDLOG_INFO("Request tracing sampling rate set to: {}", samplingRate);
+    this->samplingRate.store(samplingRate, std::memory_order_relaxed);
+}
+
+uint64_t Tracer::sampleRequest() {
+    const uint32_t rate = samplingRate.load(std::memory_order_relaxed);
+    if (rate == 0) {
+        return 0;
+    }
+    const uint64_t requestNumber = requestsCounter.fetch_add(1, std::memory_order_relaxed) + 1;
+    return (requestNumber % rate == 0) ? requestNumber : 0;
+}
+
+uint64_t Tracer::getCurrentRequestId() {
+    return currentRequestId;
+}
+
+void Tracer::setCurrentRequestId(uint64_t requestId) {
+    currentRequestId = requestId;
+}
+
+uint64_t Tracer::now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+TraceRingBuffer& Tracer::getThreadBuffer() {
+    if (threadBuffer.buffer == nullptr) {
+        const uint32_t threadId = static_cast<uint32_t>(syscall(SYS_gettid));
+        std::lock_guard<std::mutex> lock(buffersMtx);
+        if (freeBuffers.empty()) {
+            buffers.push_back(std::make_unique<TraceRingBuffer>(threadId));
+            threadBuffer.buffer = buffers.back().get();
+        } else {
+            // Events of exited thread stay in the buffer until overwritten, so they can still be dumped
+            threadBuffer.buffer = freeBuffers.back();
+            freeBuffers.pop_back();
+            threadBuffer.buffer->setThreadId(threadId);
+        }
+    }
+    return *threadBuffer.buffer;
+}
+
+void Tracer::releaseThreadBuffer(TraceRingBuffer* buffer) {
+    std::lock_guard<std::mutex> lock(buffersMtx);
+    freeBuffers.push_back(buffer);
+}
+
+size_t Tracer::getThreadBuffersCount() const {
+    std::lock_guard<std::mutex> lock(buffersMtx);
+    return buffers.size();
+}
+
+void Tracer::record(const TraceEvent& event) {
+    getThreadBuffer().push(event);
+}
+
+static void writeCommon(rapidjson::Writer<rapidjson::StringBuffer>& writer, const char* name, const char* phase, uint64_t timestampNs, int pid, uint32_t tid) {
+    writer.Key("name");
+    writer.String(name);
+    writer.Key("cat");
+    writer.String("OVMS");
+    writer.Key("ph");
+    writer.String(phase);
+    writer.Key("ts");
+    writer.Double(timestampNs / 1000.0);
+    writer.Key("pid");
+    writer.Int(pid);
+    writer.Key("tid");
+    writer.Uint(tid);
+}
+
+std::string Tracer::dump(uint32_t lastSeconds) const {
+    const uint64_t currentNs = now();
+    const uint64_t windowNs = static_cast<uint64_t>(lastSeconds) * 1'000'000'000;
+    const uint64_t sinceNs = currentNs > windowNs ? currentNs - windowNs : 0;
+    std::vector<TraceEvent> events;
+    {
+        std::lock_guard<std::mutex> lock(buffersMtx);
+        for (const auto& buffer : buffers) {
+            buffer->collect(sinceNs, events);
+        }
+    }
+    const int pid = getpid();
+    // Complete events of each request ordered by start time, used to draw flow between threads
+    std::map<uint64_t, std::vector<std::pair<uint64_t, uint32_t>>> requestsSlices;
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    writer.Key("displayTimeUnit");
+    writer.String("ms");
+    writer.Key("traceEvents");
+    writer.StartArray();
+    for (const auto& event : events) {
+        const char phase[] = {event.phase, '\0'};
+        writer.StartObject();
+        writeCommon(writer, event.name, phase, event.startNs, pid, event.threadId);
+        if (event.phase == 'X') {
+            writer.Key("dur");
+            writer.Double(event.durationNs / 1000.0);
+            requestsSlices[event.requestId].emplace_back(event.startNs, event.threadId);
+        }
+        if (event.phase == 'b' || event.phase == 'e') {
+            writer.Key("id");
+            writer.Uint64(event.asyncId);
+        }
+        writer.Key("args");
+        writer.StartObject();
+        writer.Key("request_id");
+        writer.Uint64(event.requestId);
+        writer.EndObject();
+        writer.EndObject();
+    }
+    for (auto& [requestId, slices] : requestsSlices) {
+        if (slices.size() < 2) {
+            continue;
+        }
+        std::sort(slices.begin(), slices.end());
+        for (size_t i = 0; i < slices.size(); ++i) {
+            const char* phase = (i == 0) ? "s" : ((i + 1 == slices.size()) ? "f" : "t");
+            writer.StartObject();
+            writeCommon(writer, "request", phase, slices[i].first, pid, slices[i].second);
+            writer.Key("id");
+            writer.Uint64(requestId);
+            if (i != 0) {
+                writer.Key("bp");
+                writer.String("e");
+            }
+            writer.EndObject();
+        }
+    }
+    writer.EndArray();
+    writer.EndObject();
+    return buffer.GetString();
+}
+
+TraceRequestGuard::TraceRequestGuard() :
+    previousRequestId(Tracer::getCurrentRequestId()) {
+    if (!previousRequestId) {
+        Tracer::setCurrentRequestId(Tracer::instance().sampleRequest());
+    }
+}
+
+TraceRequestGuard::TraceRequestGuard(uint64_t requestId) :
+    previousRequestId(Tracer::getCurrentRequestId()) {
+    Tracer::setCurrentRequestId(requestId);
+}
+
+TraceRequestGuard::~TraceRequestGuard() {
+    Tracer::setCurrentRequestId(previousRequestId);
+}
+
+}  // namespace ovms
@@ -0,0 +1,188 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ovms {
+
+/**
+ * @brief Single event of a sampled request. Event names have static storage duration (string literals, __PRETTY_FUNCTION__).
+ *
+ * Phases follow Chrome trace event format: 'X' complete, 'B'/'E' synchronous begin/end, 'b'/'e' asynchronous begin/end.
+ */
+struct TraceEvent {
+    const char* name = nullptr;
+    uint64_t startNs = 0;
+    uint64_t durationNs = 0;
+    uint64_t requestId = 0;
+    uint64_t asyncId = 0;
+    uint32_t threadId = 0;
+    char phase = 'X';
+};
+
+/**
+ * @brief Fixed size buffer of the most recent events of a single thread.
+ *
+ * Written without locks by the owning thread only. Readers from other threads skip slots overwritten during read.
+ * After owning thread exits buffer is passed to a new thread, events keep id of the thread which recorded them.
+ */
+class TraceRingBuffer {
+public:
+    static constexpr size_t CAPACITY = 4096;
+
+    explicit TraceRingBuffer(uint32_t threadId);
+
+    void push(const TraceEvent& event);
+    void collect(uint64_t sinceNs, std::vector<TraceEvent>& events) const;
+    uint32_t getThreadId() const { return threadId; }
+    void setThreadId(uint32_t threadId) { this->threadId = threadId; }
+
+private:
+    struct Slot {
+        std::atomic<uint64_t> sequence{0};
+        TraceEvent event;
+    };
+
+    uint32_t threadId;
+    std::atomic<uint64_t> head{0};
+    std::unique_ptr<Slot[]> slots;
+};
+
+/**
+ * @brief Always compiled in request tracer. Traces 1 in N requests, where N is set in runtime.
+ * Events of sampled requests are stored in per thread ring buffers and can be dumped in Chrome trace format,
+ * which is readable by Perfetto UI and chrome://tracing.
+ */
+class Tracer {
+public:
+    static constexpr uint32_t DEFAULT_DUMP_SECONDS = 10;
+
+    static Tracer& instance();
+
+    /**
+     * @brief Sets request sampling rate, 0 disables tracing, 1 traces every request
+     */
+    void setSamplingRate(uint32_t samplingRate);
+    uint32_t getSamplingRate() const { return samplingRate.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Returns id of new sampled request or 0 if request is not sampled
+     */
+    uint64_t sampleRequest();
+
+    static uint64_t getCurrentRequestId();
+    static void setCurrentRequestId(uint64_t requestId);
+    static uint64_t now();
+
+    /**
+     * @brief Stores event in the ring buffer of the calling thread
+     */
+    void record(const TraceEvent& event);
+
+    /**
+     * @brief Returns events from the last seconds as Chrome trace JSON. Events of a single request
+     * are connected with flow events across threads.
+     */
+    std::string dump(uint32_t lastSeconds = DEFAULT_DUMP_SECONDS) const;
+
+    /**
+     * @brief Returns number of allocated ring buffers, equal to the highest number of threads recording events at the same time
+     */
+    size_t getThreadBuffersCount() const;
+
+private:
+    friend struct ThreadBufferHolder;
+
+    Tracer() = default;
+    TraceRingBuffer& getThreadBuffer();
+    void releaseThreadBuffer(TraceRingBuffer* buffer);
+
+    std::atomic<uint32_t> samplingRate{0};
+    std::atomic<uint64_t> requestsCounter{0};
+
+    mutable std::mutex buffersMtx;
+    std::vector<std::unique_ptr<TraceRingBuffer>> buffers;
+    // Buffers of exited threads, reused by new threads
+    std::vector<TraceRingBuffer*> freeBuffers;
+};
+
+/**
+ * @brief Marks work done by current thread on behalf of a request.
+ *
+ * Default constructed guard samples new request, unless thread already handles a request, e.g. REST frontend calling KServe implementation.
+ * Guard constructed with request id continues the request in another thread, e.g. in OpenVINO completion callback.
+ */
+class TraceRequestGuard {
+    const uint64_t previousRequestId;
+
+public:
+    TraceRequestGuard();
+    explicit TraceRequestGuard(uint64_t requestId);
+    ~TraceRequestGuard();
+};
+
+/**
+ * @brief Records complete event for the lifetime of the scope when current request is sampled
+ */
+class TraceScope {
+    const char* name;
+    const uint64_t requestId;
+    uint64_t startNs = 0;
+
+public:
+    explicit TraceScope(const char* name) :
+        name(name),
+        requestId(Tracer::getCurrentRequestId()) {
+        if (requestId) {
+            startNs = Tracer::now();
+        }
+    }
+    ~TraceScope() {
+        if (requestId) {
+            TraceEvent event;
+            event.name = name;
+            event.startNs = startNs;
+            event.durationNs = Tracer::now() - startNs;
+            event.requestId = requestId;
+            Tracer::instance().record(event);
+        }
+    }
+};
+
+/**
+ * @brief Records instant event (begin/end) when current request is sampled
+ */
+inline void traceEvent(char phase, const char* name, uint64_t asyncId = 0) {
+    const uint64_t requestId = Tracer::getCurrentRequestId();
+    if (!requestId) {
+        return;
+    }
+    TraceEvent event;
+    event.name = name;
+    event.startNs = Tracer::now();
+    event.requestId = requestId;
+    event.asyncId = asyncId;
+    event.phase = phase;
+    Tracer::instance().record(event);
+}
+
+}  // namespace ovms